@@ -35,6 +35,13 @@ namespace EE
         cli::Parser cmdParser( argc, argv );
         cmdParser.set_optional<std::string>( "map", "map", "", "The startup map." );
 
+        #if EE_DEVELOPMENT_TOOLS
+        cmdParser.set_optional<bool>( "soaktest", "soaktest", false, "Run a map streaming soak test over a generated cell grid, log the results and exit." );
+        cmdParser.set_optional<std::string>( "soaktestmaps", "soaktestmaps", "", "The map path format for the soak test cells, e.g. 'data://maps/world/cell_%d_%d.map'." );
+        cmdParser.set_optional<int32_t>( "soaktestgrid", "soaktestgrid", 8, "The number of soak test cells along each axis." );
+        cmdParser.set_optional<float>( "soaktestcellsize", "soaktestcellsize", 128.0f, "The size of each soak test cell in meters." );
+        #endif
+
         if ( !cmdParser.run() )
         {
             return FatalError( "Invalid command line arguments!" );
@@ -46,6 +53,23 @@ namespace EE
             m_engine.m_startupMap = ResourcePath( map.c_str() );
         }
 
+        #if EE_DEVELOPMENT_TOOLS
+        if ( cmdParser.get<bool>( "soaktest" ) )
+        {
+            int32_t const numCells = cmdParser.get<int32_t>( "soaktestgrid" );
+            float const cellSize = cmdParser.get<float>( "soaktestcellsize" );
+            if ( numCells <= 0 || cellSize <= 0.0f )
+            {
+                return FatalError( "Invalid soak test grid, the number of cells and the cell size must be positive!" );
+            }
+
+            m_engine.m_runSoakTest = true;
+            m_engine.m_soakTestMapPathFormat = cmdParser.get<std::string>( "soaktestmaps" ).c_str();
+            m_engine.m_soakTestNumCells = numCells;
+            m_engine.m_soakTestCellSize = cellSize;
+        }
+        #endif
+
         return true;
     }
 
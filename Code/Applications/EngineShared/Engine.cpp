@@ -5,6 +5,8 @@
 #include "System/Time/Timers.h"
 #include "System/IniFile.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Streaming/DebugViews/DebugView_MapStreaming.h"
 
 #include "_AutoGenerated/EngineTypeRegistration.h"
 
@@ -154,6 +156,33 @@ namespace EE
         m_pToolsUI->Initialize( m_updateContext, m_pImguiSystem->GetImageCache() );
         #endif
 
+        // Start the map streaming soak test
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_runSoakTest )
+        {
+            EntityWorld* pGameWorld = m_pEntityWorldManager->GetGameWorld();
+            if ( pGameWorld != nullptr )
+            {
+                for ( auto pDebugView : pGameWorld->GetDebugViews() )
+                {
+                    m_pSoakTestDebugView = TryCast<MapStreamingDebugView>( pDebugView );
+                    if ( m_pSoakTestDebugView != nullptr )
+                    {
+                        break;
+                    }
+                }
+            }
+
+            if ( m_pSoakTestDebugView == nullptr )
+            {
+                return m_fatalErrorHandler( "Failed to start the map streaming soak test, no map streaming debug view found!" );
+            }
+
+            char const* pMapPathFormat = m_soakTestMapPathFormat.empty() ? m_pSoakTestDebugView->GetDefaultCellGridPathFormat() : m_soakTestMapPathFormat.c_str();
+            m_pSoakTestDebugView->RunSoakTest( pMapPathFormat, m_soakTestCellSize, m_soakTestNumCells, m_soakTestNumCells );
+        }
+        #endif
+
         m_initialized = true;
         return true;
     }
@@ -483,6 +512,14 @@ namespace EE
         // Should we exit?
         //-------------------------------------------------------------------------
 
+        // The soak test logs its results when it ends
+        #if EE_DEVELOPMENT_TOOLS
+        if ( m_pSoakTestDebugView != nullptr && !m_pSoakTestDebugView->IsSoakTestRunning() )
+        {
+            return false;
+        }
+        #endif
+
         return true;
     }
 }
\ No newline at end of file
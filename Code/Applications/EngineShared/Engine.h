@@ -12,6 +12,12 @@
 
 namespace EE
 {
+    #if EE_DEVELOPMENT_TOOLS
+    class MapStreamingDebugView;
+    #endif
+
+    //-------------------------------------------------------------------------
+
     class Engine
     {
         friend class EngineApplication;
@@ -89,5 +95,14 @@ namespace EE
         bool                                            m_initialized = false;
 
         bool                                            m_exitRequested = false;
+
+        // Map streaming soak test - if requested, a generated cell grid is streamed in after startup and the engine exits once the test ends
+        #if EE_DEVELOPMENT_TOOLS
+        bool                                            m_runSoakTest = false;
+        String                                          m_soakTestMapPathFormat;
+        int32_t                                         m_soakTestNumCells = 8;
+        float                                           m_soakTestCellSize = 128.0f;
+        MapStreamingDebugView*                          m_pSoakTestDebugView = nullptr;
+        #endif
     };
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
 #include "ClangVisitors_TranslationUnit.h"
 #include "Applications/Reflector/ReflectorSettingsAndUtils.h"
 #include "Applications/Reflector/Database/ReflectionDatabase.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Math/Math.h"
 #include "System/Time/Timers.h"
 #include "System/Platform/PlatformHelpers_Win32.h"
 #include <fstream>
@@ -10,6 +12,44 @@
 
 namespace EE::TypeSystem::Reflection
 {
+    namespace
+    {
+        // Parses each translation unit with its own clang index, this is the expensive part of reflection and is safe to run concurrently
+        class ParseTranslationUnitsTask final : public ITaskSet
+        {
+        public:
+
+            ParseTranslationUnitsTask( TVector<ClangParser::TranslationUnit>& translationUnits, TVector<char const*> const* pClangArgs )
+                : m_translationUnits( translationUnits )
+                , m_pClangArgs( pClangArgs )
+            {
+                m_SetSize = (uint32_t) translationUnits.size();
+            }
+
+        private:
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
+
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    ClangParser::TranslationUnit& translationUnit = m_translationUnits[i];
+                    TVector<char const*> const& clangArgs = m_pClangArgs[translationUnit.m_pass];
+                    translationUnit.m_index = clang_createIndex( 0, 1 );
+                    translationUnit.m_result = clang_parseTranslationUnit2( translationUnit.m_index, translationUnit.m_amalgamatedHeaderPath.c_str(), clangArgs.data(), (int32_t) clangArgs.size(), 0, 0, clangOptions, &translationUnit.m_tu );
+                }
+            }
+
+        private:
+
+            TVector<ClangParser::TranslationUnit>&          m_translationUnits;
+            TVector<char const*> const*                     m_pClangArgs;
+        };
+    }
+
+    //-------------------------------------------------------------------------
+
     ClangParser::ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath )
         : m_context( pSolution, pDatabase )
         , m_totalParsingTime( 0 )
@@ -17,21 +57,59 @@ namespace EE::TypeSystem::Reflection
         , m_reflectionDataPath( reflectionDataPath )
     {}
 
-    bool ClangParser::Parse( TVector<HeaderInfo*> const& headers, Pass pass )
+    bool ClangParser::CreateClangArgs()
     {
-        m_context.m_detectDevOnlyTypesAndProperties = ( pass == NoDevToolsPass );
+        m_clangArgStrings.clear();
+        m_clangArgs[DevToolsPass].clear();
+        m_clangArgs[NoDevToolsPass].clear();
 
-        // Create single amalgamated header file for all headers to parse
-        //-------------------------------------------------------------------------
+        // Include paths
+        int32_t const numIncludePaths = sizeof( Settings::g_includePaths ) / sizeof( Settings::g_includePaths[0] );
+        m_clangArgStrings.reserve( numIncludePaths );
+        for ( auto i = 0; i < numIncludePaths; i++ )
+        {
+            String const fullPath = m_context.m_pSolution->m_path + Settings::g_includePaths[i];
+            if ( !FileSystem::Exists( fullPath ) )
+            {
+                m_context.LogError( "Invalid include path: %s", fullPath.c_str() );
+                return false;
+            }
+
+            String const shortPath = Platform::Win32::GetShortPath( fullPath );
+            m_clangArgStrings.push_back( "-I" + shortPath );
+        }
 
-        std::ofstream reflectorFileStream;
-        FileSystem::Path const reflectorHeader = m_reflectionDataPath + "Reflector.h";
-        reflectorHeader.EnsureDirectoryExists();
-        reflectorFileStream.open( reflectorHeader.c_str(), std::ios::out | std::ios::trunc );
-        EE_ASSERT( !reflectorFileStream.fail() );
+        // Both passes share the same args, the no dev tools pass additionally excludes all dev tools code
+        for ( auto& clangArgs : m_clangArgs )
+        {
+            for ( auto const& includePathArg : m_clangArgStrings )
+            {
+                clangArgs.push_back( includePathArg.c_str() );
+            }
+
+            clangArgs.push_back( "-x" );
+            clangArgs.push_back( "c++" );
+            clangArgs.push_back( "-std=c++17" );
+            clangArgs.push_back( "-O0" );
+            clangArgs.push_back( "-D NDEBUG" );
+            clangArgs.push_back( "-Werror" );
+            clangArgs.push_back( "-Wno-deprecated-builtins" );
+            clangArgs.push_back( "-fparse-all-comments" );
+            clangArgs.push_back( "-Wno-unknown-warning-option" );
+            clangArgs.push_back( "-Wno-return-type-c-linkage" );
+            clangArgs.push_back( "-Wno-gnu-folding-constant" );
+        }
 
-        String includeStr;
-        m_context.m_headersToVisit.clear();
+        m_clangArgs[NoDevToolsPass].push_back( Settings::g_devToolsExclusionDefine );
+
+        return true;
+    }
+
+    bool ClangParser::CreateTranslationUnits( TVector<HeaderInfo*> const& headers, Pass pass, int32_t maxTranslationUnits )
+    {
+        EE_ASSERT( maxTranslationUnits > 0 );
+
+        TVector<HeaderInfo const*> headersToInclude;
         for ( HeaderInfo const* pHeader : headers )
         {
             // Exclude dev tools
@@ -40,74 +118,82 @@ namespace EE::TypeSystem::Reflection
                 continue;
             }
 
-            m_context.m_headersToVisit.push_back( pHeader->m_ID );
-            includeStr += "#include \"" + pHeader->m_filePath.GetString() + "\"\n";
+            headersToInclude.push_back( pHeader );
+        }
+
+        if ( headersToInclude.empty() )
+        {
+            return true;
         }
 
-        reflectorFileStream.write( includeStr.c_str(), includeStr.size() );
-        reflectorFileStream.close();
+        // Split the headers into contiguous chunks, we only ever split on project boundaries
+        // Since the projects are sorted by dependency, any type a header relies on will always have been visited by an earlier unit
+        //-------------------------------------------------------------------------
 
-        // Clang args
-        TInlineVector<String, 10> fullIncludePaths;
-        TInlineVector<char const*, 10> clangArgs;
-        int32_t const numIncludePaths = sizeof( Settings::g_includePaths ) / sizeof( Settings::g_includePaths[0] );
-        for ( auto i = 0; i < numIncludePaths; i++ )
+        int32_t const numHeaders = (int32_t) headersToInclude.size();
+        int32_t const numDesiredUnits = Math::Clamp( numHeaders / Settings::g_minHeadersPerTranslationUnit, 1, maxTranslationUnits );
+        int32_t const desiredHeadersPerUnit = ( numHeaders + numDesiredUnits - 1 ) / numDesiredUnits;
+
+        char const* const pPassName = ( pass == DevToolsPass ) ? "Dev" : "NoDev";
+        TVector<String> includeStrings;
+
+        for ( int32_t i = 0; i < numHeaders; i++ )
         {
-            String const fullPath = m_context.m_pSolution->m_path + Settings::g_includePaths[i];
-            String const shortPath = Platform::Win32::GetShortPath( fullPath );
-            fullIncludePaths.push_back( "-I" + shortPath );
-            clangArgs.push_back( fullIncludePaths.back().c_str() );
+            HeaderInfo const* pHeader = headersToInclude[i];
 
-            if ( !FileSystem::Exists( fullPath ) )
+            bool const isProjectBoundary = ( i > 0 ) && ( headersToInclude[i - 1]->m_projectID != pHeader->m_projectID );
+            bool const shouldStartNewUnit = ( i == 0 ) || ( isProjectBoundary && (int32_t) m_translationUnits.back().m_headersToVisit.size() >= desiredHeadersPerUnit );
+            if ( shouldStartNewUnit )
             {
-                m_context.LogError( "Invalid include path: %s", fullPath.c_str() );
-                return false;
+                auto& translationUnit = m_translationUnits.emplace_back();
+                translationUnit.m_pass = pass;
+                translationUnit.m_amalgamatedHeaderPath = m_reflectionDataPath + String( String::CtorSprintf(), "Reflector_%s_%u.h", pPassName, (uint32_t) includeStrings.size() );
+                includeStrings.emplace_back();
             }
-        }
 
-        clangArgs.push_back( "-x" );
-        clangArgs.push_back( "c++" );
-        clangArgs.push_back( "-std=c++17" );
-        clangArgs.push_back( "-O0" );
-        clangArgs.push_back( "-D NDEBUG" );
-        clangArgs.push_back( "-Werror" );
-        clangArgs.push_back( "-Wno-deprecated-builtins" );
-        clangArgs.push_back( "-fparse-all-comments" );
-        clangArgs.push_back( "-Wno-unknown-warning-option" );
-        clangArgs.push_back( "-Wno-return-type-c-linkage" );
-        clangArgs.push_back( "-Wno-gnu-folding-constant" );
-
-        // Exclude dev tools
-        if ( pass == NoDevToolsPass )
-        {
-            clangArgs.push_back( Settings::g_devToolsExclusionDefine );
+            m_translationUnits.back().m_headersToVisit.push_back( pHeader->m_ID );
+            includeStrings.back() += "#include \"" + pHeader->m_filePath.GetString() + "\"\n";
         }
 
+        // Create the amalgamated header files for each unit
         //-------------------------------------------------------------------------
 
-        // Set up clang
-        auto idx = clang_createIndex( 0, 1 );
-        uint32_t const clangOptions = CXTranslationUnit_DetailedPreprocessingRecord | CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_IncludeBriefCommentsInCodeCompletion;
-
-        // Parse Headers
-        CXTranslationUnit tu;
-        CXErrorCode result = CXError_Failure;
+        int32_t const firstUnitIdx = (int32_t) m_translationUnits.size() - (int32_t) includeStrings.size();
+        for ( int32_t i = 0; i < (int32_t) includeStrings.size(); i++ )
         {
-            ScopedTimer<PlatformClock> timer( m_totalParsingTime );
-            result = clang_parseTranslationUnit2( idx, reflectorHeader.c_str(), clangArgs.data(), clangArgs.size(), 0, 0, clangOptions, &tu );
+            FileSystem::Path const& amalgamatedHeaderPath = m_translationUnits[firstUnitIdx + i].m_amalgamatedHeaderPath;
+            amalgamatedHeaderPath.EnsureDirectoryExists();
+
+            std::ofstream reflectorFileStream;
+            reflectorFileStream.open( amalgamatedHeaderPath.c_str(), std::ios::out | std::ios::trunc );
+            if ( reflectorFileStream.fail() )
+            {
+                m_context.LogError( "Failed to create amalgamated header: %s", amalgamatedHeaderPath.c_str() );
+                return false;
+            }
+
+            reflectorFileStream.write( includeStrings[i].c_str(), includeStrings[i].size() );
+            reflectorFileStream.close();
         }
 
+        return true;
+    }
+
+    bool ClangParser::VisitParsedTranslationUnit( TranslationUnit& translationUnit )
+    {
         // Handle result of parse
-        if ( result == CXError_Success )
+        if ( translationUnit.m_result == CXError_Success )
         {
             ScopedTimer<PlatformClock> timer( m_totalVisitingTime );
-            m_context.Reset( &tu );
-            auto cursor = clang_getTranslationUnitCursor( tu );
+            m_context.m_detectDevOnlyTypesAndProperties = ( translationUnit.m_pass == NoDevToolsPass );
+            m_context.m_headersToVisit = translationUnit.m_headersToVisit;
+            m_context.Reset( &translationUnit.m_tu );
+            auto cursor = clang_getTranslationUnitCursor( translationUnit.m_tu );
             clang_visitChildren( cursor, VisitTranslationUnit, &m_context );
         }
         else
         {
-            switch ( result )
+            switch ( translationUnit.m_result )
             {
                 case CXError_Failure:
                 m_context.LogError( "Clang Unknown failure" );
@@ -126,16 +212,82 @@ namespace EE::TypeSystem::Reflection
                 break;
             }
         }
-        clang_disposeIndex( idx );
-
-        //-------------------------------------------------------------------------
 
         // If we have an error from the parser, pre-pend the header to it
         if ( m_context.ErrorOccured() )
         {
-            m_context.LogError( "%s --> %s", reflectorHeader.c_str(), m_context.GetErrorMessage() );
+            m_context.LogError( "%s --> %s", translationUnit.m_amalgamatedHeaderPath.c_str(), m_context.GetErrorMessage() );
         }
 
         return !m_context.ErrorOccured();
     }
+
+    void ClangParser::DestroyTranslationUnits()
+    {
+        for ( auto& translationUnit : m_translationUnits )
+        {
+            if ( translationUnit.m_tu != nullptr )
+            {
+                clang_disposeTranslationUnit( translationUnit.m_tu );
+            }
+
+            if ( translationUnit.m_index != nullptr )
+            {
+                clang_disposeIndex( translationUnit.m_index );
+            }
+        }
+
+        m_translationUnits.clear();
+        m_context.m_pTU = nullptr;
+    }
+
+    bool ClangParser::Parse( TaskSystem& taskSystem, TVector<HeaderInfo*> const& headers )
+    {
+        EE_ASSERT( taskSystem.IsInitialized() );
+        EE_ASSERT( m_translationUnits.empty() );
+
+        if ( !CreateClangArgs() )
+        {
+            return false;
+        }
+
+        // Create the translation units for both passes
+        //-------------------------------------------------------------------------
+        // Each pass is split into at most half the available workers so that both passes are parsed at the same time
+
+        int32_t const maxTranslationUnitsPerPass = Math::Clamp( (int32_t) taskSystem.GetNumWorkers() / 2, 1, Settings::g_maxTranslationUnitsPerPass );
+
+        if ( !CreateTranslationUnits( headers, DevToolsPass, maxTranslationUnitsPerPass ) || !CreateTranslationUnits( headers, NoDevToolsPass, maxTranslationUnitsPerPass ) )
+        {
+            DestroyTranslationUnits();
+            return false;
+        }
+
+        // Parse all units in parallel
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( m_totalParsingTime );
+            ParseTranslationUnitsTask parseTask( m_translationUnits, m_clangArgs );
+            taskSystem.ScheduleTask( &parseTask );
+            taskSystem.WaitForTask( &parseTask );
+        }
+
+        // Visit the units serially and in order
+        //-------------------------------------------------------------------------
+        // Visiting registers types in the database and the no dev tools pass only updates the flags of the types found by the dev tools pass
+
+        bool result = true;
+        for ( auto& translationUnit : m_translationUnits )
+        {
+            if ( !VisitParsedTranslationUnit( translationUnit ) )
+            {
+                result = false;
+                break;
+            }
+        }
+
+        DestroyTranslationUnits();
+        return result;
+    }
 }
\ No newline at end of file
@@ -5,6 +5,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::TypeSystem::Reflection
 {
     class ClangParser
@@ -17,6 +21,18 @@ namespace EE::TypeSystem::Reflection
             NoDevToolsPass
         };
 
+        // A single amalgamated header that is parsed into its own translation unit
+        // Each unit has its own clang index so that units can be parsed concurrently
+        struct TranslationUnit
+        {
+            Pass                            m_pass = DevToolsPass;
+            FileSystem::Path                m_amalgamatedHeaderPath;
+            TVector<HeaderID>               m_headersToVisit;
+            CXIndex                         m_index = nullptr;
+            CXTranslationUnit               m_tu = nullptr;
+            CXErrorCode                     m_result = CXError_Failure;
+        };
+
     public:
 
         ClangParser( SolutionInfo* pSolution, ReflectionDatabase* pDatabase, FileSystem::Path const& reflectionDataPath );
@@ -24,14 +40,26 @@ namespace EE::TypeSystem::Reflection
         inline Milliseconds GetParsingTime() const { return m_totalParsingTime; }
         inline Milliseconds GetVisitingTime() const { return m_totalVisitingTime; }
 
-        bool Parse( TVector<HeaderInfo*> const& headers, Pass pass );
+        // Parses the headers for both the dev tools and the no dev tools configurations
+        // All translation units are parsed in parallel and then visited in project dependency order (dev tools pass first)
+        bool Parse( TaskSystem& taskSystem, TVector<HeaderInfo*> const& headers );
         String GetErrorMessage() const { return m_context.GetErrorMessage(); }
 
+    private:
+
+        bool CreateClangArgs();
+        bool CreateTranslationUnits( TVector<HeaderInfo*> const& headers, Pass pass, int32_t maxTranslationUnits );
+        bool VisitParsedTranslationUnit( TranslationUnit& translationUnit );
+        void DestroyTranslationUnits();
+
     private:
 
         ClangParserContext                  m_context;
         Milliseconds                        m_totalParsingTime;
         Milliseconds                        m_totalVisitingTime;
         FileSystem::Path                    m_reflectionDataPath;
+        TVector<TranslationUnit>            m_translationUnits;
+        TVector<String>                     m_clangArgStrings;
+        TVector<char const*>                m_clangArgs[2];     // Per pass
     };
-}
+}
\ No newline at end of file
@@ -590,7 +590,7 @@ namespace EE::CPP
 
     static void GenerateLoadResourcesMethod( ReflectionDatabase const& database, std::stringstream& file, ReflectedType const& type )
     {
-        file << "            virtual void LoadResources( Resource::ResourceSystem* pResourceSystem, Resource::ResourceRequesterID const& requesterID, IRegisteredType* pType ) const override final\n";
+        file << "            virtual void LoadResources( Resource::ResourceSystem* pResourceSystem, Resource::ResourceRequesterID const& requesterID, IRegisteredType* pType, Resource::ResourcePriority priority ) const override final\n";
         file << "            {\n";
 
         if ( type.HasResourcePtrOrStructProperties() )
@@ -615,7 +615,7 @@ namespace EE::CPP
                             file << "                {\n";
                             file << "                    if ( resourcePtr.IsSet() )\n";
                             file << "                    {\n";
-                            file << "                        pResourceSystem->LoadResource( resourcePtr, requesterID );\n";
+                            file << "                        pResourceSystem->LoadResource( resourcePtr, requesterID, priority );\n";
                             file << "                    }\n";
                             file << "                }\n\n";
                         }
@@ -625,7 +625,7 @@ namespace EE::CPP
                             {
                                 file << "                if ( pActualType->" << propertyDesc.m_name.c_str() << "[" << i << "].IsSet() )\n";
                                 file << "                {\n";
-                                file << "                    pResourceSystem->LoadResource( pActualType->" << propertyDesc.m_name.c_str() << "[" << i << "], requesterID );\n";
+                                file << "                    pResourceSystem->LoadResource( pActualType->" << propertyDesc.m_name.c_str() << "[" << i << "], requesterID, priority );\n";
                                 file << "                }\n\n";
                             }
                         }
@@ -634,7 +634,7 @@ namespace EE::CPP
                     {
                         file << "                if ( pActualType->" << propertyDesc.m_name.c_str() << ".IsSet() )\n";
                         file << "                {\n";
-                        file << "                    pResourceSystem->LoadResource( pActualType->" << propertyDesc.m_name.c_str() << ", requesterID );\n";
+                        file << "                    pResourceSystem->LoadResource( pActualType->" << propertyDesc.m_name.c_str() << ", requesterID, priority );\n";
                         file << "                }\n\n";
                     }
                 }
@@ -646,20 +646,20 @@ namespace EE::CPP
                         {
                             file << "                for ( auto& propertyValue : pActualType->" << propertyDesc.m_name.c_str() << " )\n";
                             file << "                {\n";
-                            file << "                    " << propertyDesc.m_typeName.c_str() << "::s_pTypeInfo->LoadResources( pResourceSystem, requesterID, &propertyValue );\n";
+                            file << "                    " << propertyDesc.m_typeName.c_str() << "::s_pTypeInfo->LoadResources( pResourceSystem, requesterID, &propertyValue, priority );\n";
                             file << "                }\n\n";
                         }
                         else // Static array
                         {
                             for ( auto i = 0; i < propertyDesc.m_arraySize; i++ )
                             {
-                                file << "                " << propertyDesc.m_typeName.c_str() << "::s_pTypeInfo->LoadResources( pResourceSystem, requesterID, &pActualType->" << propertyDesc.m_name.c_str() << "[" << i << "] );\n\n";
+                                file << "                " << propertyDesc.m_typeName.c_str() << "::s_pTypeInfo->LoadResources( pResourceSystem, requesterID, &pActualType->" << propertyDesc.m_name.c_str() << "[" << i << "], priority );\n\n";
                             }
                         }
                     }
                     else
                     {
-                        file << "                " << propertyDesc.m_typeName.c_str() << "::s_pTypeInfo->LoadResources( pResourceSystem, requesterID, &pActualType->" << propertyDesc.m_name.c_str() << " );\n\n";
+                        file << "                " << propertyDesc.m_typeName.c_str() << "::s_pTypeInfo->LoadResources( pResourceSystem, requesterID, &pActualType->" << propertyDesc.m_name.c_str() << ", priority );\n\n";
                     }
                 }
 
@@ -1110,7 +1110,7 @@ namespace EE::CPP
 
         if ( type.HasProperties() )
         {
-            file << "            " << type.m_namespace.c_str() << type.m_name.c_str() << "::s_pTypeInfo->LoadResources( context.m_pResourceSystem, requesterID, this );\n";
+            file << "            " << type.m_namespace.c_str() << type.m_name.c_str() << "::s_pTypeInfo->LoadResources( context.m_pResourceSystem, requesterID, this, context.m_resourcePriority );\n";
             file << "            m_status = Status::Loading;\n";
         }
         else
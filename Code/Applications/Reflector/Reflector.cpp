@@ -8,6 +8,7 @@
 #include "System/FileSystem/FileSystemUtils.h"
 #include "System/Time/Timers.h"
 #include "System/Algorithm/TopologicalSort.h"
+#include "System/Algorithm/Hash.h"
 
 #include <eastl/sort.h>
 #include <fstream>
@@ -197,11 +198,17 @@ namespace EE::TypeSystem::Reflection
         return true;
     }
 
-    uint64_t Reflector::CalculateHeaderChecksum( FileSystem::Path const& engineIncludePath, FileSystem::Path const& filePath )
+    uint64_t Reflector::CalculateHeaderChecksum( FileSystem::Path const& filePath )
     {
-        static char const* headerString = "Note: including file: ";
-        uint64_t checksum = FileSystem::GetFileModifiedTime( filePath );
-        return checksum;
+        Blob fileData;
+        if ( !FileSystem::LoadFile( filePath, fileData ) )
+        {
+            return 0;
+        }
+
+        // Zero is reserved for failure
+        uint64_t const checksum = Hash::XXHash::GetHash64( fileData );
+        return ( checksum != 0 ) ? checksum : 1;
     }
 
     bool Reflector::ParseProject( FileSystem::Path const& prjPath )
@@ -614,14 +621,15 @@ namespace EE::TypeSystem::Reflection
                         {
                             EE_ASSERT( pExistingRecord->m_ID != 0 );
 
-                            // Check timestamp
-                            if ( header.m_timestamp > pExistingRecord->m_timestamp )
+                            // If the timestamp hasn't changed, we dont need to hash the file contents
+                            if ( header.m_timestamp == pExistingRecord->m_timestamp && pExistingRecord->m_checksum != 0 )
                             {
-                                isDirty = true;
+                                header.m_checksum = pExistingRecord->m_checksum;
                             }
                             else
                             {
-                                header.m_checksum = CalculateHeaderChecksum( m_solution.m_path, header.m_filePath );
+                                // Only the file contents determine whether a header is dirty, touching a file (e.g. switching branches) shouldn't require re-reflection
+                                header.m_checksum = CalculateHeaderChecksum( header.m_filePath );
                                 if ( header.m_checksum == 0 )
                                 {
                                     return LogError( "Failed to perform up to date check for: %s", header.m_filePath.c_str() );
@@ -630,6 +638,11 @@ namespace EE::TypeSystem::Reflection
                                 {
                                     isDirty = true;
                                 }
+                                else
+                                {
+                                    // Record the new timestamp so we can skip hashing this file next time
+                                    m_database.UpdateHeaderRecord( header );
+                                }
                             }
                         }
                         else
@@ -641,6 +654,15 @@ namespace EE::TypeSystem::Reflection
                     // Update file checksum if file is dirty
                     if ( isDirty )
                     {
+                        if ( header.m_checksum == 0 )
+                        {
+                            header.m_checksum = CalculateHeaderChecksum( header.m_filePath );
+                            if ( header.m_checksum == 0 )
+                            {
+                                return LogError( "Failed to perform up to date check for: %s", header.m_filePath.c_str() );
+                            }
+                        }
+
                         m_database.UpdateHeaderRecord( header );
                         prj.m_dirtyHeaders.push_back( i );
                     }
@@ -697,29 +719,22 @@ namespace EE::TypeSystem::Reflection
 
         if ( !headersToParse.empty() )
         {
-            std::cout << " * Reflecting C++ Code - First Pass (With Dev Tools) - ";
+            std::cout << " * Reflecting C++ Code - " << headersToParse.size() << " header(s) - ";
 
-            // Parse headers
+            // Parse headers for both the dev tools and no dev tools configurations
+            m_taskSystem.Initialize();
             ClangParser clangParser( &m_solution, &m_database, m_reflectionDataPath );
-            if ( !clangParser.Parse( headersToParse, ClangParser::DevToolsPass ) )
-            {
-                std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
-                return false;
-            }
-            Milliseconds clangParsingTime = clangParser.GetParsingTime();
-            Milliseconds clangVisitingTime = clangParser.GetVisitingTime();
-            std::cout << "Complete! ( P:" << (float) clangParsingTime << "ms, V:" << (float) clangVisitingTime << "ms )" << std::endl;
+            bool const parseSucceeded = clangParser.Parse( m_taskSystem, headersToParse );
+            m_taskSystem.Shutdown();
 
-            std::cout << " * Reflecting C++ Code - Second Pass (No Dev Tools) - ";
-
-            // Second parse to detect dev-only types
-            if ( !clangParser.Parse( headersToParse, ClangParser::NoDevToolsPass ) )
+            if ( !parseSucceeded )
             {
                 std::cout << "Error occurred!\n\n  Error: " << clangParser.GetErrorMessage().c_str() << std::endl;
                 return false;
             }
-            clangParsingTime = clangParser.GetParsingTime();
-            clangVisitingTime = clangParser.GetVisitingTime();
+
+            Milliseconds const clangParsingTime = clangParser.GetParsingTime();
+            Milliseconds const clangVisitingTime = clangParser.GetVisitingTime();
             std::cout << "Complete! ( P:" << (float) clangParsingTime << "ms, V:" << (float) clangVisitingTime << "ms )" << std::endl;
 
             // Finalize database data
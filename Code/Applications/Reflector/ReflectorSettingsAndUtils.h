@@ -90,6 +90,11 @@ namespace EE::TypeSystem::Reflection
             "External\\NavPower\\include\\"
             #endif
         };
+
+        // Each pass is split into multiple translation units (on project boundaries) that are parsed in parallel
+        // Every unit needs to parse all its includes so there is no point in creating units for only a handful of headers
+        constexpr static int32_t const g_minHeadersPerTranslationUnit = 32;
+        constexpr static int32_t const g_maxTranslationUnitsPerPass = 4;
     }
 
     //-------------------------------------------------------------------------
@@ -1,9 +1,14 @@
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompilerRegistry.h"
+#include "EngineTools/Resource/ResourceCompilerWorkerMessages.h"
 #include "System/Application/ApplicationGlobalState.h"
 #include "System/ThirdParty/cmdParser/cmdParser.h"
 #include "System/Resource/ResourceSettings.h"
+#include "System/Resource/ResourceCompression.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "System/FileSystem/FileStreams.h"
+#include "System/Network/IPC/IPCMessageClient.h"
+#include "System/Threading/Threading.h"
 #include "System/IniFile.h"
 #include "System/Log.h"
 
@@ -29,12 +34,21 @@ namespace EE
             cmdParser.set_optional<std::string>( "compile", "compile", "", "Compile resource" );
             cmdParser.set_optional<bool>( "debug", "debug", false, "Trigger debug break before execution." );
             cmdParser.set_optional<bool>( "package", "package", false, "Compile resource for packaged build." );
+            cmdParser.set_optional<int>( "worker", "worker", InvalidIndex, "Run as a persistent compiler worker for the resource server." );
 
             if ( cmdParser.run() )
             {
                 m_triggerDebugBreak = cmdParser.get<bool>( "debug" );
                 m_isForPackagedBuild = cmdParser.get<bool>( "package" );
 
+                // Worker mode, compile requests are received from the resource server
+                m_workerIdx = cmdParser.get<int>( "worker" );
+                if ( m_workerIdx != InvalidIndex )
+                {
+                    m_isValid = m_workerIdx >= 0;
+                    return;
+                }
+
                 // Get compile argument
                 ResourcePath const resourcePath( cmdParser.get<std::string>( "compile" ).c_str() );
                 if ( resourcePath.IsValid() )
@@ -56,16 +70,224 @@ namespace EE
         }
 
         bool IsValid() const { return m_isValid; }
+        bool IsWorker() const { return m_workerIdx != InvalidIndex; }
 
     public:
 
         ResourceID          m_resourceID;
+        int32_t             m_workerIdx = InvalidIndex;
         bool                m_triggerDebugBreak = false;
         bool                m_isForPackagedBuild = false;
         bool                m_isValid = false;
     };
 }
 
+//-------------------------------------------------------------------------
+// Compression
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // Block compress a compiled resource in place, resources that dont benefit from compression are left as is
+    static bool CompressCompiledResource( FileSystem::Path const& compiledResourcePath, uint32_t blockSize )
+    {
+        Blob compiledData;
+        if ( !FileSystem::LoadFile( compiledResourcePath, compiledData ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to read compiled resource for compression: %s", compiledResourcePath.c_str() );
+            return false;
+        }
+
+        if ( compiledData.empty() || Resource::ResourceCompression::IsCompressed( compiledData.data(), compiledData.size() ) )
+        {
+            return true;
+        }
+
+        Blob compressedData;
+        if ( !Resource::ResourceCompression::Compress( compiledData.data(), compiledData.size(), blockSize, compressedData ) )
+        {
+            return true;
+        }
+
+        FileSystem::OutputFileStream outputFile( compiledResourcePath );
+        if ( !outputFile.IsValid() )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Failed to write compressed resource: %s", compiledResourcePath.c_str() );
+            return false;
+        }
+
+        outputFile.Write( compressedData.data(), compressedData.size() );
+        outputFile.Close();
+        return true;
+    }
+}
+
+//-------------------------------------------------------------------------
+// Compilation
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    static int32_t CompileResource( Resource::ResourceSettings const& settings, Resource::CompilerRegistry const& compilerRegistry, ResourceID const& resourceID, bool isForPackagedBuild )
+    {
+        FileSystem::Path const& compiledResourcePath = isForPackagedBuild ? settings.m_packagedBuildCompiledResourcePath : settings.m_compiledResourcePath;
+
+        // Try create compilation context
+        Resource::CompileContext compileContext( settings.m_rawResourcePath, compiledResourcePath, resourceID, isForPackagedBuild );
+        if ( !compileContext.IsValid() )
+        {
+            return -1;
+        }
+
+        // Try find compiler
+        auto pCompiler = compilerRegistry.GetCompilerForResourceType( compileContext.m_resourceID.GetResourceTypeID() );
+        if ( pCompiler == nullptr )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", compileContext.m_resourceID.GetResourceTypeID() );
+            return -1;
+        }
+
+        // Validate input path
+        if ( pCompiler->IsInputFileRequired() && !FileSystem::Exists( compileContext.m_inputFilePath ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", settings.m_rawResourcePath.c_str(), compileContext.m_inputFilePath.c_str() );
+            return -1;
+        }
+
+        // Compile
+        Resource::CompilationResult const result = pCompiler->Compile( compileContext );
+
+        // Compress
+        if ( result != Resource::CompilationResult::Failure && settings.ShouldCompressResourceType( compileContext.m_resourceID.GetResourceTypeID() ) )
+        {
+            if ( !CompressCompiledResource( compileContext.m_outputFilePath, settings.m_compressionBlockSize ) )
+            {
+                return (int32_t) Resource::CompilationResult::Failure;
+            }
+        }
+
+        return (int32_t) result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Run as a persistent worker, compile requests are received from the resource server and the results (and compilation log) are sent back
+    // The worker keeps running until the server asks it to shutdown or the connection to the server is lost
+    static int32_t RunCompilerWorker( Resource::ResourceSettings const& settings, Resource::CompilerRegistry const& compilerRegistry, int32_t workerIdx )
+    {
+        // The log is sent back with each result, so discard the console output to prevent the server side pipes from filling up and blocking the worker
+        freopen( "NUL", "w", stdout );
+        freopen( "NUL", "w", stderr );
+
+        if ( !Network::NetworkSystem::Initialize() )
+        {
+            return 1;
+        }
+
+        Network::IPC::Client networkClient;
+        String const address( String::CtorSprintf(), "%s:%u", settings.m_resourceServerNetworkAddress.c_str(), settings.m_compilerWorkerPort );
+        if ( !Network::NetworkSystem::StartClientConnection( &networkClient, address.c_str() ) )
+        {
+            Network::NetworkSystem::Shutdown();
+            return 1;
+        }
+
+        //-------------------------------------------------------------------------
+
+        static char const* const severityLabels[] = { "Message", "Warning", "Error", "Fatal Error" };
+
+        TVector<Resource::CompilerWorkerRequest> compileRequests;
+        bool isReady = false;
+        bool shouldExit = false;
+
+        while ( !shouldExit )
+        {
+            Network::NetworkSystem::Update();
+
+            if ( networkClient.HasConnectionFailed() )
+            {
+                break;
+            }
+
+            // Wait for connection, the server assigns a new connection ID on reconnection so we need to re-announce ourselves
+            if ( !networkClient.IsConnected() )
+            {
+                isReady = false;
+                Threading::Sleep( 1 );
+                continue;
+            }
+
+            if ( !isReady )
+            {
+                networkClient.SendMessageToServer( Network::IPC::Message( (int32_t) Resource::CompilerWorkerMessageID::WorkerReady, Resource::CompilerWorkerReady( workerIdx ) ) );
+                isReady = true;
+            }
+
+            // Receive requests
+            //-------------------------------------------------------------------------
+
+            auto ProcessIncomingMessages = [&] ( Network::IPC::Message const& message )
+            {
+                if ( message.GetMessageID() == (int32_t) Resource::CompilerWorkerMessageID::CompileRequest )
+                {
+                    compileRequests.emplace_back( message.GetData<Resource::CompilerWorkerRequest>() );
+                }
+                else if ( message.GetMessageID() == (int32_t) Resource::CompilerWorkerMessageID::Shutdown )
+                {
+                    shouldExit = true;
+                }
+            };
+
+            networkClient.ProcessIncomingMessages( ProcessIncomingMessages );
+
+            // Compile
+            //-------------------------------------------------------------------------
+
+            for ( auto const& request : compileRequests )
+            {
+                size_t const firstLogEntryIdx = Log::GetLogEntries().size();
+
+                Resource::CompilerWorkerResult result;
+                result.m_resourceID = request.m_resourceID;
+                result.m_result = CompileResource( settings, compilerRegistry, request.m_resourceID, request.m_isForPackagedBuild );
+
+                // Return all the log entries emitted during this compilation
+                auto const& logEntries = Log::GetLogEntries();
+                for ( size_t i = firstLogEntryIdx; i < logEntries.size(); i++ )
+                {
+                    auto const& entry = logEntries[i];
+                    result.m_log.append_sprintf( "[%s][%s][%s] %s\n", entry.m_timestamp.c_str(), severityLabels[(int32_t) entry.m_severity], entry.m_category.c_str(), entry.m_message.c_str() );
+                }
+
+                // We dont display these, and the worker is long lived so we dont keep entries around once they have been returned
+                Log::GetUnhandledWarningsAndErrors();
+                Log::ClearLogEntries();
+
+                networkClient.SendMessageToServer( Network::IPC::Message( (int32_t) Resource::CompilerWorkerMessageID::CompileResult, eastl::move( result ) ) );
+            }
+
+            if ( compileRequests.empty() )
+            {
+                Threading::Sleep( 1 );
+            }
+
+            compileRequests.clear();
+        }
+
+        // Flush any outstanding results before disconnecting
+        Network::NetworkSystem::Update();
+
+        if ( !networkClient.IsDisconnected() )
+        {
+            Network::NetworkSystem::StopClientConnection( &networkClient );
+        }
+
+        Network::NetworkSystem::Shutdown();
+
+        return 0;
+    }
+}
+
 //-------------------------------------------------------------------------
 // Application Entry Point
 //-------------------------------------------------------------------------
@@ -111,14 +333,14 @@ int main( int argc, char* argv[] )
     // File Paths
     //-------------------------------------------------------------------------
 
-    if ( argParser.m_isForPackagedBuild )
-    {
-        settings.m_compiledResourcePath = settings.m_packagedBuildCompiledResourcePath;
-    }
-
     settings.m_rawResourcePath.EnsureDirectoryExists();
     settings.m_compiledResourcePath.EnsureDirectoryExists();
 
+    if ( argParser.m_isForPackagedBuild || argParser.IsWorker() )
+    {
+        settings.m_packagedBuildCompiledResourcePath.EnsureDirectoryExists();
+    }
+
     // Create tools modules and register compilers
     //-------------------------------------------------------------------------
 
@@ -137,36 +359,15 @@ int main( int argc, char* argv[] )
         EE_HALT();
     }
 
-    auto CompileResource = [&] ()
+    int32_t result = 0;
+    if ( argParser.IsWorker() )
     {
-        // Try create compilation context
-        Resource::CompileContext compileContext( settings.m_rawResourcePath, settings.m_compiledResourcePath, argParser.m_resourceID, argParser.m_isForPackagedBuild );
-        if ( !compileContext.IsValid() )
-        {
-            return -1;
-        }
-
-        // Try find compiler
-        auto pCompiler = compilerRegistry.GetCompilerForResourceType( compileContext.m_resourceID.GetResourceTypeID() );
-        if ( pCompiler == nullptr )
-        {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Cant find appropriate resource compiler for type: %u", compileContext.m_resourceID.GetResourceTypeID() );
-            return -1;
-        }
-
-        // Validate input path
-        if ( pCompiler->IsInputFileRequired() && !FileSystem::Exists( compileContext.m_inputFilePath ) )
-        {
-            EE_LOG_ERROR( "Resource", "Resource Compiler", "Source file for data path ('%s') does not exist: '%s'\n", settings.m_rawResourcePath.c_str(), compileContext.m_inputFilePath.c_str() );
-            return -1;
-        }
-
-        // Compile
-        Resource::CompilationResult const result = pCompiler->Compile( compileContext );
-        return (int32_t) result;
-    };
-
-    int32_t const result = CompileResource();
+        result = RunCompilerWorker( settings, compilerRegistry, argParser.m_workerIdx );
+    }
+    else
+    {
+        result = CompileResource( settings, compilerRegistry, argParser.m_resourceID, argParser.m_isForPackagedBuild );
+    }
 
     // Unregister all types
     //-------------------------------------------------------------------------
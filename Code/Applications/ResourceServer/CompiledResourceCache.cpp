@@ -0,0 +1,85 @@
+#include "CompiledResourceCache.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/Log.h"
+#include <filesystem>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    uint64_t CompiledResourceCache::CalculateKey( ResourceID const& resourceID, uint64_t sourceHash, bool isForPackagedBuild, uint32_t compressionBlockSize )
+    {
+        // The resource path is included since compiled data can reference the resource's own path
+        uint64_t const keyInputs[4] = { Hash::XXHash::GetHash64( resourceID.GetResourcePath().GetString() ), sourceHash, isForPackagedBuild ? 1ull : 0ull, compressionBlockSize };
+        return Hash::XXHash::GetHash64( keyInputs, sizeof( keyInputs ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompiledResourceCache::Initialize( FileSystem::Path const& cachePath )
+    {
+        EE_ASSERT( cachePath.IsValid() && cachePath.IsDirectoryPath() );
+
+        if ( !cachePath.EnsureDirectoryExists() )
+        {
+            EE_LOG_ERROR( "Resource", "Compiled Resource Cache", "Failed to create compiled resource cache directory: %s", cachePath.c_str() );
+            return false;
+        }
+
+        m_cachePath = cachePath;
+        return true;
+    }
+
+    FileSystem::Path CompiledResourceCache::GetCacheFilePath( uint64_t key, ResourceID const& resourceID ) const
+    {
+        // Split into sub-directories based on the first byte of the key to keep directory sizes reasonable
+        InlineString const relativePath( InlineString::CtorSprintf(), "%02llx/%016llx.%s", key >> 56, key, resourceID.GetResourceTypeID().ToString().c_str() );
+        return m_cachePath + relativePath.c_str();
+    }
+
+    bool CompiledResourceCache::TryRestore( uint64_t key, ResourceID const& resourceID, FileSystem::Path const& destinationPath ) const
+    {
+        EE_ASSERT( IsEnabled() );
+
+        FileSystem::Path const cacheFilePath = GetCacheFilePath( key, resourceID );
+        if ( !FileSystem::Exists( cacheFilePath ) )
+        {
+            return false;
+        }
+
+        std::error_code ec;
+        std::filesystem::copy_file( cacheFilePath.c_str(), destinationPath.c_str(), std::filesystem::copy_options::overwrite_existing, ec );
+        return !ec;
+    }
+
+    bool CompiledResourceCache::Store( uint64_t key, ResourceID const& resourceID, FileSystem::Path const& compiledFilePath ) const
+    {
+        EE_ASSERT( IsEnabled() );
+
+        FileSystem::Path const cacheFilePath = GetCacheFilePath( key, resourceID );
+        if ( !cacheFilePath.EnsureDirectoryExists() )
+        {
+            return false;
+        }
+
+        // Copy to a temporary file and then move it into place so that concurrent restores never see a partially written file
+        InlineString const tempFileSuffix( InlineString::CtorSprintf(), ".%u.tmp", m_tempFileCounter++ );
+        FileSystem::Path const tempFilePath = cacheFilePath + tempFileSuffix.c_str();
+
+        std::error_code ec;
+        std::filesystem::copy_file( compiledFilePath.c_str(), tempFilePath.c_str(), std::filesystem::copy_options::overwrite_existing, ec );
+        if ( ec )
+        {
+            return false;
+        }
+
+        std::filesystem::rename( tempFilePath.c_str(), cacheFilePath.c_str(), ec );
+        if ( ec )
+        {
+            FileSystem::EraseFile( tempFilePath );
+            return false;
+        }
+
+        return true;
+    }
+}
\ No newline at end of file
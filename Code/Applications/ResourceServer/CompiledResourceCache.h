@@ -0,0 +1,44 @@
+#pragma once
+
+#include "System/Resource/ResourceID.h"
+#include "System/FileSystem/FileSystemPath.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+// Compiled Resource Cache
+//-------------------------------------------------------------------------
+// A content addressed store of compiled resources
+// Results are keyed on a digest of all the compilation inputs so previous results can be restored instead of recompiled (e.g. when switching branches)
+// The cache is never pruned automatically, it is safe to delete the cache directory at any time
+
+namespace EE::Resource
+{
+    class CompiledResourceCache
+    {
+    public:
+
+        // Calculate the cache key for a compilation, the source hash is the combined hash from the compile dependency tree
+        static uint64_t CalculateKey( ResourceID const& resourceID, uint64_t sourceHash, bool isForPackagedBuild, uint32_t compressionBlockSize );
+
+    public:
+
+        bool Initialize( FileSystem::Path const& cachePath );
+
+        inline bool IsEnabled() const { return m_cachePath.IsValid(); }
+
+        // Copy a cached result to the destination path, returns false if there is no cached result
+        bool TryRestore( uint64_t key, ResourceID const& resourceID, FileSystem::Path const& destinationPath ) const;
+
+        // Add a compiled resource to the cache
+        bool Store( uint64_t key, ResourceID const& resourceID, FileSystem::Path const& compiledFilePath ) const;
+
+    private:
+
+        FileSystem::Path GetCacheFilePath( uint64_t key, ResourceID const& resourceID ) const;
+
+    private:
+
+        FileSystem::Path                        m_cachePath;
+        mutable std::atomic<uint32_t>           m_tempFileCounter = 0;
+    };
+}
\ No newline at end of file
@@ -48,7 +48,18 @@ namespace EE
         {
             EE_ASSERT( m_pDatabase != nullptr );
 
-            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceTimestampHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );" ) )
+            // Older databases stored timestamp based hashes, these records are useless to us so just drop the table
+            sqlite3_stmt* pStatement = nullptr;
+            if ( sqlite3_prepare_v2( m_pDatabase, "SELECT `SourceHash` FROM `CompiledResources` LIMIT 0;", -1, &pStatement, nullptr ) != SQLITE_OK )
+            {
+                if ( !DropTables() )
+                {
+                    return false;
+                }
+            }
+            sqlite3_finalize( pStatement );
+
+            if ( !ExecuteSimpleQuery( "CREATE TABLE IF NOT EXISTS `CompiledResources` ( `ResourcePath` TEXT UNIQUE,`ResourceType` INTEGER,`CompilerVersion` INTEGER,`FileTimestamp` INTEGER, `SourceHash` INTEGER, PRIMARY KEY( ResourcePath, ResourceType ) );" ) )
             {
                 return false;
             }
@@ -92,7 +103,7 @@ namespace EE
 
                     record.m_compilerVersion = sqlite3_column_int( pStatement, 2 );
                     record.m_fileTimestamp = sqlite3_column_int64( pStatement, 3 );
-                    record.m_sourceTimestampHash = sqlite3_column_int64( pStatement, 4 );
+                    record.m_sourceHash = sqlite3_column_int64( pStatement, 4 );
                 }
 
                 IsValidSQLiteResult( sqlite3_finalize( pStatement ) );
@@ -105,7 +116,7 @@ namespace EE
         {
             Threading::ScopeLock const lock( m_mutex );
 
-            return ExecuteSimpleQuery( "INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceTimestampHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu );", record.m_resourceID.GetResourcePath().c_str(), (uint32_t) record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceTimestampHash  );
+            return ExecuteSimpleQuery( "INSERT OR REPLACE INTO `CompiledResources` ( `ResourcePath`, `ResourceType`, `CompilerVersion`, `FileTimestamp`, `SourceHash` ) VALUES ( \"%s\", %d, %d, %llu, %llu );", record.m_resourceID.GetResourcePath().c_str(), (uint32_t) record.m_resourceID.GetResourceTypeID(), record.m_compilerVersion, record.m_fileTimestamp, record.m_sourceHash  );
         }
     }
 }
\ No newline at end of file
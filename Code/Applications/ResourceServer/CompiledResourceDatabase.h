@@ -19,7 +19,7 @@ namespace EE
             ResourceID            m_resourceID;
             int32_t               m_compilerVersion = -1;         // The compiler version used for the last compilation
             uint64_t              m_fileTimestamp = 0;            // The timestamp of the resource file
-            uint64_t              m_sourceTimestampHash = 0;      // The timestamp hash of any source assets used in the compilation
+            uint64_t              m_sourceHash = 0;               // The content hash of the resource file, the compiler version and all the compile dependencies
         };
 
         //-------------------------------------------------------------------------
@@ -22,6 +22,7 @@ namespace EE::Resource
             Succeeded,
             SucceededWithWarnings,
             SucceededUpToDate,
+            SucceededFromCache,
             Failed
         };
 
@@ -52,7 +53,7 @@ namespace EE::Resource
         inline Status GetStatus() const { return m_status; }
         inline bool IsPending() const { return m_status == Status::Pending; }
         inline bool IsExecuting() const { return m_status == Status::Compiling; }
-        inline bool HasSucceeded() const { return m_status == Status::Succeeded || m_status == Status::SucceededWithWarnings || m_status == Status::SucceededUpToDate; }
+        inline bool HasSucceeded() const { return m_status == Status::Succeeded || m_status == Status::SucceededWithWarnings || m_status == Status::SucceededUpToDate || m_status == Status::SucceededFromCache; }
         inline bool HasFailed() const { return m_status == Status::Failed; }
         inline bool IsComplete() const { return HasSucceeded() || HasFailed(); }
 
@@ -95,7 +96,7 @@ namespace EE::Resource
         ResourceID                          m_resourceID;
         int32_t                             m_compilerVersion = -1;
         uint64_t                            m_fileTimestamp = 0;
-        uint64_t                            m_sourceTimestampHash = 0;
+        uint64_t                            m_sourceHash = 0;
         FileSystem::Path                    m_sourceFile;
         FileSystem::Path                    m_destinationFile;
         String                              m_compilerArgs;
@@ -106,6 +107,11 @@ namespace EE::Resource
         Nanoseconds                         m_upToDateCheckTimeStarted = 0;
         Nanoseconds                         m_upToDateCheckTimeFinished = 0;
 
+        // Compression info for the compiled resource, only set for compressed resource types
+        uint64_t                            m_compiledFileSize = 0;
+        uint64_t                            m_uncompressedSize = 0;
+        Milliseconds                        m_decompressionTime = 0;
+
         String                              m_log;
         Status                              m_status = Status::Pending;
         Origin                              m_origin = Origin::External;
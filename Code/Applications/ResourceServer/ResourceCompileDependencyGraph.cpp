@@ -0,0 +1,464 @@
+#include "ResourceCompileDependencyGraph.h"
+#include "EngineTools/Resource/ResourceDescriptor.h"
+#include "ResourceServerContext.h"
+#include "System/FileSystem/FileSystem.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    class CompilerRegistry;
+
+    //-------------------------------------------------------------------------
+
+    bool ShouldCheckCompileDependenciesForResourceType( ResourceID const& resourceID )
+    {
+        if ( resourceID.GetResourceTypeID() == ResourceTypeID( "map" ) )
+        {
+            return false;
+        }
+
+        if ( resourceID.GetResourceTypeID() == ResourceTypeID( "nav" ) )
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    uint64_t SourceFileHashCache::GetFileHash( FileSystem::Path const& filePath, uint64_t modifiedTime )
+    {
+        {
+            Threading::ScopeLock lock( m_mutex );
+            auto foundIter = m_entries.find( filePath );
+            if ( foundIter != m_entries.end() && foundIter->second.m_modifiedTime == modifiedTime )
+            {
+                return foundIter->second.m_hash;
+            }
+        }
+
+        // Hash outside of the lock, multiple threads might hash the same file but they will produce the same result
+        Blob fileData;
+        if ( !FileSystem::LoadFile( filePath, fileData ) )
+        {
+            return 0;
+        }
+
+        Entry entry;
+        entry.m_modifiedTime = modifiedTime;
+        entry.m_hash = Hash::XXHash::GetHash64( fileData.data(), fileData.size() );
+
+        {
+            Threading::ScopeLock lock( m_mutex );
+            m_entries[filePath] = entry;
+        }
+
+        return entry.m_hash;
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompileDependencyGraph::CompileDependencyGraph( ResourceServerContext const& context )
+        : m_context( context )
+    {}
+
+    CompileDependencyGraph::~CompileDependencyGraph()
+    {
+        for ( auto& nodePair : m_nodes )
+        {
+            EE::Delete( nodePair.second );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    CompileDependencyGraph::Node* CompileDependencyGraph::FindOrCreateNode( ResourceID const& resourceID )
+    {
+        auto foundIter = m_nodes.find( resourceID );
+        if ( foundIter != m_nodes.end() )
+        {
+            return foundIter->second;
+        }
+
+        Node* pNode = EE::New<Node>();
+        pNode->m_ID = resourceID;
+        m_nodes.insert( TPair<ResourceID, Node*>( resourceID, pNode ) );
+        return pNode;
+    }
+
+    void CompileDependencyGraph::InvalidateSourceInfo( Node* pNode )
+    {
+        EE_ASSERT( pNode != nullptr );
+        pNode->m_isSourceInfoValid = false;
+        pNode->m_invalidationCount++;
+        InvalidateDerivedState( pNode );
+    }
+
+    void CompileDependencyGraph::InvalidateDerivedState( Node* pNode )
+    {
+        EE_ASSERT( pNode != nullptr );
+
+        TInlineVector<Node*, 32> nodesToInvalidate;
+        nodesToInvalidate.emplace_back( pNode );
+
+        while ( !nodesToInvalidate.empty() )
+        {
+            Node* pNodeToInvalidate = nodesToInvalidate.back();
+            nodesToInvalidate.pop_back();
+
+            // Nodes that were already invalid have already invalidated their dependents
+            if ( !pNodeToInvalidate->m_isDerivedStateValid && pNodeToInvalidate != pNode )
+            {
+                continue;
+            }
+
+            pNodeToInvalidate->m_isDerivedStateValid = false;
+
+            for ( auto const& dependentID : pNodeToInvalidate->m_dependents )
+            {
+                auto foundIter = m_nodes.find( dependentID );
+                EE_ASSERT( foundIter != m_nodes.end() );
+                nodesToInvalidate.emplace_back( foundIter->second );
+            }
+        }
+    }
+
+    void CompileDependencyGraph::InvalidateSourceFile( FileSystem::Path const& filePath )
+    {
+        ResourcePath const resourcePath = ResourcePath::FromFileSystemPath( m_context.m_rawResourcePath, filePath );
+        if ( !resourcePath.IsValid() )
+        {
+            return;
+        }
+
+        ResourceID const resourceID( resourcePath );
+        if ( !resourceID.IsValid() )
+        {
+            return;
+        }
+
+        Threading::ScopeLock lock( m_mutex );
+        auto foundIter = m_nodes.find( resourceID );
+        if ( foundIter != m_nodes.end() )
+        {
+            InvalidateSourceInfo( foundIter->second );
+        }
+    }
+
+    void CompileDependencyGraph::InvalidateAll()
+    {
+        Threading::ScopeLock lock( m_mutex );
+        for ( auto& nodePair : m_nodes )
+        {
+            nodePair.second->m_isSourceInfoValid = false;
+            nodePair.second->m_isDerivedStateValid = false;
+            nodePair.second->m_invalidationCount++;
+        }
+    }
+
+    void CompileDependencyGraph::OnResourceCompiled( CompiledResourceRecord const& record )
+    {
+        Threading::ScopeLock lock( m_mutex );
+        auto foundIter = m_nodes.find( record.m_resourceID );
+        if ( foundIter != m_nodes.end() )
+        {
+            foundIter->second->m_compiledRecord = record;
+            foundIter->second->m_targetExists = true;
+            InvalidateDerivedState( foundIter->second );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompileDependencyGraph::TryReadCompileDependencies( FileSystem::Path const& resourceFilePath, TVector<ResourceID>& outDependencies ) const
+    {
+        EE_ASSERT( resourceFilePath.IsValid() );
+
+        auto pDescriptor = ResourceDescriptor::TryReadFromFile( *m_context.m_pTypeRegistry, resourceFilePath );
+        if ( pDescriptor == nullptr )
+        {
+            return false;
+        }
+        
+        pDescriptor->GetCompileDependencies( outDependencies );
+
+        EE::Delete( pDescriptor );
+
+        return true;
+    }
+
+    void CompileDependencyGraph::CollectNodesToRefresh( Node* pRootNode, TVector<SourceInfo>& outNodesToRefresh )
+    {
+        uint32_t const visitID = ++m_visitID;
+
+        TInlineVector<Node*, 32> nodesToVisit;
+        nodesToVisit.emplace_back( pRootNode );
+        pRootNode->m_visitID = visitID;
+
+        while ( !nodesToVisit.empty() )
+        {
+            Node* pNode = nodesToVisit.back();
+            nodesToVisit.pop_back();
+
+            // We dont know the dependencies of an invalid node, so we stop here and continue once it has been refreshed
+            if ( !pNode->m_isSourceInfoValid )
+            {
+                auto& sourceInfo = outNodesToRefresh.emplace_back();
+                sourceInfo.m_ID = pNode->m_ID;
+                sourceInfo.m_invalidationCount = pNode->m_invalidationCount;
+                continue;
+            }
+
+            for ( auto const& dependencyID : pNode->m_dependencies )
+            {
+                Node* pDependencyNode = FindOrCreateNode( dependencyID );
+                if ( pDependencyNode->m_visitID != visitID )
+                {
+                    pDependencyNode->m_visitID = visitID;
+                    nodesToVisit.emplace_back( pDependencyNode );
+                }
+            }
+        }
+    }
+
+    void CompileDependencyGraph::ReadSourceInfo( SourceInfo& sourceInfo ) const
+    {
+        ResourceID const& resourceID = sourceInfo.m_ID;
+
+        // Basic resource info
+        //-------------------------------------------------------------------------
+
+        FileSystem::Path const sourcePath = ResourcePath::ToFileSystemPath( m_context.m_rawResourcePath, resourceID.GetResourcePath() );
+        sourceInfo.m_sourceExists = FileSystem::Exists( sourcePath );
+        sourceInfo.m_timestamp = sourceInfo.m_sourceExists ? FileSystem::GetFileModifiedTime( sourcePath ) : 0;
+        sourceInfo.m_contentHash = sourceInfo.m_sourceExists ? m_context.m_pSourceFileHashCache->GetFileHash( sourcePath, sourceInfo.m_timestamp ) : 0;
+
+        // Handle compilable resources
+        //-------------------------------------------------------------------------
+
+        auto pCompiler = m_context.m_pCompilerRegistry->GetCompilerForResourceType( resourceID.GetResourceTypeID() );
+        bool const isCompilableResource = pCompiler != nullptr;
+        bool skipDependencyCheck = !isCompilableResource || !ShouldCheckCompileDependenciesForResourceType( resourceID );
+        if ( isCompilableResource )
+        {
+            FileSystem::Path const targetPath = ResourcePath::ToFileSystemPath( m_context.m_compiledResourcePath, resourceID.GetResourcePath() );
+            sourceInfo.m_targetExists = FileSystem::Exists( targetPath );
+
+            sourceInfo.m_compilerVersion = pCompiler->GetVersion();
+            sourceInfo.m_compiledRecord = m_context.m_pCompiledResourceDB->GetRecord( resourceID );
+
+            // Some compilers dont require an input file to run - these resources should always be recompiled!
+            if ( !sourceInfo.m_sourceExists && !pCompiler->IsInputFileRequired() )
+            {
+                sourceInfo.m_forceRecompile = true;
+                skipDependencyCheck = true;
+            }
+        }
+
+        // Read dependencies
+        //-------------------------------------------------------------------------
+
+        if ( !skipDependencyCheck )
+        {
+            if ( TryReadCompileDependencies( sourcePath, sourceInfo.m_dependencies ) )
+            {
+                // Remove duplicates, we only need a single edge per dependency
+                for ( int32_t i = (int32_t) sourceInfo.m_dependencies.size() - 1; i > 0; i-- )
+                {
+                    auto endIter = sourceInfo.m_dependencies.begin() + i;
+                    if ( eastl::find( sourceInfo.m_dependencies.begin(), endIter, sourceInfo.m_dependencies[i] ) != endIter )
+                    {
+                        sourceInfo.m_dependencies.erase( endIter );
+                    }
+                }
+            }
+            else
+            {
+                sourceInfo.m_dependencies.clear();
+                sourceInfo.m_errorOccurredReadingDependencies = true;
+            }
+        }
+    }
+
+    void CompileDependencyGraph::ApplySourceInfo( SourceInfo& sourceInfo )
+    {
+        Node* pNode = FindOrCreateNode( sourceInfo.m_ID );
+
+        // The node was invalidated while we were reading it, so this info might be stale
+        if ( pNode->m_invalidationCount != sourceInfo.m_invalidationCount )
+        {
+            return;
+        }
+
+        // Update the dependency edges
+        for ( auto const& oldDependencyID : pNode->m_dependencies )
+        {
+            auto foundIter = m_nodes.find( oldDependencyID );
+            EE_ASSERT( foundIter != m_nodes.end() );
+            foundIter->second->m_dependents.erase_first_unsorted( pNode->m_ID );
+        }
+
+        pNode->m_dependencies.swap( sourceInfo.m_dependencies );
+
+        for ( auto const& newDependencyID : pNode->m_dependencies )
+        {
+            FindOrCreateNode( newDependencyID )->m_dependents.emplace_back( pNode->m_ID );
+        }
+
+        // Update the source info
+        pNode->m_compiledRecord = sourceInfo.m_compiledRecord;
+        pNode->m_timestamp = sourceInfo.m_timestamp;
+        pNode->m_contentHash = sourceInfo.m_contentHash;
+        pNode->m_compilerVersion = sourceInfo.m_compilerVersion;
+        pNode->m_sourceExists = sourceInfo.m_sourceExists;
+        pNode->m_targetExists = sourceInfo.m_targetExists;
+        pNode->m_forceRecompile = sourceInfo.m_forceRecompile;
+        pNode->m_errorOccurredReadingDependencies = sourceInfo.m_errorOccurredReadingDependencies;
+        pNode->m_isSourceInfoValid = true;
+
+        InvalidateDerivedState( pNode );
+    }
+
+    bool CompileDependencyGraph::UpdateDerivedState( Node* pNode, TVector<Node*>& visitStack, String& outErrorMessage )
+    {
+        EE_ASSERT( pNode->m_isSourceInfoValid );
+
+        if ( pNode->m_isDerivedStateValid )
+        {
+            return true;
+        }
+
+        if ( pNode->m_errorOccurredReadingDependencies )
+        {
+            outErrorMessage.sprintf( "Failed to read compile dependencies for %s", pNode->m_ID.c_str() );
+            return false;
+        }
+
+        if ( VectorContains( visitStack, pNode ) )
+        {
+            outErrorMessage = "Circular dependency detected!";
+            return false;
+        }
+
+        // Update dependencies
+        //-------------------------------------------------------------------------
+
+        visitStack.emplace_back( pNode );
+
+        bool areDependenciesUpToDate = true;
+        bool canDependenciesUseCachedResult = true;
+
+        TInlineVector<uint64_t, 16> hashInputs;
+        hashInputs.emplace_back( pNode->m_contentHash );
+        hashInputs.emplace_back( (uint64_t) pNode->m_compilerVersion );
+
+        // The compression settings change the compiled output, so changing them needs to recompile the affected resources
+        if ( pNode->IsCompileableResource() && VectorContains( m_context.m_compressedResourceTypes, pNode->m_ID.GetResourceTypeID() ) )
+        {
+            hashInputs.emplace_back( (uint64_t) m_context.m_compressionBlockSize );
+        }
+
+        for ( auto const& dependencyID : pNode->m_dependencies )
+        {
+            Node* pDependencyNode = m_nodes[dependencyID];
+            if ( !UpdateDerivedState( pDependencyNode, visitStack, outErrorMessage ) )
+            {
+                return false;
+            }
+
+            hashInputs.emplace_back( pDependencyNode->m_combinedHash );
+            areDependenciesUpToDate &= pDependencyNode->m_isUpToDate;
+            canDependenciesUseCachedResult &= pDependencyNode->m_canUseCachedResult;
+        }
+
+        visitStack.pop_back();
+
+        // Generate combined hash
+        //-------------------------------------------------------------------------
+        // Note: we only hash contents (not timestamps) so that touching or re-syncing unchanged files doesnt trigger a recompile
+
+        pNode->m_combinedHash = Hash::XXHash::GetHash64( hashInputs.data(), hashInputs.size() * sizeof( uint64_t ) );
+
+        // Up-to-date check
+        //-------------------------------------------------------------------------
+
+        bool isUpToDate = areDependenciesUpToDate && !pNode->m_forceRecompile && pNode->m_sourceExists;
+        if ( isUpToDate && pNode->IsCompileableResource() )
+        {
+            isUpToDate = pNode->m_targetExists && pNode->m_compiledRecord.IsValid() && pNode->m_compiledRecord.m_compilerVersion == pNode->m_compilerVersion && pNode->m_compiledRecord.m_sourceHash == pNode->m_combinedHash;
+        }
+
+        // Resources that are always recompiled or that skip the dependency check have inputs that are not described by the hash
+        bool canUseCachedResult = canDependenciesUseCachedResult && !pNode->m_forceRecompile && pNode->m_sourceExists && pNode->m_contentHash != 0;
+        if ( canUseCachedResult && pNode->IsCompileableResource() )
+        {
+            canUseCachedResult = ShouldCheckCompileDependenciesForResourceType( pNode->m_ID );
+        }
+
+        pNode->m_isUpToDate = isUpToDate;
+        pNode->m_canUseCachedResult = canUseCachedResult;
+        pNode->m_isDerivedStateValid = true;
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompileDependencyGraph::GetCompileInfo( ResourceID const& resourceID, CompileInfo& outInfo, String& outErrorMessage )
+    {
+        EE_ASSERT( resourceID.IsValid() );
+
+        // The compiled output can be deleted without us being notified, so always check the requested resource's target
+        FileSystem::Path const targetPath = ResourcePath::ToFileSystemPath( m_context.m_compiledResourcePath, resourceID.GetResourcePath() );
+        bool const targetExists = FileSystem::Exists( targetPath );
+
+        TVector<SourceInfo> nodesToRefresh;
+        while ( true )
+        {
+            {
+                Threading::ScopeLock lock( m_mutex );
+
+                // Apply any refreshed source info
+                for ( auto& sourceInfo : nodesToRefresh )
+                {
+                    ApplySourceInfo( sourceInfo );
+                }
+                nodesToRefresh.clear();
+
+                // Find all the invalid nodes in the tree
+                Node* pRootNode = FindOrCreateNode( resourceID );
+                CollectNodesToRefresh( pRootNode, nodesToRefresh );
+
+                // Everything is valid, so we can now calculate the derived state
+                if ( nodesToRefresh.empty() )
+                {
+                    if ( pRootNode->IsCompileableResource() && pRootNode->m_targetExists != targetExists )
+                    {
+                        pRootNode->m_targetExists = targetExists;
+                        InvalidateDerivedState( pRootNode );
+                    }
+
+                    TVector<Node*> visitStack;
+                    if ( !UpdateDerivedState( pRootNode, visitStack, outErrorMessage ) )
+                    {
+                        return false;
+                    }
+
+                    outInfo.m_compilerVersion = pRootNode->m_compilerVersion;
+                    outInfo.m_timestamp = pRootNode->m_timestamp;
+                    outInfo.m_combinedHash = pRootNode->m_combinedHash;
+                    outInfo.m_isUpToDate = pRootNode->m_isUpToDate;
+                    outInfo.m_canUseCachedResult = pRootNode->m_canUseCachedResult;
+                    return true;
+                }
+            }
+
+            // Read all invalid nodes outside of the lock
+            for ( auto& sourceInfo : nodesToRefresh )
+            {
+                ReadSourceInfo( sourceInfo );
+            }
+        }
+    }
+}
\ No newline at end of file
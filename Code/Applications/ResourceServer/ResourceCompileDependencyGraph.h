@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CompiledResourceDatabase.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    struct ResourceServerContext;
+
+    //-------------------------------------------------------------------------
+
+    bool ShouldCheckCompileDependenciesForResourceType( ResourceID const& resourceID );
+
+    //-------------------------------------------------------------------------
+
+    // Caches the content hashes of source files so that we only rehash files whose modification time has changed
+    class SourceFileHashCache
+    {
+        struct Entry
+        {
+            uint64_t                            m_modifiedTime = 0;
+            uint64_t                            m_hash = 0;
+        };
+
+    public:
+
+        // Thread-safe, returns 0 if the file couldnt be read
+        uint64_t GetFileHash( FileSystem::Path const& filePath, uint64_t modifiedTime );
+
+    private:
+
+        Threading::Mutex                        m_mutex;
+        THashMap<FileSystem::Path, Entry>       m_entries;
+    };
+
+    //-------------------------------------------------------------------------
+    // Compile Dependency Graph
+    //-------------------------------------------------------------------------
+    // A persistent graph of all the compile dependencies that we have encountered, shared by all compilation requests
+    // Source file info (timestamps, content hashes and the dependencies listed in descriptors) is only read once and then cached until
+    // the file system watcher tells us that the file has changed. Derived state (combined hashes, up-to-date status) is cached per node
+    // and invalidated for all dependents whenever a node changes, so an up-to-date check only needs to revisit what actually changed.
+    //
+    // Queries are thread-safe: file reads and hashing happen outside of the lock and are discarded if the node was invalidated in the meantime
+
+    class CompileDependencyGraph
+    {
+        struct Node
+        {
+            inline bool IsCompileableResource() const { return m_compilerVersion >= 0; }
+
+        public:
+
+            ResourceID                          m_ID;
+            TVector<ResourceID>                 m_dependencies;
+            TVector<ResourceID>                 m_dependents;
+            CompiledResourceRecord              m_compiledRecord;
+            uint64_t                            m_timestamp = 0;
+            uint64_t                            m_contentHash = 0;                  // The hash of the source file contents
+            uint64_t                            m_combinedHash = 0;                 // The hash of the source contents, compiler version, compression settings and all dependencies
+            uint32_t                            m_invalidationCount = 0;            // Incremented each time the source info is invalidated, used to discard stale refreshes
+            uint32_t                            m_visitID = 0;
+            int32_t                             m_compilerVersion = -1;
+            bool                                m_sourceExists = false;
+            bool                                m_targetExists = false;
+            bool                                m_forceRecompile = false;
+            bool                                m_errorOccurredReadingDependencies = false;
+
+            // Cached state
+            bool                                m_isSourceInfoValid = false;
+            bool                                m_isDerivedStateValid = false;
+            bool                                m_isUpToDate = false;               // Is this resource and all its dependencies up to date
+            bool                                m_canUseCachedResult = false;       // Is the combined hash a complete description of all the compilation inputs
+        };
+
+        // The result of reading a node's source info from disk
+        struct SourceInfo
+        {
+            ResourceID                          m_ID;
+            TVector<ResourceID>                 m_dependencies;
+            CompiledResourceRecord              m_compiledRecord;
+            uint64_t                            m_timestamp = 0;
+            uint64_t                            m_contentHash = 0;
+            uint32_t                            m_invalidationCount = 0;
+            int32_t                             m_compilerVersion = -1;
+            bool                                m_sourceExists = false;
+            bool                                m_targetExists = false;
+            bool                                m_forceRecompile = false;
+            bool                                m_errorOccurredReadingDependencies = false;
+        };
+
+    public:
+
+        struct CompileInfo
+        {
+            int32_t                             m_compilerVersion = -1;
+            uint64_t                            m_timestamp = 0;
+            uint64_t                            m_combinedHash = 0;
+            bool                                m_isUpToDate = false;
+            bool                                m_canUseCachedResult = false;
+        };
+
+    public:
+
+        CompileDependencyGraph( ResourceServerContext const& context );
+        ~CompileDependencyGraph();
+
+        // Get the up-to-date info for a resource, this is thread-safe
+        bool GetCompileInfo( ResourceID const& resourceID, CompileInfo& outInfo, String& outErrorMessage );
+
+        // Invalidation - these need to be called whenever a source file changes or a resource is compiled
+        //-------------------------------------------------------------------------
+
+        void InvalidateSourceFile( FileSystem::Path const& filePath );
+        void InvalidateAll();
+        void OnResourceCompiled( CompiledResourceRecord const& record );
+
+        inline int32_t GetNumNodes() const { return (int32_t) m_nodes.size(); }
+
+    private:
+
+        Node* FindOrCreateNode( ResourceID const& resourceID );
+        void InvalidateSourceInfo( Node* pNode );
+        void InvalidateDerivedState( Node* pNode );
+
+        void CollectNodesToRefresh( Node* pRootNode, TVector<SourceInfo>& outNodesToRefresh );
+        void ReadSourceInfo( SourceInfo& sourceInfo ) const;
+        void ApplySourceInfo( SourceInfo& sourceInfo );
+        bool UpdateDerivedState( Node* pNode, TVector<Node*>& visitStack, String& outErrorMessage );
+
+        bool TryReadCompileDependencies( FileSystem::Path const& resourceFilePath, TVector<ResourceID>& outDependencies ) const;
+
+    private:
+
+        ResourceServerContext const&            m_context;
+        Threading::Mutex                        m_mutex;
+        THashMap<ResourceID, Node*>             m_nodes;
+        uint32_t                                m_visitID = 0;
+    };
+}
\ No newline at end of file
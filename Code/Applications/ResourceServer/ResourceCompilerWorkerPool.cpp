@@ -0,0 +1,376 @@
+#include "ResourceCompilerWorkerPool.h"
+#include "EngineTools/Resource/ResourceCompilerWorkerMessages.h"
+#include "EngineTools/ThirdParty/subprocess/subprocess.h"
+#include "System/Time/Time.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    CompilerWorkerPool::~CompilerWorkerPool()
+    {
+        EE_ASSERT( m_workers.empty() && m_pendingRequests.empty() );
+    }
+
+    bool CompilerWorkerPool::Initialize( FileSystem::Path const& compilerExecutablePath, uint16_t port, int32_t numWorkers )
+    {
+        EE_ASSERT( !IsRunning() );
+        EE_ASSERT( compilerExecutablePath.IsValid() && numWorkers > 0 );
+
+        if ( !Network::NetworkSystem::StartServerConnection( &m_networkServer, port ) )
+        {
+            EE_LOG_ERROR( "Resource", "Compiler Worker Pool", "Failed to start compiler worker server on port %u", port );
+            return false;
+        }
+
+        m_compilerExecutablePath = compilerExecutablePath;
+        m_isShuttingDown = false;
+
+        // Workers are started in the first update
+        m_workers.resize( numWorkers );
+
+        return true;
+    }
+
+    void CompilerWorkerPool::Shutdown()
+    {
+        EE_ASSERT( IsRunning() );
+
+        // Fail all pending requests and prevent any new ones from being enqueued
+        //-------------------------------------------------------------------------
+
+        {
+            Threading::ScopeLock lock( m_pendingRequestsMutex );
+            m_isShuttingDown = true;
+
+            for ( auto& pendingRequest : m_pendingRequests )
+            {
+                FailRequest( pendingRequest, "Resource server shutting down!" );
+            }
+            m_pendingRequests.clear();
+        }
+
+        // Ask all workers to exit
+        //-------------------------------------------------------------------------
+
+        for ( auto& worker : m_workers )
+        {
+            if ( worker.m_activeRequest.m_pRequest != nullptr )
+            {
+                FailRequest( worker.m_activeRequest, "Resource server shutting down!" );
+            }
+
+            if ( IsWorkerReady( worker ) && m_networkServer.HasConnectedClient( worker.m_connectionID ) )
+            {
+                Network::IPC::Message message( (int32_t) CompilerWorkerMessageID::Shutdown );
+                message.SetClientConnectionID( worker.m_connectionID );
+                m_networkServer.SendNetworkMessage( eastl::move( message ) );
+            }
+        }
+
+        Network::NetworkSystem::Update();
+
+        // Give the workers a little time to exit cleanly before we terminate them
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = 0; i < (int32_t) m_workers.size(); i++ )
+        {
+            if ( m_workers[i].m_pProcess != nullptr )
+            {
+                for ( int32_t attempt = 0; attempt < 50 && subprocess_alive( m_workers[i].m_pProcess ); attempt++ )
+                {
+                    Threading::Sleep( 10 );
+                }
+
+                StopWorker( i );
+            }
+        }
+
+        m_workers.clear();
+
+        //-------------------------------------------------------------------------
+
+        Network::NetworkSystem::StopServerConnection( &m_networkServer );
+    }
+
+    int32_t CompilerWorkerPool::GetNumReadyWorkers() const
+    {
+        int32_t numReadyWorkers = 0;
+        for ( auto const& worker : m_workers )
+        {
+            if ( IsWorkerReady( worker ) )
+            {
+                numReadyWorkers++;
+            }
+        }
+
+        return numReadyWorkers;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool CompilerWorkerPool::StartWorker( int32_t workerIdx )
+    {
+        Worker& worker = m_workers[workerIdx];
+        EE_ASSERT( worker.m_pProcess == nullptr );
+
+        InlineString const workerIdxStr( InlineString::CtorSprintf(), "%d", workerIdx );
+        char const* processCommandLineArgs[4] = { m_compilerExecutablePath.c_str(), "-worker", workerIdxStr.c_str(), nullptr };
+
+        // No default ctor for subprocess struct, so zero-init
+        worker.m_pProcess = EE::New<subprocess_s>();
+        Memory::MemsetZero( worker.m_pProcess );
+
+        if ( subprocess_create( processCommandLineArgs, subprocess_option_inherit_environment | subprocess_option_no_window, worker.m_pProcess ) != 0 )
+        {
+            EE::Delete( worker.m_pProcess );
+            return false;
+        }
+
+        worker.m_connectionID = 0;
+        return true;
+    }
+
+    void CompilerWorkerPool::StopWorker( int32_t workerIdx )
+    {
+        Worker& worker = m_workers[workerIdx];
+        EE_ASSERT( worker.m_pProcess != nullptr );
+        EE_ASSERT( worker.m_activeRequest.m_pRequest == nullptr );
+
+        if ( subprocess_alive( worker.m_pProcess ) )
+        {
+            subprocess_terminate( worker.m_pProcess );
+        }
+
+        subprocess_destroy( worker.m_pProcess );
+        EE::Delete( worker.m_pProcess );
+        worker.m_connectionID = 0;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CompilerWorkerPool::Compile( CompilationRequest* pRequest )
+    {
+        EE_ASSERT( pRequest != nullptr );
+
+        Threading::SyncEvent completedEvent;
+
+        {
+            Threading::ScopeLock lock( m_pendingRequestsMutex );
+
+            PendingRequest pendingRequest;
+            pendingRequest.m_pRequest = pRequest;
+            pendingRequest.m_pCompletedEvent = &completedEvent;
+
+            if ( m_isShuttingDown )
+            {
+                FailRequest( pendingRequest, "Resource server shutting down!" );
+                return;
+            }
+
+            m_pendingRequests.emplace_back( pendingRequest );
+        }
+
+        completedEvent.Wait();
+    }
+
+    void CompilerWorkerPool::CompleteRequest( PendingRequest& request, int32_t result, String const& log )
+    {
+        EE_ASSERT( request.m_pRequest != nullptr && request.m_pCompletedEvent != nullptr );
+
+        CompilationRequest* pRequest = request.m_pRequest;
+        pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
+        pRequest->m_log += log;
+
+        switch ( result )
+        {
+            case 0:
+            {
+                pRequest->m_status = CompilationRequest::Status::Succeeded;
+            }
+            break;
+
+            case 1:
+            {
+                pRequest->m_status = CompilationRequest::Status::SucceededWithWarnings;
+            }
+            break;
+
+            default:
+            {
+                pRequest->m_status = CompilationRequest::Status::Failed;
+            }
+            break;
+        }
+
+        // Note: the waiting task takes over the request once signaled
+        request.m_pCompletedEvent->Signal();
+        request = PendingRequest();
+    }
+
+    void CompilerWorkerPool::FailRequest( PendingRequest& request, char const* pReason )
+    {
+        EE_ASSERT( request.m_pRequest != nullptr && request.m_pCompletedEvent != nullptr );
+
+        CompilationRequest* pRequest = request.m_pRequest;
+        if ( pRequest->m_compilationTimeStarted == 0 )
+        {
+            pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
+        }
+
+        pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
+        pRequest->m_log += pReason;
+        pRequest->m_status = CompilationRequest::Status::Failed;
+
+        request.m_pCompletedEvent->Signal();
+        request = PendingRequest();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CompilerWorkerPool::Update()
+    {
+        EE_ASSERT( IsRunning() );
+
+        // Process worker messages
+        //-------------------------------------------------------------------------
+
+        auto FindWorker = [this] ( uint32_t connectionID )
+        {
+            for ( int32_t i = 0; i < (int32_t) m_workers.size(); i++ )
+            {
+                if ( m_workers[i].m_connectionID == connectionID )
+                {
+                    return i;
+                }
+            }
+
+            return (int32_t) InvalidIndex;
+        };
+
+        auto ProcessIncomingMessages = [&] ( Network::IPC::Message const& message )
+        {
+            if ( message.GetMessageID() == (int32_t) CompilerWorkerMessageID::WorkerReady )
+            {
+                CompilerWorkerReady const workerReady = message.GetData<CompilerWorkerReady>();
+                if ( workerReady.m_workerIdx >= 0 && workerReady.m_workerIdx < (int32_t) m_workers.size() && m_workers[workerReady.m_workerIdx].m_pProcess != nullptr )
+                {
+                    Worker& worker = m_workers[workerReady.m_workerIdx];
+
+                    // A worker that reconnects has lost any in-flight result
+                    if ( worker.m_activeRequest.m_pRequest != nullptr )
+                    {
+                        FailRequest( worker.m_activeRequest, "Error: Lost connection to resource compiler worker during compilation!" );
+                    }
+
+                    worker.m_connectionID = message.GetClientConnectionID();
+                    worker.m_numFailedStartAttempts = 0;
+                }
+            }
+            else if ( message.GetMessageID() == (int32_t) CompilerWorkerMessageID::CompileResult )
+            {
+                int32_t const workerIdx = FindWorker( message.GetClientConnectionID() );
+                if ( workerIdx != InvalidIndex )
+                {
+                    CompilerWorkerResult const result = message.GetData<CompilerWorkerResult>();
+                    Worker& worker = m_workers[workerIdx];
+                    if ( worker.m_activeRequest.m_pRequest != nullptr && worker.m_activeRequest.m_pRequest->m_resourceID == result.m_resourceID )
+                    {
+                        CompleteRequest( worker.m_activeRequest, result.m_result, result.m_log );
+                    }
+                }
+            }
+        };
+
+        m_networkServer.ProcessIncomingMessages( ProcessIncomingMessages );
+
+        // Restart any workers that have crashed or lost their connection
+        //-------------------------------------------------------------------------
+
+        bool hasAvailableWorkers = false;
+        for ( int32_t i = 0; i < (int32_t) m_workers.size(); i++ )
+        {
+            Worker& worker = m_workers[i];
+
+            if ( worker.m_pProcess != nullptr )
+            {
+                bool const hasExited = !subprocess_alive( worker.m_pProcess );
+                bool const hasLostConnection = IsWorkerReady( worker ) && !m_networkServer.HasConnectedClient( worker.m_connectionID );
+                if ( hasExited || hasLostConnection )
+                {
+                    if ( worker.m_activeRequest.m_pRequest != nullptr )
+                    {
+                        InlineString const reason( InlineString::CtorSprintf(), "Error: Resource compiler worker %d exited unexpectedly during compilation!", i );
+                        FailRequest( worker.m_activeRequest, reason.c_str() );
+                    }
+
+                    // Workers that die before connecting are likely misconfigured, so we stop restarting them after a few attempts
+                    if ( !IsWorkerReady( worker ) )
+                    {
+                        worker.m_numFailedStartAttempts++;
+                    }
+
+                    EE_LOG_WARNING( "Resource", "Compiler Worker Pool", "Resource compiler worker %d exited, restarting", i );
+                    StopWorker( i );
+                }
+            }
+
+            if ( worker.m_pProcess == nullptr && worker.m_numFailedStartAttempts < s_maxFailedStartAttempts )
+            {
+                if ( !StartWorker( i ) )
+                {
+                    worker.m_numFailedStartAttempts++;
+
+                    if ( worker.m_numFailedStartAttempts == s_maxFailedStartAttempts )
+                    {
+                        EE_LOG_ERROR( "Resource", "Compiler Worker Pool", "Failed to start resource compiler worker %d: %s", i, m_compilerExecutablePath.c_str() );
+                    }
+                }
+            }
+
+            hasAvailableWorkers |= IsWorkerAvailable( worker );
+        }
+
+        // Dispatch pending requests to idle workers
+        //-------------------------------------------------------------------------
+
+        Threading::ScopeLock lock( m_pendingRequestsMutex );
+
+        if ( !hasAvailableWorkers )
+        {
+            for ( auto& pendingRequest : m_pendingRequests )
+            {
+                FailRequest( pendingRequest, "Error: No resource compiler workers available!" );
+            }
+            m_pendingRequests.clear();
+            return;
+        }
+
+        int32_t numDispatchedRequests = 0;
+        for ( auto& worker : m_workers )
+        {
+            if ( numDispatchedRequests == (int32_t) m_pendingRequests.size() )
+            {
+                break;
+            }
+
+            if ( !IsWorkerReady( worker ) || worker.m_activeRequest.m_pRequest != nullptr )
+            {
+                continue;
+            }
+
+            worker.m_activeRequest = m_pendingRequests[numDispatchedRequests];
+            numDispatchedRequests++;
+
+            CompilationRequest* pRequest = worker.m_activeRequest.m_pRequest;
+            pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
+
+            Network::IPC::Message message( (int32_t) CompilerWorkerMessageID::CompileRequest, CompilerWorkerRequest( pRequest->m_resourceID, pRequest->m_origin == CompilationRequest::Origin::Package ) );
+            message.SetClientConnectionID( worker.m_connectionID );
+            m_networkServer.SendNetworkMessage( eastl::move( message ) );
+        }
+
+        m_pendingRequests.erase( m_pendingRequests.begin(), m_pendingRequests.begin() + numDispatchedRequests );
+    }
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "ResourceCompilationRequest.h"
+#include "System/Network/IPC/IPCMessageServer.h"
+#include "System/FileSystem/FileSystemPath.h"
+#include "System/Threading/Threading.h"
+
+//-------------------------------------------------------------------------
+
+struct subprocess_s;
+
+//-------------------------------------------------------------------------
+// Resource Compiler Worker Pool
+//-------------------------------------------------------------------------
+// Manages a set of persistent resource compiler processes so that we dont pay the process startup and type registration cost per compile
+// Compile requests are sent to the workers via IPC and the workers are restarted if they crash or lose their connection
+// All network traffic and worker management happens on the main thread (in Update), compiles can be requested from any thread
+
+namespace EE::Resource
+{
+    class CompilerWorkerPool
+    {
+        constexpr static int32_t const s_maxFailedStartAttempts = 3;
+
+        struct PendingRequest
+        {
+            CompilationRequest*                 m_pRequest = nullptr;
+            Threading::SyncEvent*               m_pCompletedEvent = nullptr;
+        };
+
+        struct Worker
+        {
+            subprocess_s*                       m_pProcess = nullptr;
+            uint32_t                            m_connectionID = 0;             // Only set once the worker has connected and announced itself
+            PendingRequest                      m_activeRequest;
+            int32_t                             m_numFailedStartAttempts = 0;
+        };
+
+    public:
+
+        ~CompilerWorkerPool();
+
+        bool Initialize( FileSystem::Path const& compilerExecutablePath, uint16_t port, int32_t numWorkers );
+        void Shutdown();
+
+        // Process worker messages, dispatch pending requests and restart any crashed workers - needs to be called on the main thread after the network system update
+        void Update();
+
+        inline bool IsRunning() const { return !m_workers.empty(); }
+        inline int32_t GetNumWorkers() const { return (int32_t) m_workers.size(); }
+        int32_t GetNumReadyWorkers() const;
+
+        // Compile a resource using one of the workers, this is thread-safe and blocks until the request completes
+        // Requests made once the pool has been shutdown fail immediately
+        void Compile( CompilationRequest* pRequest );
+
+    private:
+
+        bool StartWorker( int32_t workerIdx );
+        void StopWorker( int32_t workerIdx );
+
+        inline bool IsWorkerReady( Worker const& worker ) const { return worker.m_connectionID != 0; }
+        inline bool IsWorkerAvailable( Worker const& worker ) const { return worker.m_pProcess != nullptr || worker.m_numFailedStartAttempts < s_maxFailedStartAttempts; }
+
+        void CompleteRequest( PendingRequest& request, int32_t result, String const& log );
+        void FailRequest( PendingRequest& request, char const* pReason );
+
+    private:
+
+        Network::IPC::Server                    m_networkServer;
+        FileSystem::Path                        m_compilerExecutablePath;
+        TVector<Worker>                         m_workers;
+
+        // Requests are enqueued from the compilation tasks so access needs to be synchronized
+        Threading::Mutex                        m_pendingRequestsMutex;
+        TVector<PendingRequest>                 m_pendingRequests;
+        bool                                    m_isShuttingDown = false;
+    };
+}
\ No newline at end of file
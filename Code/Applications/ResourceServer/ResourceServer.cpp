@@ -1,14 +1,18 @@
 #include "ResourceServer.h"
-#include "ResourceCompileDependencyTree.h"
+#include "ResourceCompileDependencyGraph.h"
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 #include "EngineTools/Resource/ResourceCompiler.h"
 #include "EngineTools/ThirdParty/subprocess/subprocess.h"
 #include "Engine/Entity/EntityDescriptors.h"
 #include "Engine/Entity/EntitySerialization.h"
 #include "System/Resource/ResourceProviders/ResourceNetworkMessages.h"
+#include "System/Resource/ResourceArchive.h"
+#include "System/Resource/ResourceCompression.h"
 #include "System/IniFile.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/FileSystem/FileSystemUtils.h"
+#include "System/Time/Timers.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
@@ -46,9 +50,10 @@ namespace EE::Resource
             // Note: we enqueue failed requests as well just to have a uniform code flow
             if ( !m_context.m_isExiting && !m_pRequest->IsComplete() )
             {
-                if ( !IsUpToDate() )
+                if ( !IsUpToDate() && !TryRestoreFromCache() )
                 {
                     Compile();
+                    AddToCache();
                 }
             }
 
@@ -106,18 +111,19 @@ namespace EE::Resource
 
             // Check compile dependency and if this resource needs compilation
             m_pRequest->m_upToDateCheckTimeStarted = PlatformClock::GetTime();
-            CompileDependencyTree compileDependencyTree( m_context );
-            if ( compileDependencyTree.BuildTree( m_pRequest->m_resourceID ) )
-            {
-                CompileDependencyNode const* pRoot = compileDependencyTree.GetRoot();
-                m_pRequest->m_compilerVersion = pRoot->m_compilerVersion;
-                m_pRequest->m_fileTimestamp = pRoot->m_timestamp;
-                m_pRequest->m_sourceTimestampHash = pRoot->m_combinedHash;
-                m_pRequest->m_status = pRoot->IsUpToDate() ? CompilationRequest::Status::SucceededUpToDate : CompilationRequest::Status::Pending;
+            CompileDependencyGraph::CompileInfo compileInfo;
+            String errorMessage;
+            if ( m_context.m_pCompileDependencyGraph->GetCompileInfo( m_pRequest->m_resourceID, compileInfo, errorMessage ) )
+            {
+                m_pRequest->m_compilerVersion = compileInfo.m_compilerVersion;
+                m_pRequest->m_fileTimestamp = compileInfo.m_timestamp;
+                m_pRequest->m_sourceHash = compileInfo.m_combinedHash;
+                m_canUseCachedResult = compileInfo.m_canUseCachedResult;
+                m_pRequest->m_status = compileInfo.m_isUpToDate ? CompilationRequest::Status::SucceededUpToDate : CompilationRequest::Status::Pending;
             }
-            else // Failed to generate dependency tree
+            else // Failed to resolve compile dependencies
             {
-                m_pRequest->m_log.sprintf( compileDependencyTree.GetErrorMessage().c_str() );
+                m_pRequest->m_log.sprintf( "%s", errorMessage.c_str() );
                 m_pRequest->m_status = CompilationRequest::Status::Failed;
             }
             m_pRequest->m_upToDateCheckTimeFinished = PlatformClock::GetTime();
@@ -133,7 +139,76 @@ namespace EE::Resource
             return m_pRequest->IsComplete();
         }
 
+        // Try to restore a previously compiled result with identical inputs from the compiled resource cache
+        bool TryRestoreFromCache()
+        {
+            if ( m_context.m_pCompiledResourceCache == nullptr || !m_canUseCachedResult || m_pRequest->IsComplete() )
+            {
+                return false;
+            }
+
+            // The user explicitly asked for a recompile
+            if ( m_pRequest->m_origin == CompilationRequest::Origin::ManualCompileForced )
+            {
+                return false;
+            }
+
+            m_pRequest->m_compilationTimeStarted = PlatformClock::GetTime();
+
+            if ( !m_context.m_pCompiledResourceCache->TryRestore( GetCacheKey(), m_pRequest->m_resourceID, m_pRequest->m_destinationFile ) )
+            {
+                return false;
+            }
+
+            m_pRequest->m_compilationTimeFinished = PlatformClock::GetTime();
+            m_pRequest->m_log = "Restored from compiled resource cache";
+            m_pRequest->m_status = CompilationRequest::Status::SucceededFromCache;
+
+            if ( VectorContains( m_context.m_compressedResourceTypes, m_pRequest->m_resourceID.GetResourceTypeID() ) )
+            {
+                GatherCompressionInfo();
+            }
+
+            return true;
+        }
+
+        void AddToCache()
+        {
+            if ( m_context.m_pCompiledResourceCache == nullptr || !m_canUseCachedResult || !m_pRequest->HasSucceeded() )
+            {
+                return;
+            }
+
+            m_context.m_pCompiledResourceCache->Store( GetCacheKey(), m_pRequest->m_resourceID, m_pRequest->m_destinationFile );
+        }
+
+        uint64_t GetCacheKey() const
+        {
+            bool const isForPackagedBuild = m_pRequest->m_origin == CompilationRequest::Origin::Package;
+            bool const isCompressed = VectorContains( m_context.m_compressedResourceTypes, m_pRequest->m_resourceID.GetResourceTypeID() );
+            return CompiledResourceCache::CalculateKey( m_pRequest->m_resourceID, m_pRequest->m_sourceHash, isForPackagedBuild, isCompressed ? m_context.m_compressionBlockSize : 0 );
+        }
+
         void Compile()
+        {
+            if ( m_context.m_pCompilerWorkerPool != nullptr )
+            {
+                m_context.m_pCompilerWorkerPool->Compile( m_pRequest );
+            }
+            else
+            {
+                CompileInNewProcess();
+            }
+
+            //-------------------------------------------------------------------------
+
+            if ( m_pRequest->HasSucceeded() && VectorContains( m_context.m_compressedResourceTypes, m_pRequest->m_resourceID.GetResourceTypeID() ) )
+            {
+                GatherCompressionInfo();
+            }
+        }
+
+        void CompileInNewProcess()
         {
             EE_ASSERT( !m_pRequest->m_compilerArgs.empty() );
             char const* processCommandLineArgs[5] = { m_context.m_compilerExecutablePath.c_str(), "-compile", m_pRequest->m_compilerArgs.c_str(), nullptr, nullptr };
@@ -212,12 +287,48 @@ namespace EE::Resource
             subprocess_destroy( &m_subProcess );
         }
 
+        // Verify that the compressed output round-trips and record the compression ratio and decompression cost
+        void GatherCompressionInfo()
+        {
+            Blob compiledData;
+            if ( !FileSystem::LoadFile( m_pRequest->m_destinationFile, compiledData ) )
+            {
+                return;
+            }
+
+            m_pRequest->m_compiledFileSize = compiledData.size();
+            m_pRequest->m_uncompressedSize = compiledData.size();
+
+            if ( ResourceCompression::IsCompressed( compiledData.data(), compiledData.size() ) )
+            {
+                Blob decompressedData;
+                Milliseconds decompressionTime = 0;
+                bool decompressionSucceeded = false;
+                {
+                    ScopedTimer<PlatformClock> timer( decompressionTime );
+                    decompressionSucceeded = ResourceCompression::Decompress( compiledData.data(), compiledData.size(), decompressedData );
+                }
+
+                if ( decompressionSucceeded )
+                {
+                    m_pRequest->m_uncompressedSize = decompressedData.size();
+                    m_pRequest->m_decompressionTime = decompressionTime;
+                }
+                else
+                {
+                    m_pRequest->m_log += "Error: Compressed resource failed to decompress!\n";
+                    m_pRequest->m_status = CompilationRequest::Status::Failed;
+                }
+            }
+        }
+
     private:
 
         ResourceServerContext const&                        m_context;
         Threading::LockFreeQueue<CompilationTask*>&         m_completedTaskQueue;
         CompilationRequest*                                 m_pRequest = nullptr;
         subprocess_s                                        m_subProcess;
+        bool                                                m_canUseCachedResult = false;
     };
 
     //-------------------------------------------------------------------------
@@ -287,6 +398,10 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    ResourceServer::ResourceServer()
+        : m_compileDependencyGraph( m_context )
+    {}
+
     ResourceServer::~ResourceServer()
     {
         EE_ASSERT( m_pCompilerRegistry == nullptr );
@@ -317,6 +432,15 @@ namespace EE::Resource
             return false;
         }
 
+        // Compiled resource cache is optional so we just warn if it cant be created
+        if ( m_settings.m_compiledResourceCachePath.IsValid() )
+        {
+            if ( !m_compiledResourceCache.Initialize( m_settings.m_compiledResourceCachePath ) )
+            {
+                EE_LOG_WARNING( "Resource", "Resource Server", "Compiled resource cache disabled!" );
+            }
+        }
+
         // Open network connection
         //-------------------------------------------------------------------------
 
@@ -330,6 +454,18 @@ namespace EE::Resource
             return false;
         }
 
+        // Start compiler workers
+        //-------------------------------------------------------------------------
+
+        if ( m_settings.m_numCompilerWorkers > 0 )
+        {
+            if ( !m_compilerWorkerPool.Initialize( m_settings.m_resourceCompilerExecutablePath, m_settings.m_compilerWorkerPort, m_settings.m_numCompilerWorkers ) )
+            {
+                m_errorMessage.sprintf( "Failed to start compiler worker pool on port: %u", m_settings.m_compilerWorkerPort );
+                return false;
+            }
+        }
+
         // File System
         //-------------------------------------------------------------------------
 
@@ -349,9 +485,15 @@ namespace EE::Resource
         m_context.m_rawResourcePath = m_settings.m_rawResourcePath;
         m_context.m_compiledResourcePath = m_settings.m_compiledResourcePath;
         m_context.m_compilerExecutablePath = m_settings.m_resourceCompilerExecutablePath;
+        m_context.m_compressedResourceTypes = m_settings.m_compressedResourceTypes;
+        m_context.m_compressionBlockSize = m_settings.m_compressionBlockSize;
+        m_context.m_pSourceFileHashCache = &m_sourceFileHashCache;
+        m_context.m_pCompileDependencyGraph = &m_compileDependencyGraph;
+        m_context.m_pCompiledResourceCache = m_compiledResourceCache.IsEnabled() ? &m_compiledResourceCache : nullptr;
         m_context.m_pTypeRegistry = &m_typeRegistry;
         m_context.m_pCompilerRegistry = m_pCompilerRegistry;
         m_context.m_pCompiledResourceDB = &m_compiledResourceDatabase;
+        m_context.m_pCompilerWorkerPool = m_compilerWorkerPool.IsRunning() ? &m_compilerWorkerPool : nullptr;
 
         // Packaging
         //-------------------------------------------------------------------------
@@ -365,6 +507,14 @@ namespace EE::Resource
     {
         m_context.m_isExiting = true;
 
+        // Stop compiler workers, this fails all in-flight compiles so that the waiting tasks can complete
+        //-------------------------------------------------------------------------
+
+        if ( m_compilerWorkerPool.IsRunning() )
+        {
+            m_compilerWorkerPool.Shutdown();
+        }
+
         // Complete all scheduled requests
         //-------------------------------------------------------------------------
 
@@ -436,6 +586,14 @@ namespace EE::Resource
             m_networkServer.ProcessIncomingMessages( ProcessIncomingMessages );
         }
 
+        // Update compiler workers
+        //-------------------------------------------------------------------------
+
+        if ( m_compilerWorkerPool.IsRunning() )
+        {
+            m_compilerWorkerPool.Update();
+        }
+
         // Update Packaging
         //-------------------------------------------------------------------------
 
@@ -469,6 +627,7 @@ namespace EE::Resource
 
             if ( isComplete )
             {
+                WritePackagedResourceArchives();
                 m_packagingRequests.clear();
                 m_packagingStage = PackagingStage::Complete;
             }
@@ -510,10 +669,39 @@ namespace EE::Resource
         return IsPackaging() || m_numScheduledTasks != 0;
     }
 
+    void ResourceServer::OnFileCreated( FileSystem::Path const& filePath )
+    {
+        m_compileDependencyGraph.InvalidateSourceFile( filePath );
+    }
+
+    void ResourceServer::OnFileDeleted( FileSystem::Path const& filePath )
+    {
+        m_compileDependencyGraph.InvalidateSourceFile( filePath );
+    }
+
+    void ResourceServer::OnFileRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath )
+    {
+        m_compileDependencyGraph.InvalidateSourceFile( oldPath );
+        m_compileDependencyGraph.InvalidateSourceFile( newPath );
+    }
+
+    void ResourceServer::OnDirectoryDeleted( FileSystem::Path const& path )
+    {
+        m_compileDependencyGraph.InvalidateAll();
+    }
+
+    void ResourceServer::OnDirectoryRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath )
+    {
+        m_compileDependencyGraph.InvalidateAll();
+    }
+
     void ResourceServer::OnFileModified( FileSystem::Path const& filePath )
     {
         EE_ASSERT( filePath.IsValid() && filePath.IsFilePath() );
 
+        // Needs to happen before we create the request so that the request sees the new file state
+        m_compileDependencyGraph.InvalidateSourceFile( filePath );
+
         ResourcePath resourcePath = ResourcePath::FromFileSystemPath( m_settings.m_rawResourcePath, filePath );
         if ( !resourcePath.IsValid() )
         {
@@ -605,8 +793,24 @@ namespace EE::Resource
                     record.m_resourceID = pRequest->m_resourceID;
                     record.m_compilerVersion = pRequest->m_compilerVersion;
                     record.m_fileTimestamp = pRequest->m_fileTimestamp;
-                    record.m_sourceTimestampHash = pRequest->m_sourceTimestampHash;
+                    record.m_sourceHash = pRequest->m_sourceHash;
                     m_compiledResourceDatabase.WriteRecord( record );
+
+                    // Packaged builds are compiled to a different directory so the graph's compiled state is unaffected
+                    if ( pRequest->m_origin != CompilationRequest::Origin::Package )
+                    {
+                        m_compileDependencyGraph.OnResourceCompiled( record );
+                    }
+                }
+
+                // Update compression stats
+                if ( pRequest->HasSucceeded() && pRequest->m_compiledFileSize > 0 )
+                {
+                    auto& compressionInfo = m_compressionInfo[pRequest->m_resourceID];
+                    compressionInfo.m_compiledFileSize = pRequest->m_compiledFileSize;
+                    compressionInfo.m_uncompressedSize = pRequest->m_uncompressedSize;
+                    compressionInfo.m_decompressionTime = pRequest->m_decompressionTime;
+                    m_compressionStatsDirty = true;
                 }
 
                 // Send network response
@@ -624,6 +828,33 @@ namespace EE::Resource
 
             numDequeuedTasks = m_completedTasks.try_dequeue_bulk( dequeuedTasks, 100 );
         }
+
+        //-------------------------------------------------------------------------
+
+        if ( m_compressionStatsDirty )
+        {
+            m_compressionStats.clear();
+
+            for ( auto const& compressionInfoPair : m_compressionInfo )
+            {
+                ResourceTypeID const resourceTypeID = compressionInfoPair.first.GetResourceTypeID();
+                auto predicate = [] ( CompressionStats const& stats, ResourceTypeID const& typeID ) { return stats.m_resourceTypeID == typeID; };
+                int32_t statsIdx = VectorFindIndex( m_compressionStats, resourceTypeID, predicate );
+                if ( statsIdx == InvalidIndex )
+                {
+                    statsIdx = (int32_t) m_compressionStats.size();
+                    m_compressionStats.emplace_back().m_resourceTypeID = resourceTypeID;
+                }
+
+                auto& stats = m_compressionStats[statsIdx];
+                stats.m_numResources++;
+                stats.m_compiledFileSize += compressionInfoPair.second.m_compiledFileSize;
+                stats.m_uncompressedSize += compressionInfoPair.second.m_uncompressedSize;
+                stats.m_decompressionTime += compressionInfoPair.second.m_decompressionTime;
+            }
+
+            m_compressionStatsDirty = false;
+        }
     }
 
     void ResourceServer::NotifyClientOnCompletedRequest( CompilationRequest* pRequest )
@@ -705,6 +936,34 @@ namespace EE::Resource
         m_packagingStage = PackagingStage::Preparing;
     }
 
+    void ResourceServer::WritePackagedResourceArchives()
+    {
+        ResourceArchiveWriter archiveWriter;
+        int32_t numFailedRequests = 0;
+
+        for ( auto pRequest : m_packagingRequests )
+        {
+            if ( pRequest->HasSucceeded() )
+            {
+                archiveWriter.AddResource( pRequest->GetResourceID(), pRequest->GetDestinationFilePath() );
+            }
+            else
+            {
+                numFailedRequests++;
+            }
+        }
+
+        if ( numFailedRequests > 0 )
+        {
+            EE_LOG_WARNING( "Resource", "Packaging", "%d resources failed to compile and will not be included in the resource archives", numFailedRequests );
+        }
+
+        if ( !archiveWriter.Write( m_settings.m_packagedBuildCompiledResourcePath ) )
+        {
+            EE_LOG_ERROR( "Resource", "Packaging", "Failed to write resource archives to: %s", m_settings.m_packagedBuildCompiledResourcePath.c_str() );
+        }
+    }
+
     float ResourceServer::GetPackagingProgress() const
     {
         switch ( m_packagingStage )
@@ -2,12 +2,16 @@
 
 #include "ResourceServerContext.h"
 #include "ResourceCompilationRequest.h"
+#include "ResourceCompilerWorkerPool.h"
+#include "ResourceCompileDependencyGraph.h"
+#include "CompiledResourceCache.h"
 #include "EngineTools/Core/FileSystem/FileSystemWatcher.h"
 #include "System/Network/IPC/IPCMessageServer.h"
 #include "System/Resource/ResourceSettings.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/Threading/TaskSystem.h"
 #include "System/Threading/Threading.h"
+#include "System/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 // The network resource server
@@ -42,9 +46,27 @@ namespace EE::Resource
             Complete
         };
 
+        struct CompressionInfo
+        {
+            uint64_t        m_compiledFileSize = 0;
+            uint64_t        m_uncompressedSize = 0;
+            Milliseconds    m_decompressionTime = 0;
+        };
+
+        struct CompressionStats
+        {
+            inline float GetCompressionRatio() const { return ( m_compiledFileSize > 0 ) ? float( m_uncompressedSize ) / m_compiledFileSize : 1.0f; }
+
+            ResourceTypeID  m_resourceTypeID;
+            int32_t         m_numResources = 0;
+            uint64_t        m_compiledFileSize = 0;
+            uint64_t        m_uncompressedSize = 0;
+            Milliseconds    m_decompressionTime = 0;
+        };
+
     public:
 
-        ResourceServer() = default;
+        ResourceServer();
         ~ResourceServer();
 
         bool Initialize( IniFile const& iniFile );
@@ -56,6 +78,8 @@ namespace EE::Resource
         inline String const& GetErrorMessage() const { return m_errorMessage; }
         inline String const& GetNetworkAddress() const { return m_settings.m_resourceServerNetworkAddress; }
         inline uint16_t GetNetworkPort() const { return m_settings.m_resourceServerPort; }
+        inline int32_t GetNumCompilerWorkers() const { return m_compilerWorkerPool.GetNumWorkers(); }
+        inline int32_t GetNumReadyCompilerWorkers() const { return m_compilerWorkerPool.GetNumReadyWorkers(); }
         inline FileSystem::Path const& GetRawResourceDir() const { return m_settings.m_rawResourcePath; }
         inline FileSystem::Path const& GetCompiledResourceDir() const { return m_settings.m_compiledResourcePath; }
 
@@ -112,6 +136,12 @@ namespace EE::Resource
         // Start the packaging process
         void StartPackaging();
 
+        // Compression
+        //-------------------------------------------------------------------------
+
+        // Get the per-type compression stats for all compressed resources compiled this session
+        TVector<CompressionStats> const& GetCompressionStats() const { return m_compressionStats; }
+
     private:
 
         // Requests
@@ -121,10 +151,21 @@ namespace EE::Resource
         void ProcessCompletedRequests();
         void NotifyClientOnCompletedRequest( CompilationRequest* pRequest );
 
+        // Packaging
+        //-------------------------------------------------------------------------
+
+        // Pack all the successfully packaged resources into the resource archives used by the packaged build
+        void WritePackagedResourceArchives();
+
         // File system listener
         //-------------------------------------------------------------------------
 
+        virtual void OnFileCreated( FileSystem::Path const& filePath ) override final;
+        virtual void OnFileDeleted( FileSystem::Path const& filePath ) override final;
+        virtual void OnFileRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath ) override final;
         virtual void OnFileModified( FileSystem::Path const& filePath ) override final;
+        virtual void OnDirectoryDeleted( FileSystem::Path const& path ) override final;
+        virtual void OnDirectoryRenamed( FileSystem::Path const& oldPath, FileSystem::Path const& newPath ) override final;
 
     private:
 
@@ -140,12 +181,16 @@ namespace EE::Resource
 
         // Compilation Requests
         CompiledResourceDatabase                                    m_compiledResourceDatabase;
+        SourceFileHashCache                                         m_sourceFileHashCache;
+        CompileDependencyGraph                                      m_compileDependencyGraph;
+        CompiledResourceCache                                       m_compiledResourceCache;
         TVector<CompilationRequest*>                                m_requests;
         Threading::LockFreeQueue<CompilationTask*>                  m_completedTasks;
         std::atomic<int64_t>                                        m_numScheduledTasks = 0;
 
         // Workers
         ResourceServerContext                                       m_context;
+        CompilerWorkerPool                                          m_compilerWorkerPool;
 
         // Packaging
         TVector<ResourceID>                                         m_allMaps;
@@ -154,6 +199,11 @@ namespace EE::Resource
         PackagingTask*                                              m_pPackagingTask = nullptr;
         PackagingStage                                              m_packagingStage = PackagingStage::None;
 
+        // Compression
+        THashMap<ResourceID, CompressionInfo>                       m_compressionInfo;
+        TVector<CompressionStats>                                   m_compressionStats;
+        bool                                                        m_compressionStatsDirty = false;
+
         // File System Watcher
         FileSystem::FileSystemWatcher                               m_fileSystemWatcher;
     };
@@ -6,6 +6,13 @@
 
 namespace EE::Resource
 {
+    class CompilerWorkerPool;
+    class CompiledResourceCache;
+    class SourceFileHashCache;
+    class CompileDependencyGraph;
+
+    //-------------------------------------------------------------------------
+
     struct ResourceServerContext
     {
         bool IsValid() const;
@@ -18,6 +25,16 @@ namespace EE::Resource
         TypeSystem::TypeRegistry const*         m_pTypeRegistry = nullptr;
         CompilerRegistry const*                 m_pCompilerRegistry = nullptr;
         CompiledResourceDatabase const*         m_pCompiledResourceDB = nullptr;
+        SourceFileHashCache*                    m_pSourceFileHashCache = nullptr;
+        CompileDependencyGraph*                 m_pCompileDependencyGraph = nullptr;
+        TVector<ResourceTypeID>                 m_compressedResourceTypes;
+        uint32_t                                m_compressionBlockSize = 0;
+
+        // Optional content addressed cache of compiled results
+        CompiledResourceCache const*            m_pCompiledResourceCache = nullptr;
+
+        // Optional persistent compiler processes, if not set we start a compiler process per compile
+        CompilerWorkerPool*                     m_pCompilerWorkerPool = nullptr;
 
         // Set when we shutdown the server to skip processing of any scheduled tasks
         bool                                    m_isExiting = false;
@@ -13,6 +13,7 @@ namespace EE::Resource
     static char const* const g_serverControlsWindowName = "Server";
     static char const* const g_connectionInfoWindowName = "Connected Clients";
     static char const* const g_packagingControlsWindowName = "Packaging";
+    static char const* const g_compressionStatsWindowName = "Compression";
 
     //-------------------------------------------------------------------------
 
@@ -87,6 +88,7 @@ namespace EE::Resource
                 ImGui::DockBuilderDockWindow( g_connectionInfoWindowName, topLeftDockID );
                 ImGui::DockBuilderDockWindow( g_serverControlsWindowName, topRightDockID );
                 ImGui::DockBuilderDockWindow( g_packagingControlsWindowName, topLeftDockID );
+                ImGui::DockBuilderDockWindow( g_compressionStatsWindowName, topRightDockID );
                 ImGui::DockBuilderDockWindow( g_completedRequestsWindowName, bottomDockID );
 
                 ImGui::DockBuilderFinish( dockspaceID );
@@ -104,6 +106,7 @@ namespace EE::Resource
         DrawConnectionInfo();
         DrawRequests();
         DrawPackagingControls();
+        DrawCompressionStats();
     }
 
     //-------------------------------------------------------------------------
@@ -208,6 +211,14 @@ namespace EE::Resource
                             }
                             break;
 
+                            case CompilationRequest::Status::SucceededFromCache:
+                            {
+                                itemColor = Colors::Lime.ToFloat4();
+                                ImGui::TextColored( itemColor, EE_ICON_CACHED );
+                                ImGuiX::TextTooltip( "Restored From Cache" );
+                            }
+                            break;
+
                             case CompilationRequest::Status::Failed:
                             {
                                 itemColor = Colors::Red.ToFloat4();
@@ -380,6 +391,15 @@ namespace EE::Resource
             ImGui::Text( "Compiled Resource Path: %s", m_resourceServer.GetCompiledResourceDir().c_str() );
             ImGui::Text( "IP Address: %s:%d", m_resourceServer.GetNetworkAddress().c_str(), m_resourceServer.GetNetworkPort() );
 
+            if ( m_resourceServer.GetNumCompilerWorkers() > 0 )
+            {
+                ImGui::Text( "Compiler Workers: %d / %d Ready", m_resourceServer.GetNumReadyCompilerWorkers(), m_resourceServer.GetNumCompilerWorkers() );
+            }
+            else
+            {
+                ImGui::Text( "Compiler Workers: None (process per compile)" );
+            }
+
             //-------------------------------------------------------------------------
 
             ImGuiX::TextSeparator( "Tools" );
@@ -597,4 +617,58 @@ namespace EE::Resource
         }
         ImGui::End();
     }
+
+    void ResourceServerUI::DrawCompressionStats()
+    {
+        if ( ImGui::Begin( g_compressionStatsWindowName ) )
+        {
+            auto const& compressionStats = m_resourceServer.GetCompressionStats();
+            if ( compressionStats.empty() )
+            {
+                ImGui::Text( "No compressed resources compiled yet" );
+            }
+            else if ( ImGui::BeginTable( "Compression Stats Table", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable | ImGuiTableFlags_RowBg ) )
+            {
+                ImGui::TableSetupColumn( "Type", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 40 );
+                ImGui::TableSetupColumn( "Num", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 40 );
+                ImGui::TableSetupColumn( "Uncompressed", ImGuiTableColumnFlags_WidthStretch );
+                ImGui::TableSetupColumn( "Compressed", ImGuiTableColumnFlags_WidthStretch );
+                ImGui::TableSetupColumn( "Ratio", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 50 );
+                ImGui::TableSetupColumn( "Decode Time", ImGuiTableColumnFlags_WidthStretch );
+
+                //-------------------------------------------------------------------------
+
+                ImGui::TableHeadersRow();
+
+                for ( auto const& stats : compressionStats )
+                {
+                    ImGui::TableNextRow();
+
+                    char typeStr[5];
+                    stats.m_resourceTypeID.GetString( typeStr );
+
+                    ImGui::TableSetColumnIndex( 0 );
+                    ImGui::Text( typeStr );
+
+                    ImGui::TableSetColumnIndex( 1 );
+                    ImGui::Text( "%d", stats.m_numResources );
+
+                    ImGui::TableSetColumnIndex( 2 );
+                    ImGui::Text( "%.2f MB", stats.m_uncompressedSize / ( 1024.0f * 1024.0f ) );
+
+                    ImGui::TableSetColumnIndex( 3 );
+                    ImGui::Text( "%.2f MB", stats.m_compiledFileSize / ( 1024.0f * 1024.0f ) );
+
+                    ImGui::TableSetColumnIndex( 4 );
+                    ImGui::Text( "%.2fx", stats.GetCompressionRatio() );
+
+                    ImGui::TableSetColumnIndex( 5 );
+                    ImGui::Text( "%.3fms (avg: %.3fms)", stats.m_decompressionTime.ToFloat(), stats.m_decompressionTime.ToFloat() / stats.m_numResources );
+                }
+
+                ImGui::EndTable();
+            }
+        }
+        ImGui::End();
+    }
 }
\ No newline at end of file
@@ -35,6 +35,7 @@ namespace EE::Resource
         void DrawServerControls();
         void DrawConnectionInfo();
         void DrawPackagingControls();
+        void DrawCompressionStats();
 
     private:
 
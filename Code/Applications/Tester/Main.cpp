@@ -5,6 +5,13 @@
 #include "System/Serialization/BinarySerialization.h"
 #include "System/Math/NumericRange.h"
 #include "System/Types/Event.h"
+#include "System/Math/AABBTree.h"
+#include "System/Math/WideAABBTree.h"
+#include "System/Math/MathRandom.h"
+#include "Engine/Animation/AnimationPoseSoA.h"
+#include "Engine/Entity/EntitySpatialTransformQueue.h"
+#include "System/Time/Timers.h"
+#include "System/ThirdParty/cmdParser/cmdParser.h"
 
 #include "_AutoGenerated/ToolsTypeRegistration.h"
 
@@ -98,10 +105,236 @@ struct Wah : public Bar
 
 //-------------------------------------------------------------------------
 
+// Compare the binary and wide AABB trees for a scene of static meshes
+static void BenchmarkAABBTrees()
+{
+    constexpr static int32_t const numBoxes = 100000;
+    constexpr static int32_t const numQueries = 1000;
+    constexpr static int32_t const numMovedBoxes = 1000;
+
+    Math::RNG rng( 1234 );
+
+    TVector<AABB> boxes;
+    for ( auto i = 0; i < numBoxes; i++ )
+    {
+        boxes.emplace_back( Vector( rng.GetFloat( -5000, 5000 ), rng.GetFloat( -5000, 5000 ), rng.GetFloat( 0, 100 ) ), Vector( rng.GetFloat( 0.5f, 10.0f ), rng.GetFloat( 0.5f, 10.0f ), rng.GetFloat( 0.5f, 10.0f ) ) );
+    }
+
+    TVector<AABB> queries;
+    for ( auto i = 0; i < numQueries; i++ )
+    {
+        queries.emplace_back( Vector( rng.GetFloat( -5000, 5000 ), rng.GetFloat( -5000, 5000 ), 50.0f ), Vector( 100, 100, 100 ) );
+    }
+
+    TVector<AABB> movedBoxes;
+    for ( auto i = 0; i < numMovedBoxes; i++ )
+    {
+        AABB movedBox = boxes[i];
+        movedBox.SetCenter( movedBox.GetCenter() + Vector( rng.GetFloat( -5, 5 ), rng.GetFloat( -5, 5 ), 0.0f ) );
+        movedBoxes.emplace_back( movedBox );
+    }
+
+    auto const GetUserData = [] ( int32_t i ) { return uint64_t( i ) + 1; };
+
+    // Binary tree
+    //-------------------------------------------------------------------------
+
+    {
+        Math::AABBTree tree;
+        Timer<PlatformClock> timer;
+
+        for ( auto i = 0; i < numBoxes; i++ )
+        {
+            tree.InsertBox( boxes[i], GetUserData( i ) );
+        }
+        float const buildTime = timer.GetElapsedTimeMilliseconds();
+
+        timer.Start();
+        TVector<uint64_t> results;
+        size_t numResults = 0;
+        for ( auto const& query : queries )
+        {
+            tree.FindOverlaps( query, results );
+            numResults += results.size();
+        }
+        float const queryTime = timer.GetElapsedTimeMilliseconds();
+
+        timer.Start();
+        for ( auto i = 0; i < numMovedBoxes; i++ )
+        {
+            tree.RemoveBox( GetUserData( i ) );
+            tree.InsertBox( movedBoxes[i], GetUserData( i ) );
+        }
+        float const updateTime = timer.GetElapsedTimeMilliseconds();
+
+        std::cout << "AABBTree - Build: " << buildTime << "ms, Queries: " << queryTime << "ms (" << numResults << " results), Updates: " << updateTime << "ms" << std::endl;
+    }
+
+    // Wide tree
+    //-------------------------------------------------------------------------
+
+    {
+        Math::WideAABBTree tree;
+        Timer<PlatformClock> timer;
+
+        for ( auto i = 0; i < numBoxes; i++ )
+        {
+            tree.InsertBox( boxes[i], GetUserData( i ) );
+        }
+        float const buildTime = timer.GetElapsedTimeMilliseconds();
+
+        timer.Start();
+        TVector<uint64_t> results;
+        size_t numResults = 0;
+        for ( auto const& query : queries )
+        {
+            tree.FindOverlaps( query, results );
+            numResults += results.size();
+        }
+        float const queryTime = timer.GetElapsedTimeMilliseconds();
+
+        timer.Start();
+        TVector<TVector<uint64_t>> batchResults;
+        tree.FindOverlaps( queries.data(), numQueries, batchResults );
+        float const batchQueryTime = timer.GetElapsedTimeMilliseconds();
+
+        timer.Start();
+        for ( auto i = 0; i < numMovedBoxes; i++ )
+        {
+            tree.Refit( movedBoxes[i], GetUserData( i ) );
+        }
+        float const updateTime = timer.GetElapsedTimeMilliseconds();
+
+        std::cout << "WideAABBTree - Build: " << buildTime << "ms, Queries: " << queryTime << "ms (" << numResults << " results), Batch Queries: " << batchQueryTime << "ms, Updates: " << updateTime << "ms" << std::endl;
+    }
+}
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+// Check that the batched pose global transform solve matches the serial one and compare their costs
+static void BenchmarkPoseGlobalTransforms()
+{
+    constexpr static int32_t const numBones = 256;
+    constexpr static int32_t const numIterations = 10000;
+    constexpr static float const tolerance = 1.0e-4f;
+
+    Math::RNG rng( 1234 );
+
+    auto const CreateRandomTransform = [&rng] ()
+    {
+        Quaternion const rotation( Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ), Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ), Radians( rng.GetFloat( -Math::Pi, Math::Pi ) ) );
+        Vector const translation( rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), rng.GetFloat( -1.0f, 1.0f ), 0.0f );
+        return Transform( rotation, translation, rng.GetFloat( 0.5f, 1.5f ) );
+    };
+
+    // Create a wide hierarchy, parents are always listed before their children
+    //-------------------------------------------------------------------------
+
+    TVector<int32_t> parentIndices;
+    TVector<Transform> referencePose;
+    for ( auto i = 0; i < numBones; i++ )
+    {
+        int32_t const parentIdx = ( i < 2 ) ? i - 1 : (int32_t) rng.GetUInt( Math::Max( 0, i - 8 ), i - 1 );
+        parentIndices.emplace_back( ( i == 0 ) ? InvalidIndex : parentIdx );
+        referencePose.emplace_back( CreateRandomTransform() );
+    }
+
+    TVector<Animation::Skeleton::LOD> LODs;
+    LODs.resize( 2 );
+    LODs[0].m_numBones = numBones;
+    LODs[1].m_numBones = numBones / 2;
+    LODs[1].m_minDistance = 10.0f;
+
+    Animation::Skeleton skeleton;
+    skeleton.InitializeProcedural( parentIndices, referencePose, LODs );
+
+    Animation::Pose pose( &skeleton );
+    for ( auto i = 0; i < numBones; i++ )
+    {
+        pose.SetTransform( i, CreateRandomTransform() );
+    }
+
+    // Equivalence
+    //-------------------------------------------------------------------------
+
+    bool isEquivalent = true;
+    for ( auto lodIdx = 0; lodIdx < skeleton.GetNumLODs(); lodIdx++ )
+    {
+        pose.SetLOD( lodIdx );
+        pose.CalculateGlobalTransformsSerial();
+        TVector<Transform> const expectedGlobalTransforms = pose.GetGlobalTransforms();
+        pose.CalculateGlobalTransforms();
+
+        for ( auto i = 0; i < numBones; i++ )
+        {
+            Transform const& expected = expectedGlobalTransforms[i];
+            Transform const& actual = pose.GetGlobalTransforms()[i];
+
+            // Both 'q' and '-q' represent the same rotation
+            float const rotationDot = Math::Abs( Quaternion::Dot( expected.GetRotation(), actual.GetRotation() ).ToFloat() );
+            float const translationError = expected.GetTranslation().GetDistance3( actual.GetTranslation() );
+            float const scaleError = Math::Abs( expected.GetScale() - actual.GetScale() );
+            if ( rotationDot < 1.0f - tolerance || translationError > tolerance || scaleError > tolerance )
+            {
+                std::cout << "Pose global transforms differ for bone " << i << " at LOD " << lodIdx << std::endl;
+                isEquivalent = false;
+                break;
+            }
+        }
+    }
+
+    // Timing
+    //-------------------------------------------------------------------------
+
+    pose.SetLOD( 0 );
+
+    Timer<PlatformClock> timer;
+    for ( auto i = 0; i < numIterations; i++ )
+    {
+        pose.CalculateGlobalTransformsSerial();
+    }
+    float const serialTime = timer.GetElapsedTimeMilliseconds();
+
+    timer.Start();
+    for ( auto i = 0; i < numIterations; i++ )
+    {
+        pose.CalculateGlobalTransforms();
+    }
+    float const batchedTime = timer.GetElapsedTimeMilliseconds();
+
+    std::cout << "Pose Global Transforms (" << numBones << " bones, " << skeleton.GetNumHierarchyLevels() << " levels) - " << ( isEquivalent ? "Equivalent" : "NOT EQUIVALENT" ) << ", Serial: " << serialTime << "ms, Batched: " << batchedTime << "ms" << std::endl;
+}
+#endif
+
+//-------------------------------------------------------------------------
+
 int main( int argc, char *argv[] )
 {
+    cli::Parser cmdParser( argc, argv );
+    cmdParser.set_optional<bool>( "benchmark", "benchmark", false, "Run the AABB tree and pose benchmarks and the deferred transform write checks." );
+    if ( !cmdParser.run() )
+    {
+        return 1;
+    }
+
+    //-------------------------------------------------------------------------
+
     {
         EE::ApplicationGlobalState State;
+
+        if ( cmdParser.get<bool>( "benchmark" ) )
+        {
+            BenchmarkAABBTrees();
+
+            #if EE_DEVELOPMENT_TOOLS
+            BenchmarkPoseGlobalTransforms();
+
+            bool const areDeferredTransformWritesEquivalent = EntityModel::SpatialTransformQueue::ValidateDeferredWrites();
+            std::cout << "Deferred Transform Writes - " << ( areDeferredTransformWritesEquivalent ? "Equivalent" : "NOT EQUIVALENT" ) << std::endl;
+            #endif
+        }
+
         TypeSystem::TypeRegistry typeRegistry;
         AutoGenerated::Tools::RegisterTypes( typeRegistry );
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/AI/Components/Component_AI.h"
+#include "Engine/AI/Components/Component_AISpawn.h"
 #include "System/Types/IDVector.h"
 
 //-------------------------------------------------------------------------
@@ -18,13 +20,14 @@ namespace EE::AI
 
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( AIManager, RequiresUpdate( UpdateStage::PrePhysics ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( AIManager, RequiresUpdate( UpdateStage::PrePhysics ), ReadsData<AISpawnComponent>(), WritesData<AIComponent>() );
 
     private:
 
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool IsWorldLocal() const override { return true; }
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
         bool TrySpawnAI( EntityWorldUpdateContext const& ctx );
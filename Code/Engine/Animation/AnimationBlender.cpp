@@ -39,7 +39,9 @@ namespace EE::Animation
         }
         else // Blend
         {
-            int32_t const numBones = pResultPose->GetNumBones();
+            EE_ASSERT( pSourcePose->GetNumActiveBones() >= pResultPose->GetNumActiveBones() && pTargetPose->GetNumActiveBones() >= pResultPose->GetNumActiveBones() );
+
+            int32_t const numBones = pResultPose->GetNumActiveBones();
             for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
             {
                 Transform const& sourceTransform = pSourcePose->GetTransform( boneIdx );
@@ -69,7 +71,9 @@ namespace EE::Animation
         EE_ASSERT( pBoneMask != nullptr );
         EE_ASSERT( pBoneMask->GetNumWeights() == pSourcePose->GetSkeleton()->GetNumBones() );
 
-        int32_t const numBones = pResultPose->GetNumBones();
+        EE_ASSERT( pSourcePose->GetNumActiveBones() >= pResultPose->GetNumActiveBones() && pTargetPose->GetNumActiveBones() >= pResultPose->GetNumActiveBones() );
+
+        int32_t const numBones = pResultPose->GetNumActiveBones();
         for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx++ )
         {
             // If the bone has been masked out
@@ -134,7 +138,9 @@ namespace EE::Animation
         //-------------------------------------------------------------------------
 
         auto const& parentIndices = pSourcePose->GetSkeleton()->GetParentBoneIndices();
-        auto const numBones = pResultPose->GetNumBones();
+        EE_ASSERT( pSourcePose->GetNumActiveBones() >= pResultPose->GetNumActiveBones() && pTargetPose->GetNumActiveBones() >= pResultPose->GetNumActiveBones() );
+
+        auto const numBones = pResultPose->GetNumActiveBones();
         for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
         {
             // Use the source local pose for masked out bones
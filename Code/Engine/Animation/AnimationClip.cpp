@@ -16,6 +16,29 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        // Only sample the bones for the pose's current LOD
+        int32_t const numBones = pOutPose->GetNumActiveBones();
+        Transform* pOutTransforms = pOutPose->m_localTransforms.data();
+        for ( int32_t boneIdx = 0; boneIdx < numBones; boneIdx += 4 )
+        {
+            ReadCompressedTrackTransformBatch( boneIdx, Math::Min( 4, numBones - boneIdx ), frameTime, &pOutTransforms[boneIdx] );
+        }
+
+        // Flag the pose as being set
+        pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
+    }
+
+    #if EE_DEVELOPMENT_TOOLS
+    void AnimationClip::GetPoseUnbatched( FrameTime const& frameTime, Pose* pOutPose ) const
+    {
+        EE_ASSERT( IsValid() );
+        EE_ASSERT( pOutPose != nullptr && pOutPose->GetSkeleton() == m_skeleton.GetPtr() );
+        EE_ASSERT( frameTime.GetFrameIndex() < m_numFrames );
+
+        pOutPose->ClearGlobalTransforms();
+
+        //-------------------------------------------------------------------------
+
         Transform boneTransform;
         uint16_t const* pTrackData = m_compressedPoseData.data();
 
@@ -42,6 +65,169 @@ namespace EE::Animation
         // Flag the pose as being set
         pOutPose->m_state = m_isAdditive ? Pose::State::AdditivePose : Pose::State::Pose;
     }
+    #endif
+
+    //-------------------------------------------------------------------------
+
+    void AnimationClip::ReadCompressedTrackTransformBatch( int32_t firstTrackIdx, int32_t numTracks, FrameTime const& frameTime, Transform* pOutTransforms ) const
+    {
+        EE_ASSERT( numTracks > 0 && numTracks <= 4 );
+        EE_ASSERT( ( firstTrackIdx + numTracks ) <= m_trackCompressionSettings.size() );
+
+        static constexpr uint32_t const rotationStride = 3;
+        static constexpr uint32_t const translationStride = 3;
+        static constexpr uint32_t const scaleStride = 1;
+
+        uint32_t const frameIdx = frameTime.GetFrameIndex();
+        bool const shouldInterpolate = !frameTime.IsExactlyAtKeyFrame();
+        EE_ASSERT( frameIdx < GetNumFrames() );
+        EE_ASSERT( !shouldInterpolate || ( frameIdx + 1 ) < GetNumFrames() );
+
+        // Gather the encoded key-frame data for each track into lanes
+        //-------------------------------------------------------------------------
+        // Unused lanes just duplicate the last valid track so that we never decode garbage
+
+        alignas( 16 ) int32_t rotation0[3][4], rotation1[3][4];
+        alignas( 16 ) int32_t translation0[3][4], translation1[3][4];
+        alignas( 16 ) int32_t scale0[4], scale1[4];
+        alignas( 16 ) float translationRangeStart[3][4], translationRangeLength[3][4];
+        alignas( 16 ) float scaleRangeStart[4], scaleRangeLength[4];
+
+        for ( int32_t lane = 0; lane < 4; lane++ )
+        {
+            int32_t const trackIdx = firstTrackIdx + Math::Min( lane, numTracks - 1 );
+            TrackCompressionSettings const& trackSettings = m_trackCompressionSettings[trackIdx];
+            uint16_t const* pTrackData = m_compressedPoseData.data() + trackSettings.m_trackStartIndex;
+
+            // Rotation
+            uint16_t const* pRotation0 = pTrackData + ( frameIdx * rotationStride );
+            uint16_t const* pRotation1 = shouldInterpolate ? pRotation0 + rotationStride : pRotation0;
+            pTrackData += ( m_numFrames * rotationStride );
+
+            // Translation
+            uint16_t const* pTranslation0 = pTrackData;
+            uint16_t const* pTranslation1 = pTrackData;
+            if ( trackSettings.IsTranslationTrackStatic() )
+            {
+                pTrackData += translationStride;
+            }
+            else
+            {
+                pTranslation0 += ( frameIdx * translationStride );
+                pTranslation1 = shouldInterpolate ? pTranslation0 + translationStride : pTranslation0;
+                pTrackData += ( m_numFrames * translationStride );
+            }
+
+            // Scale
+            uint16_t const* pScale0 = pTrackData;
+            uint16_t const* pScale1 = pTrackData;
+            if ( !trackSettings.IsScaleTrackStatic() )
+            {
+                pScale0 += ( frameIdx * scaleStride );
+                pScale1 = shouldInterpolate ? pScale0 + scaleStride : pScale0;
+            }
+
+            //-------------------------------------------------------------------------
+
+            for ( int32_t i = 0; i < 3; i++ )
+            {
+                rotation0[i][lane] = pRotation0[i];
+                rotation1[i][lane] = pRotation1[i];
+                translation0[i][lane] = pTranslation0[i];
+                translation1[i][lane] = pTranslation1[i];
+            }
+
+            scale0[lane] = pScale0[0];
+            scale1[lane] = pScale1[0];
+
+            translationRangeStart[0][lane] = trackSettings.m_translationRangeX.m_rangeStart;
+            translationRangeStart[1][lane] = trackSettings.m_translationRangeY.m_rangeStart;
+            translationRangeStart[2][lane] = trackSettings.m_translationRangeZ.m_rangeStart;
+            translationRangeLength[0][lane] = trackSettings.m_translationRangeX.m_rangeLength;
+            translationRangeLength[1][lane] = trackSettings.m_translationRangeY.m_rangeLength;
+            translationRangeLength[2][lane] = trackSettings.m_translationRangeZ.m_rangeLength;
+            scaleRangeStart[lane] = trackSettings.m_scaleRange.m_rangeStart;
+            scaleRangeLength[lane] = trackSettings.m_scaleRange.m_rangeLength;
+        }
+
+        auto LoadLanes = [] ( int32_t const* pLanes ) { return _mm_load_si128( reinterpret_cast<__m128i const*>( pLanes ) ); };
+
+        // Decode first key-frame
+        //-------------------------------------------------------------------------
+
+        __m128 qx, qy, qz, qw;
+        Quantization::EncodedQuaternion::ToQuaternion4( LoadLanes( rotation0[0] ), LoadLanes( rotation0[1] ), LoadLanes( rotation0[2] ), qx, qy, qz, qw );
+
+        __m128 tx = Quantization::DecodeFloat4( LoadLanes( translation0[0] ), _mm_load_ps( translationRangeStart[0] ), _mm_load_ps( translationRangeLength[0] ) );
+        __m128 ty = Quantization::DecodeFloat4( LoadLanes( translation0[1] ), _mm_load_ps( translationRangeStart[1] ), _mm_load_ps( translationRangeLength[1] ) );
+        __m128 tz = Quantization::DecodeFloat4( LoadLanes( translation0[2] ), _mm_load_ps( translationRangeStart[2] ), _mm_load_ps( translationRangeLength[2] ) );
+        __m128 s = Quantization::DecodeFloat4( LoadLanes( scale0 ), _mm_load_ps( scaleRangeStart ), _mm_load_ps( scaleRangeLength ) );
+
+        // Decode second key-frame and interpolate
+        //-------------------------------------------------------------------------
+
+        if ( shouldInterpolate )
+        {
+            __m128 q1x, q1y, q1z, q1w;
+            Quantization::EncodedQuaternion::ToQuaternion4( LoadLanes( rotation1[0] ), LoadLanes( rotation1[1] ), LoadLanes( rotation1[2] ), q1x, q1y, q1z, q1w );
+
+            __m128 const t1x = Quantization::DecodeFloat4( LoadLanes( translation1[0] ), _mm_load_ps( translationRangeStart[0] ), _mm_load_ps( translationRangeLength[0] ) );
+            __m128 const t1y = Quantization::DecodeFloat4( LoadLanes( translation1[1] ), _mm_load_ps( translationRangeStart[1] ), _mm_load_ps( translationRangeLength[1] ) );
+            __m128 const t1z = Quantization::DecodeFloat4( LoadLanes( translation1[2] ), _mm_load_ps( translationRangeStart[2] ), _mm_load_ps( translationRangeLength[2] ) );
+            __m128 const s1 = Quantization::DecodeFloat4( LoadLanes( scale1 ), _mm_load_ps( scaleRangeStart ), _mm_load_ps( scaleRangeLength ) );
+
+            __m128 const t = _mm_set1_ps( frameTime.GetPercentageThrough().ToFloat() );
+            __m128 const oneMinusT = _mm_sub_ps( Vector::One, t );
+
+            // Slerp rotations, this matches Quaternion::SLerp but operates on 4 different quaternion pairs at once
+            static __m128 const oneMinusEpsilon = { 1.0f - 0.00001f, 1.0f - 0.00001f, 1.0f - 0.00001f, 1.0f - 0.00001f };
+
+            __m128 cosOmega = _mm_add_ps( _mm_add_ps( _mm_mul_ps( qx, q1x ), _mm_mul_ps( qy, q1y ) ), _mm_add_ps( _mm_mul_ps( qz, q1z ), _mm_mul_ps( qw, q1w ) ) );
+            __m128 const isNegativeDot = _mm_cmplt_ps( cosOmega, _mm_setzero_ps() );
+            __m128 const sign = _mm_or_ps( _mm_andnot_ps( isNegativeDot, Vector::One ), _mm_and_ps( isNegativeDot, Vector::NegativeOne ) );
+            cosOmega = _mm_mul_ps( cosOmega, sign );
+
+            __m128 const useSlerp = _mm_cmplt_ps( cosOmega, oneMinusEpsilon );
+            __m128 const sinOmega = _mm_sqrt_ps( _mm_sub_ps( Vector::One, _mm_mul_ps( cosOmega, cosOmega ) ) );
+            Vector const omega = Vector::ATan2( sinOmega, cosOmega );
+
+            __m128 const slerpWeight0 = _mm_div_ps( Vector::Sin( _mm_mul_ps( oneMinusT, omega ) ), sinOmega );
+            __m128 const slerpWeight1 = _mm_div_ps( Vector::Sin( _mm_mul_ps( t, omega ) ), sinOmega );
+            __m128 const weight0 = _mm_or_ps( _mm_andnot_ps( useSlerp, oneMinusT ), _mm_and_ps( useSlerp, slerpWeight0 ) );
+            __m128 const weight1 = _mm_mul_ps( _mm_or_ps( _mm_andnot_ps( useSlerp, t ), _mm_and_ps( useSlerp, slerpWeight1 ) ), sign );
+
+            qx = _mm_add_ps( _mm_mul_ps( qx, weight0 ), _mm_mul_ps( q1x, weight1 ) );
+            qy = _mm_add_ps( _mm_mul_ps( qy, weight0 ), _mm_mul_ps( q1y, weight1 ) );
+            qz = _mm_add_ps( _mm_mul_ps( qz, weight0 ), _mm_mul_ps( q1z, weight1 ) );
+            qw = _mm_add_ps( _mm_mul_ps( qw, weight0 ), _mm_mul_ps( q1w, weight1 ) );
+
+            // Lerp translation and scale
+            tx = _mm_add_ps( tx, _mm_mul_ps( _mm_sub_ps( t1x, tx ), t ) );
+            ty = _mm_add_ps( ty, _mm_mul_ps( _mm_sub_ps( t1y, ty ), t ) );
+            tz = _mm_add_ps( tz, _mm_mul_ps( _mm_sub_ps( t1z, tz ), t ) );
+            s = _mm_add_ps( s, _mm_mul_ps( _mm_sub_ps( s1, s ), t ) );
+        }
+
+        // Transpose back into transforms
+        //-------------------------------------------------------------------------
+
+        __m128 tw = _mm_setzero_ps();
+        _MM_TRANSPOSE4_PS( qx, qy, qz, qw );
+        _MM_TRANSPOSE4_PS( tx, ty, tz, tw );
+
+        __m128 const rotations[4] = { qx, qy, qz, qw };
+        __m128 const translations[4] = { tx, ty, tz, tw };
+
+        alignas( 16 ) float scales[4];
+        _mm_store_ps( scales, s );
+
+        for ( int32_t lane = 0; lane < numTracks; lane++ )
+        {
+            pOutTransforms[lane] = Transform( Quaternion( Vector( rotations[lane] ) ), Vector( translations[lane] ), scales[lane] );
+        }
+    }
+
+    //-------------------------------------------------------------------------
 
     Transform AnimationClip::GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const
     {
@@ -131,6 +131,11 @@ namespace EE::Animation
         void GetPose( FrameTime const& frameTime, Pose* pOutPose ) const;
         inline void GetPose( Percentage percentageThrough, Pose* pOutPose ) const { GetPose( GetFrameTime( percentageThrough ), pOutPose ); }
 
+        #if EE_DEVELOPMENT_TOOLS
+        // Sample the pose one track at a time, this is the reference implementation for the batched sampling in GetPose
+        void GetPoseUnbatched( FrameTime const& frameTime, Pose* pOutPose ) const;
+        #endif
+
         Transform GetLocalSpaceTransform( int32_t boneIdx, FrameTime const& frameTime ) const;
         inline Transform GetLocalSpaceTransform( int32_t boneIdx, Percentage percentageThrough ) const{ return GetLocalSpaceTransform( boneIdx, GetFrameTime( percentageThrough ) ); }
 
@@ -197,6 +202,9 @@ namespace EE::Animation
         inline uint16_t const* ReadCompressedTrackTransform( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, FrameTime const& frameTime, Transform& outTransform ) const;
         inline uint16_t const* ReadCompressedTrackKeyFrame( uint16_t const* pTrackData, TrackCompressionSettings const& trackSettings, uint32_t frameIdx, Transform& outTransform ) const;
 
+        // Decode and interpolate up to 4 tracks at once, writing the results directly into the output transforms
+        void ReadCompressedTrackTransformBatch( int32_t firstTrackIdx, int32_t numTracks, FrameTime const& frameTime, Transform* pOutTransforms ) const;
+
     private:
 
         TResourcePtr<Skeleton>                  m_skeleton;
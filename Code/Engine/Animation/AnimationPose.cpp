@@ -1,4 +1,5 @@
 #include "AnimationPose.h"
+#include "AnimationPoseSoA.h"
 #include "System/Drawing/DebugDrawing.h"
 
 //-------------------------------------------------------------------------
@@ -8,6 +9,7 @@ namespace EE::Animation
     Pose::Pose( Skeleton const* pSkeleton, Type initialState )
         : m_pSkeleton( pSkeleton )
         , m_localTransforms( pSkeleton->GetNumBones() )
+        , m_numActiveBones( pSkeleton->GetNumBones() )
     {
         EE_ASSERT( pSkeleton != nullptr );
         Reset( initialState );
@@ -25,6 +27,8 @@ namespace EE::Animation
         m_localTransforms.swap( rhs.m_localTransforms );
         m_globalTransforms.swap( rhs.m_globalTransforms );
         m_state = rhs.m_state;
+        m_numActiveBones = rhs.m_numActiveBones;
+        m_LOD = rhs.m_LOD;
 
         return *this;
     }
@@ -35,6 +39,26 @@ namespace EE::Animation
         m_localTransforms = rhs.m_localTransforms;
         m_globalTransforms = rhs.m_globalTransforms;
         m_state = rhs.m_state;
+        m_numActiveBones = rhs.m_numActiveBones;
+        m_LOD = rhs.m_LOD;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void Pose::SetLOD( int32_t lodIdx )
+    {
+        EE_ASSERT( lodIdx >= 0 && lodIdx < m_pSkeleton->GetNumLODs() );
+        int32_t const numPreviouslyActiveBones = m_numActiveBones;
+        m_LOD = lodIdx;
+        m_numActiveBones = m_pSkeleton->GetNumBonesForLOD( lodIdx );
+        m_globalTransforms.clear();
+
+        // Newly activated bones still have whatever local transforms they had when they were last active, so reset them to the reference pose
+        auto const& referencePose = m_pSkeleton->GetLocalReferencePose();
+        for ( auto boneIdx = numPreviouslyActiveBones; boneIdx < m_numActiveBones; boneIdx++ )
+        {
+            m_localTransforms[boneIdx] = referencePose[boneIdx];
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -100,22 +124,46 @@ namespace EE::Animation
     //-------------------------------------------------------------------------
 
     void Pose::CalculateGlobalTransforms()
+    {
+        if ( m_pSkeleton->GetNumHierarchyLevels() > 0 && m_pSkeleton->GetNumBones() <= PoseSoA::s_maxBonesForBatchedSolve )
+        {
+            PoseSoA::CalculateGlobalTransforms( *this, m_globalTransforms );
+        }
+        else
+        {
+            CalculateGlobalTransformsSerial();
+        }
+    }
+
+    void Pose::CalculateGlobalTransformsSerial()
     {
         int32_t const numBones = m_pSkeleton->GetNumBones();
         m_globalTransforms.resize( numBones );
 
         m_globalTransforms[0] = m_localTransforms[0];
-        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        for ( auto boneIdx = 1; boneIdx < m_numActiveBones; boneIdx++ )
         {
             int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
             m_globalTransforms[boneIdx] = m_localTransforms[boneIdx] * m_globalTransforms[parentIdx];
         }
+
+        // Inactive bones are held at the reference pose - parents are always before their children so the parent global transform is already set
+        auto const& referencePose = m_pSkeleton->GetLocalReferencePose();
+        for ( auto boneIdx = m_numActiveBones; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = m_pSkeleton->GetParentBoneIndex( boneIdx );
+            m_globalTransforms[boneIdx] = referencePose[boneIdx] * m_globalTransforms[parentIdx];
+        }
     }
 
     Transform Pose::GetGlobalTransform( int32_t boneIdx ) const
     {
         EE_ASSERT( boneIdx < m_pSkeleton->GetNumBones() );
 
+        // Inactive bones are held at the reference pose
+        auto const& referencePose = m_pSkeleton->GetLocalReferencePose();
+        auto GetLocalTransform = [this, &referencePose] ( int32_t idx ) { return ( idx < m_numActiveBones ) ? m_localTransforms[idx] : referencePose[idx]; };
+
         Transform boneGlobalTransform;
         if ( !m_globalTransforms.empty() )
         {
@@ -135,17 +183,17 @@ namespace EE::Animation
             }
 
             // If we have parents
-            boneGlobalTransform = m_localTransforms[boneIdx];
+            boneGlobalTransform = GetLocalTransform( boneIdx );
             if ( nextEntry > 0 )
             {
                 // Calculate global transform of parent
                 int32_t arrayIdx = nextEntry - 1;
                 parentIdx = boneParents[arrayIdx--];
-                auto parentGlobalTransform = m_localTransforms[parentIdx];
+                auto parentGlobalTransform = GetLocalTransform( parentIdx );
                 for ( ; arrayIdx >= 0; arrayIdx-- )
                 {
                     int32_t const nextIdx = boneParents[arrayIdx];
-                    auto const nextTransform = m_localTransforms[nextIdx];
+                    auto const nextTransform = GetLocalTransform( nextIdx );
                     parentGlobalTransform = nextTransform * parentGlobalTransform;
                 }
 
@@ -55,6 +55,16 @@ namespace EE::Animation
         inline int32_t GetNumBones() const { return m_pSkeleton->GetNumBones(); }
         inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
 
+        // LOD
+        //-------------------------------------------------------------------------
+        // Only the first N bones (as specified by the skeleton LOD) are sampled, blended and have their global transforms calculated
+        // Bones outside of the active LOD are not updated and are held at their reference pose (local) relative to their closest active ancestor
+
+        inline int32_t GetLOD() const { return m_LOD; }
+        void SetLOD( int32_t lodIdx );
+        inline int32_t GetNumActiveBones() const { return m_numActiveBones; }
+        inline bool IsBoneActive( int32_t boneIdx ) const { return boneIdx < m_numActiveBones; }
+
         // Pose state
         //-------------------------------------------------------------------------
 
@@ -111,7 +121,13 @@ namespace EE::Animation
         inline bool HasGlobalTransforms() const { return !m_globalTransforms.empty(); }
         inline void ClearGlobalTransforms() { m_globalTransforms.clear(); }
         inline TVector<Transform> const& GetGlobalTransforms() const { return m_globalTransforms; }
+
+        // Calculate the global transforms for all bones, this uses the batched structure-of-arrays solve (see PoseSoA) whenever the skeleton supports it
         void CalculateGlobalTransforms();
+
+        // Calculate the global transforms one bone at a time, this is the reference implementation for the batched solve
+        void CalculateGlobalTransformsSerial();
+
         Transform GetGlobalTransform( int32_t boneIdx ) const;
 
         // Debug
@@ -142,5 +158,7 @@ namespace EE::Animation
         TVector<Transform>          m_localTransforms;          // Parent-space transforms
         TVector<Transform>          m_globalTransforms;         // Character-space transforms
         State                       m_state = State::Unset;     // Pose state
+        int32_t                     m_numActiveBones = 0;       // The number of bones updated for the current LOD
+        int32_t                     m_LOD = 0;                  // The skeleton LOD this pose is using
     };
 }
\ No newline at end of file
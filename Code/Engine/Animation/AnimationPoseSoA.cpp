@@ -0,0 +1,318 @@
+#include "AnimationPoseSoA.h"
+#include "System/Math/SIMD.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Animation
+{
+    void PoseSoA::TransformStreams::Bind( float* pData, int32_t numPaddedElements )
+    {
+        EE_ASSERT( pData != nullptr && numPaddedElements > 0 );
+        m_pRotationX = pData;
+        m_pRotationY = m_pRotationX + numPaddedElements;
+        m_pRotationZ = m_pRotationY + numPaddedElements;
+        m_pRotationW = m_pRotationZ + numPaddedElements;
+        m_pTranslationX = m_pRotationW + numPaddedElements;
+        m_pTranslationY = m_pTranslationX + numPaddedElements;
+        m_pTranslationZ = m_pTranslationY + numPaddedElements;
+        m_pScale = m_pTranslationZ + numPaddedElements;
+    }
+
+    Transform PoseSoA::TransformStreams::Read( int32_t sortedIdx ) const
+    {
+        Quaternion const rotation( m_pRotationX[sortedIdx], m_pRotationY[sortedIdx], m_pRotationZ[sortedIdx], m_pRotationW[sortedIdx] );
+        Vector const translation( m_pTranslationX[sortedIdx], m_pTranslationY[sortedIdx], m_pTranslationZ[sortedIdx], 0.0f );
+        return Transform( rotation, translation, m_pScale[sortedIdx] );
+    }
+
+    void PoseSoA::TransformStreams::Write( int32_t sortedIdx, Transform const& transform )
+    {
+        Quaternion const& rotation = transform.GetRotation();
+        m_pRotationX[sortedIdx] = rotation.m_x;
+        m_pRotationY[sortedIdx] = rotation.m_y;
+        m_pRotationZ[sortedIdx] = rotation.m_z;
+        m_pRotationW[sortedIdx] = rotation.m_w;
+
+        Vector const& translation = transform.GetTranslation();
+        m_pTranslationX[sortedIdx] = translation.m_x;
+        m_pTranslationY[sortedIdx] = translation.m_y;
+        m_pTranslationZ[sortedIdx] = translation.m_z;
+
+        m_pScale[sortedIdx] = transform.GetScale();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void PoseSoA::CalculateGlobalTransforms( Pose const& pose, TVector<Transform>& outGlobalTransforms )
+    {
+        Skeleton const* pSkeleton = pose.GetSkeleton();
+        int32_t const numBones = pSkeleton->GetNumBones();
+        EE_ASSERT( numBones <= s_maxBonesForBatchedSolve && pSkeleton->GetNumHierarchyLevels() > 0 );
+
+        // Use stack memory for the streams since this is called for every pose that needs its global transforms
+        int32_t const numPaddedElements = GetNumPaddedElements( numBones );
+        int32_t const numStreamElements = numPaddedElements * TransformStreams::s_numStreams;
+        float* pLocalData = EE_STACK_ARRAY_ALLOC( float, numStreamElements );
+        float* pGlobalData = EE_STACK_ARRAY_ALLOC( float, numStreamElements );
+
+        TransformStreams local;
+        local.Bind( pLocalData, numPaddedElements );
+        InitializeStreams( local, numPaddedElements );
+
+        TransformStreams global;
+        global.Bind( pGlobalData, numPaddedElements );
+        InitializeStreams( global, numPaddedElements );
+
+        CopyLocalTransforms( pose, local );
+        SolveGlobalTransforms( pSkeleton, local, global );
+        CopyGlobalTransforms( pSkeleton, global, outGlobalTransforms );
+    }
+
+    //-------------------------------------------------------------------------
+
+    PoseSoA::PoseSoA( Skeleton const* pSkeleton )
+        : m_pSkeleton( pSkeleton )
+    {
+        EE_ASSERT( pSkeleton != nullptr );
+
+        int32_t const numBones = m_pSkeleton->GetNumBones();
+        int32_t const numPaddedElements = GetNumPaddedElements( numBones );
+
+        m_localData.resize( numPaddedElements * TransformStreams::s_numStreams );
+        m_local.Bind( m_localData.data(), numPaddedElements );
+        InitializeStreams( m_local, numPaddedElements );
+
+        m_globalData.resize( numPaddedElements * TransformStreams::s_numStreams );
+        m_global.Bind( m_globalData.data(), numPaddedElements );
+        InitializeStreams( m_global, numPaddedElements );
+
+        auto const& depthSortedBoneIndices = m_pSkeleton->GetDepthSortedBoneIndices();
+        m_boneToSortedIndices.resize( numBones );
+        for ( auto i = 0; i < numBones; i++ )
+        {
+            m_boneToSortedIndices[depthSortedBoneIndices[i]] = i;
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto const& referencePose = m_pSkeleton->GetLocalReferencePose();
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            m_local.Write( m_boneToSortedIndices[boneIdx], referencePose[boneIdx] );
+        }
+    }
+
+    void PoseSoA::CopyFrom( Pose const& pose )
+    {
+        EE_ASSERT( pose.GetSkeleton() == m_pSkeleton );
+        CopyLocalTransforms( pose, m_local );
+        m_hasGlobalTransforms = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    Transform PoseSoA::GetTransform( int32_t boneIdx ) const
+    {
+        EE_ASSERT( boneIdx >= 0 && boneIdx < GetNumBones() );
+        return m_local.Read( m_boneToSortedIndices[boneIdx] );
+    }
+
+    void PoseSoA::SetTransform( int32_t boneIdx, Transform const& transform )
+    {
+        EE_ASSERT( boneIdx >= 0 && boneIdx < GetNumBones() );
+        m_local.Write( m_boneToSortedIndices[boneIdx], transform );
+        m_hasGlobalTransforms = false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void PoseSoA::CalculateGlobalTransforms()
+    {
+        SolveGlobalTransforms( m_pSkeleton, m_local, m_global );
+        m_hasGlobalTransforms = true;
+    }
+
+    Transform PoseSoA::GetGlobalTransform( int32_t boneIdx ) const
+    {
+        EE_ASSERT( m_hasGlobalTransforms );
+        EE_ASSERT( boneIdx >= 0 && boneIdx < GetNumBones() );
+        return m_global.Read( m_boneToSortedIndices[boneIdx] );
+    }
+
+    void PoseSoA::GetGlobalTransforms( TVector<Transform>& outGlobalTransforms ) const
+    {
+        EE_ASSERT( m_hasGlobalTransforms );
+        CopyGlobalTransforms( m_pSkeleton, m_global, outGlobalTransforms );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void PoseSoA::InitializeStreams( TransformStreams& streams, int32_t numPaddedElements )
+    {
+        // Everything starts as identity so that the padding elements never produce invalid values
+        for ( auto i = 0; i < numPaddedElements; i++ )
+        {
+            streams.m_pRotationX[i] = 0.0f;
+            streams.m_pRotationY[i] = 0.0f;
+            streams.m_pRotationZ[i] = 0.0f;
+            streams.m_pRotationW[i] = 1.0f;
+            streams.m_pTranslationX[i] = 0.0f;
+            streams.m_pTranslationY[i] = 0.0f;
+            streams.m_pTranslationZ[i] = 0.0f;
+            streams.m_pScale[i] = 1.0f;
+        }
+    }
+
+    void PoseSoA::CopyLocalTransforms( Pose const& pose, TransformStreams& outLocal )
+    {
+        Skeleton const* pSkeleton = pose.GetSkeleton();
+        auto const& depthSortedBoneIndices = pSkeleton->GetDepthSortedBoneIndices();
+        auto const& localTransforms = pose.GetTransforms();
+        auto const& referencePose = pSkeleton->GetLocalReferencePose();
+
+        // Bones outside of the active LOD are held at the reference pose
+        int32_t const numBones = pSkeleton->GetNumBones();
+        for ( auto sortedIdx = 0; sortedIdx < numBones; sortedIdx++ )
+        {
+            int32_t const boneIdx = depthSortedBoneIndices[sortedIdx];
+            outLocal.Write( sortedIdx, pose.IsBoneActive( boneIdx ) ? localTransforms[boneIdx] : referencePose[boneIdx] );
+        }
+    }
+
+    void PoseSoA::CopyGlobalTransforms( Skeleton const* pSkeleton, TransformStreams const& global, TVector<Transform>& outGlobalTransforms )
+    {
+        auto const& depthSortedBoneIndices = pSkeleton->GetDepthSortedBoneIndices();
+
+        int32_t const numBones = pSkeleton->GetNumBones();
+        outGlobalTransforms.resize( numBones );
+        for ( auto sortedIdx = 0; sortedIdx < numBones; sortedIdx++ )
+        {
+            outGlobalTransforms[depthSortedBoneIndices[sortedIdx]] = global.Read( sortedIdx );
+        }
+    }
+
+    void PoseSoA::SolveGlobalTransforms( Skeleton const* pSkeleton, TransformStreams const& local, TransformStreams& global )
+    {
+        int32_t const numLevels = pSkeleton->GetNumHierarchyLevels();
+        if ( numLevels <= 0 )
+        {
+            return;
+        }
+
+        // Root level bones have no parents
+        //-------------------------------------------------------------------------
+
+        int32_t const rootLevelEnd = pSkeleton->GetHierarchyLevelOffset( 1 );
+        for ( auto i = 0; i < rootLevelEnd; i++ )
+        {
+            global.Write( i, local.Read( i ) );
+        }
+
+        // Solve each level in batches
+        //-------------------------------------------------------------------------
+        // The last batch in a level may overrun into the next level (or the padding), those results are discarded since the next level overwrites them
+        // Lanes past the last bone use the parent of the last bone, since that is always a valid (non-root) parent
+
+        int32_t const* pParentIndices = pSkeleton->GetDepthSortedParentIndices().data();
+        int32_t const lastBoneIdx = pSkeleton->GetNumBones() - 1;
+
+        __m128 const two = _mm_set1_ps( 2.0f );
+
+        for ( auto levelIdx = 1; levelIdx < numLevels; levelIdx++ )
+        {
+            int32_t const levelStart = pSkeleton->GetHierarchyLevelOffset( levelIdx );
+            int32_t const levelEnd = pSkeleton->GetHierarchyLevelOffset( levelIdx + 1 );
+
+            for ( int32_t batchStart = levelStart; batchStart < levelEnd; batchStart += s_batchSize )
+            {
+                int32_t const p0 = pParentIndices[batchStart];
+                int32_t const p1 = pParentIndices[Math::Min( batchStart + 1, lastBoneIdx )];
+                int32_t const p2 = pParentIndices[Math::Min( batchStart + 2, lastBoneIdx )];
+                int32_t const p3 = pParentIndices[Math::Min( batchStart + 3, lastBoneIdx )];
+
+                // Load local transforms
+                //-------------------------------------------------------------------------
+
+                __m128 const lqx = _mm_loadu_ps( &local.m_pRotationX[batchStart] );
+                __m128 const lqy = _mm_loadu_ps( &local.m_pRotationY[batchStart] );
+                __m128 const lqz = _mm_loadu_ps( &local.m_pRotationZ[batchStart] );
+                __m128 const lqw = _mm_loadu_ps( &local.m_pRotationW[batchStart] );
+                __m128 const ltx = _mm_loadu_ps( &local.m_pTranslationX[batchStart] );
+                __m128 const lty = _mm_loadu_ps( &local.m_pTranslationY[batchStart] );
+                __m128 const ltz = _mm_loadu_ps( &local.m_pTranslationZ[batchStart] );
+                __m128 const ls = _mm_loadu_ps( &local.m_pScale[batchStart] );
+
+                // Gather parent global transforms
+                //-------------------------------------------------------------------------
+
+                __m128 const pqx = _mm_set_ps( global.m_pRotationX[p3], global.m_pRotationX[p2], global.m_pRotationX[p1], global.m_pRotationX[p0] );
+                __m128 const pqy = _mm_set_ps( global.m_pRotationY[p3], global.m_pRotationY[p2], global.m_pRotationY[p1], global.m_pRotationY[p0] );
+                __m128 const pqz = _mm_set_ps( global.m_pRotationZ[p3], global.m_pRotationZ[p2], global.m_pRotationZ[p1], global.m_pRotationZ[p0] );
+                __m128 const pqw = _mm_set_ps( global.m_pRotationW[p3], global.m_pRotationW[p2], global.m_pRotationW[p1], global.m_pRotationW[p0] );
+                __m128 const ptx = _mm_set_ps( global.m_pTranslationX[p3], global.m_pTranslationX[p2], global.m_pTranslationX[p1], global.m_pTranslationX[p0] );
+                __m128 const pty = _mm_set_ps( global.m_pTranslationY[p3], global.m_pTranslationY[p2], global.m_pTranslationY[p1], global.m_pTranslationY[p0] );
+                __m128 const ptz = _mm_set_ps( global.m_pTranslationZ[p3], global.m_pTranslationZ[p2], global.m_pTranslationZ[p1], global.m_pTranslationZ[p0] );
+                __m128 const ps = _mm_set_ps( global.m_pScale[p3], global.m_pScale[p2], global.m_pScale[p1], global.m_pScale[p0] );
+
+                // Negative scale requires the matrix path, so fall back to the scalar transform multiply for this batch
+                //-------------------------------------------------------------------------
+
+                int32_t const numValidBones = Math::Min( s_batchSize, levelEnd - batchStart );
+                int32_t const validLaneMask = ( 1 << numValidBones ) - 1;
+                int32_t const negativeScaleMask = _mm_movemask_ps( _mm_cmplt_ps( _mm_min_ps( ls, ps ), _mm_setzero_ps() ) );
+                if ( ( negativeScaleMask & validLaneMask ) != 0 )
+                {
+                    for ( auto i = batchStart; i < batchStart + numValidBones; i++ )
+                    {
+                        global.Write( i, local.Read( i ) * global.Read( pParentIndices[i] ) );
+                    }
+                    continue;
+                }
+
+                // Rotation: global = local * parent (i.e. the hamilton product parent x local), then normalize
+                //-------------------------------------------------------------------------
+
+                __m128 gqx = _mm_add_ps( _mm_add_ps( _mm_mul_ps( pqw, lqx ), _mm_mul_ps( pqx, lqw ) ), _mm_sub_ps( _mm_mul_ps( pqy, lqz ), _mm_mul_ps( pqz, lqy ) ) );
+                __m128 gqy = _mm_add_ps( _mm_sub_ps( _mm_mul_ps( pqw, lqy ), _mm_mul_ps( pqx, lqz ) ), _mm_add_ps( _mm_mul_ps( pqy, lqw ), _mm_mul_ps( pqz, lqx ) ) );
+                __m128 gqz = _mm_add_ps( _mm_add_ps( _mm_mul_ps( pqw, lqz ), _mm_mul_ps( pqx, lqy ) ), _mm_sub_ps( _mm_mul_ps( pqz, lqw ), _mm_mul_ps( pqy, lqx ) ) );
+                __m128 gqw = _mm_sub_ps( _mm_sub_ps( _mm_mul_ps( pqw, lqw ), _mm_mul_ps( pqx, lqx ) ), _mm_add_ps( _mm_mul_ps( pqy, lqy ), _mm_mul_ps( pqz, lqz ) ) );
+
+                __m128 const lengthSq = _mm_add_ps( _mm_add_ps( _mm_mul_ps( gqx, gqx ), _mm_mul_ps( gqy, gqy ) ), _mm_add_ps( _mm_mul_ps( gqz, gqz ), _mm_mul_ps( gqw, gqw ) ) );
+                __m128 const length = _mm_sqrt_ps( lengthSq );
+                gqx = _mm_div_ps( gqx, length );
+                gqy = _mm_div_ps( gqy, length );
+                gqz = _mm_div_ps( gqz, length );
+                gqw = _mm_div_ps( gqw, length );
+
+                // Translation: global = parent rotation applied to the scaled local translation, offset by the parent translation
+                //-------------------------------------------------------------------------
+
+                __m128 const vx = _mm_mul_ps( ltx, ps );
+                __m128 const vy = _mm_mul_ps( lty, ps );
+                __m128 const vz = _mm_mul_ps( ltz, ps );
+
+                // t = 2 * cross( q.xyz, v )
+                __m128 const tx = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( pqy, vz ), _mm_mul_ps( pqz, vy ) ) );
+                __m128 const ty = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( pqz, vx ), _mm_mul_ps( pqx, vz ) ) );
+                __m128 const tz = _mm_mul_ps( two, _mm_sub_ps( _mm_mul_ps( pqx, vy ), _mm_mul_ps( pqy, vx ) ) );
+
+                // v' = v + q.w * t + cross( q.xyz, t )
+                __m128 const rx = _mm_add_ps( _mm_add_ps( vx, _mm_mul_ps( pqw, tx ) ), _mm_sub_ps( _mm_mul_ps( pqy, tz ), _mm_mul_ps( pqz, ty ) ) );
+                __m128 const ry = _mm_add_ps( _mm_add_ps( vy, _mm_mul_ps( pqw, ty ) ), _mm_sub_ps( _mm_mul_ps( pqz, tx ), _mm_mul_ps( pqx, tz ) ) );
+                __m128 const rz = _mm_add_ps( _mm_add_ps( vz, _mm_mul_ps( pqw, tz ) ), _mm_sub_ps( _mm_mul_ps( pqx, ty ), _mm_mul_ps( pqy, tx ) ) );
+
+                // Store results
+                //-------------------------------------------------------------------------
+
+                _mm_storeu_ps( &global.m_pRotationX[batchStart], gqx );
+                _mm_storeu_ps( &global.m_pRotationY[batchStart], gqy );
+                _mm_storeu_ps( &global.m_pRotationZ[batchStart], gqz );
+                _mm_storeu_ps( &global.m_pRotationW[batchStart], gqw );
+                _mm_storeu_ps( &global.m_pTranslationX[batchStart], _mm_add_ps( rx, ptx ) );
+                _mm_storeu_ps( &global.m_pTranslationY[batchStart], _mm_add_ps( ry, pty ) );
+                _mm_storeu_ps( &global.m_pTranslationZ[batchStart], _mm_add_ps( rz, ptz ) );
+                _mm_storeu_ps( &global.m_pScale[batchStart], _mm_mul_ps( ls, ps ) );
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "AnimationPose.h"
+
+//-------------------------------------------------------------------------
+// Structure-of-arrays pose
+//-------------------------------------------------------------------------
+// An optional pose layout where each transform component is stored in a separate stream (x,y,z,w rotation, x,y,z translation and a uniform scale)
+// Bones are stored in the skeleton's depth sorted order so that each hierarchy level is contiguous
+// This allows us to solve the global transforms for 4 bones at a time since bones within a level do not depend on each other
+// The regular pose uses this solve for its global transforms, see 'Pose::CalculateGlobalTransforms'
+
+namespace EE::Animation
+{
+    class EE_ENGINE_API PoseSoA
+    {
+        constexpr static int32_t const s_batchSize = 4;
+
+        // Views into a contiguous block of floats, each stream is padded so we can always read/write a full batch starting at any bone
+        struct TransformStreams
+        {
+            constexpr static int32_t const s_numStreams = 8;
+
+            void Bind( float* pData, int32_t numPaddedElements );
+            Transform Read( int32_t sortedIdx ) const;
+            void Write( int32_t sortedIdx, Transform const& transform );
+
+            float*                  m_pRotationX = nullptr;
+            float*                  m_pRotationY = nullptr;
+            float*                  m_pRotationZ = nullptr;
+            float*                  m_pRotationW = nullptr;
+            float*                  m_pTranslationX = nullptr;
+            float*                  m_pTranslationY = nullptr;
+            float*                  m_pTranslationZ = nullptr;
+            float*                  m_pScale = nullptr;
+        };
+
+    public:
+
+        // Skeletons with more bones than this will use the serial solve, since the batched solve uses stack memory for its streams
+        constexpr static int32_t const s_maxBonesForBatchedSolve = 1024;
+
+        // Calculate the global transforms for a regular pose using the batched solve, this is equivalent to 'Pose::CalculateGlobalTransformsSerial'
+        static void CalculateGlobalTransforms( Pose const& pose, TVector<Transform>& outGlobalTransforms );
+
+    public:
+
+        PoseSoA( Skeleton const* pSkeleton );
+
+        PoseSoA( PoseSoA const& ) = delete;
+        PoseSoA& operator=( PoseSoA const& ) = delete;
+
+        inline int32_t GetNumBones() const { return m_pSkeleton->GetNumBones(); }
+        inline Skeleton const* GetSkeleton() const { return m_pSkeleton; }
+
+        // Copy the local transforms from a regular pose, bones outside of the pose's active LOD are set to the reference pose
+        void CopyFrom( Pose const& pose );
+
+        // Local Transforms
+        //-------------------------------------------------------------------------
+
+        Transform GetTransform( int32_t boneIdx ) const;
+        void SetTransform( int32_t boneIdx, Transform const& transform );
+
+        // Global Transforms
+        //-------------------------------------------------------------------------
+
+        inline bool HasGlobalTransforms() const { return m_hasGlobalTransforms; }
+        void CalculateGlobalTransforms();
+        Transform GetGlobalTransform( int32_t boneIdx ) const;
+
+        // Write out the global transforms in the regular skeleton bone order
+        void GetGlobalTransforms( TVector<Transform>& outGlobalTransforms ) const;
+
+    private:
+
+        PoseSoA() = delete;
+
+        inline static int32_t GetNumPaddedElements( int32_t numBones ) { return numBones + s_batchSize - 1; }
+
+        static void InitializeStreams( TransformStreams& streams, int32_t numPaddedElements );
+        static void CopyLocalTransforms( Pose const& pose, TransformStreams& outLocal );
+        static void SolveGlobalTransforms( Skeleton const* pSkeleton, TransformStreams const& local, TransformStreams& global );
+        static void CopyGlobalTransforms( Skeleton const* pSkeleton, TransformStreams const& global, TVector<Transform>& outGlobalTransforms );
+
+    private:
+
+        Skeleton const*             m_pSkeleton;                    // The skeleton for this pose
+        TVector<int32_t>            m_boneToSortedIndices;          // Mapping from a skeleton bone index to the depth sorted index
+        TVector<float>              m_localData;                    // Storage for the local streams
+        TVector<float>              m_globalData;                   // Storage for the global streams
+        TransformStreams            m_local;                        // Parent-space transforms in depth sorted order
+        TransformStreams            m_global;                       // Character-space transforms in depth sorted order
+        bool                        m_hasGlobalTransforms = false;
+    };
+}
@@ -7,7 +7,7 @@ namespace EE::Animation
 {
     bool Skeleton::IsValid() const
     {
-        return !m_boneIDs.empty() && ( m_boneIDs.size() == m_parentIndices.size() ) && ( m_boneIDs.size() == m_localReferencePose.size() );
+        return !m_boneIDs.empty() && ( m_boneIDs.size() == m_parentIndices.size() ) && ( m_boneIDs.size() == m_localReferencePose.size() ) && !m_LODs.empty() && m_LODs[0].m_numBones == m_boneIDs.size();
     }
 
     Transform Skeleton::GetBoneGlobalTransform( int32_t idx ) const
@@ -26,6 +26,102 @@ namespace EE::Animation
         return boneGlobalTransform;
     }
 
+    int32_t Skeleton::GetLODForDistance( float distance ) const
+    {
+        EE_ASSERT( !m_LODs.empty() );
+
+        int32_t const numLODs = (int32_t) m_LODs.size();
+        for ( auto lodIdx = numLODs - 1; lodIdx > 0; lodIdx-- )
+        {
+            if ( distance >= m_LODs[lodIdx].m_minDistance )
+            {
+                return lodIdx;
+            }
+        }
+
+        return 0;
+    }
+
+    void Skeleton::CalculateDerivedData()
+    {
+        EE_ASSERT( IsValid() );
+
+        // Calculate global reference pose
+        //-------------------------------------------------------------------------
+
+        int32_t const numBones = GetNumBones();
+        m_globalReferencePose.resize( numBones );
+
+        m_globalReferencePose[0] = m_localReferencePose[0];
+        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = GetParentBoneIndex( boneIdx );
+            m_globalReferencePose[boneIdx] = m_localReferencePose[boneIdx] * m_globalReferencePose[parentIdx];
+        }
+
+        // Calculate the hierarchy levels used for batched global transform calculation
+        //-------------------------------------------------------------------------
+
+        CalculateHierarchyLevels();
+    }
+
+    void Skeleton::CalculateHierarchyLevels()
+    {
+        int32_t const numBones = GetNumBones();
+
+        // Calculate the depth of each bone, parents are always listed before their children
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> boneDepths;
+        boneDepths.resize( numBones, 0 );
+
+        int32_t maxDepth = 0;
+        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const parentIdx = m_parentIndices[boneIdx];
+            EE_ASSERT( parentIdx >= 0 && parentIdx < boneIdx );
+            boneDepths[boneIdx] = boneDepths[parentIdx] + 1;
+            maxDepth = Math::Max( maxDepth, boneDepths[boneIdx] );
+        }
+
+        // Calculate level offsets
+        //-------------------------------------------------------------------------
+
+        m_hierarchyLevelOffsets.clear();
+        m_hierarchyLevelOffsets.resize( maxDepth + 2, 0 );
+
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            m_hierarchyLevelOffsets[boneDepths[boneIdx] + 1]++;
+        }
+
+        for ( auto levelIdx = 1; levelIdx < m_hierarchyLevelOffsets.size(); levelIdx++ )
+        {
+            m_hierarchyLevelOffsets[levelIdx] += m_hierarchyLevelOffsets[levelIdx - 1];
+        }
+
+        // Sort bones by depth, keeping the original bone order within each level
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> levelInsertionIndices( m_hierarchyLevelOffsets.begin(), m_hierarchyLevelOffsets.end() - 1 );
+        TVector<int32_t> boneToSortedIndices;
+        boneToSortedIndices.resize( numBones, InvalidIndex );
+
+        m_depthSortedBoneIndices.resize( numBones );
+        m_depthSortedParentIndices.resize( numBones );
+
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            int32_t const sortedIdx = levelInsertionIndices[boneDepths[boneIdx]]++;
+            m_depthSortedBoneIndices[sortedIdx] = boneIdx;
+            boneToSortedIndices[boneIdx] = sortedIdx;
+
+            // Parents have already been sorted since they are always listed before their children
+            int32_t const parentIdx = m_parentIndices[boneIdx];
+            m_depthSortedParentIndices[sortedIdx] = ( parentIdx == InvalidIndex ) ? InvalidIndex : boneToSortedIndices[parentIdx];
+        }
+    }
+
     int32_t Skeleton::GetFirstChildBoneIndex( int32_t boneIdx ) const
     {
         int32_t const numBones = GetNumBones();
@@ -69,6 +165,26 @@ namespace EE::Animation
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
+    void Skeleton::InitializeProcedural( TVector<int32_t> const& parentIndices, TVector<Transform> const& localReferencePose, TVector<LOD> const& LODs )
+    {
+        EE_ASSERT( parentIndices.size() == localReferencePose.size() );
+
+        int32_t const numBones = (int32_t) parentIndices.size();
+        m_boneIDs.clear();
+        for ( auto boneIdx = 0; boneIdx < numBones; boneIdx++ )
+        {
+            m_boneIDs.emplace_back( StringID( String( String::CtorSprintf(), "Bone%d", boneIdx ) ) );
+        }
+
+        m_parentIndices = parentIndices;
+        m_localReferencePose = localReferencePose;
+        m_boneFlags.clear();
+        m_boneFlags.resize( numBones );
+        m_LODs = LODs;
+
+        CalculateDerivedData();
+    }
+
     void Skeleton::DrawDebug( Drawing::DrawContext& ctx, Transform const& worldTransform ) const
     {
         auto const numBones = m_localReferencePose.size();
@@ -25,11 +25,23 @@ namespace EE::Animation
     class EE_ENGINE_API Skeleton : public Resource::IResource
     {
         EE_REGISTER_RESOURCE( 'skel', "Animation Skeleton" );
-        EE_SERIALIZE( m_boneIDs, m_localReferencePose, m_parentIndices, m_boneFlags );
+        EE_SERIALIZE( m_boneIDs, m_localReferencePose, m_parentIndices, m_boneFlags, m_LODs );
 
         friend class SkeletonCompiler;
         friend class SkeletonLoader;
 
+    public:
+
+        // A skeleton LOD updates only the first N bones of the skeleton
+        // Bones are stored in depth sorted order so any prefix of the bone list is a valid sub-hierarchy
+        struct LOD
+        {
+            EE_SERIALIZE( m_numBones, m_minDistance );
+
+            int32_t                         m_numBones = 0;                 // The number of bones that are updated at this LOD
+            float                           m_minDistance = 0.0f;           // The distance from the viewer at which this LOD becomes active
+        };
+
     public:
 
         virtual bool IsValid() const final;
@@ -86,13 +98,59 @@ namespace EE::Animation
 
         Transform GetBoneGlobalTransform( int32_t idx ) const;
 
+        // Hierarchy levels
+        //-------------------------------------------------------------------------
+        // All bones sorted by their depth in the hierarchy, bones within the same level have no dependencies on one another
+
+        // Get the number of levels in the bone hierarchy
+        inline int32_t GetNumHierarchyLevels() const { return (int32_t) m_hierarchyLevelOffsets.size() - 1; }
+
+        // Get the offset into the depth sorted bone list for the specified level, the end of the level is the offset of the next level
+        inline int32_t GetHierarchyLevelOffset( int32_t levelIdx ) const
+        {
+            EE_ASSERT( levelIdx >= 0 && levelIdx < m_hierarchyLevelOffsets.size() );
+            return m_hierarchyLevelOffsets[levelIdx];
+        }
+
+        // Get the bone indices sorted by hierarchy depth
+        inline TVector<int32_t> const& GetDepthSortedBoneIndices() const { return m_depthSortedBoneIndices; }
+
+        // Get the parent indices expressed as indices into the depth sorted bone list
+        inline TVector<int32_t> const& GetDepthSortedParentIndices() const { return m_depthSortedParentIndices; }
+
+        // LODs
+        //-------------------------------------------------------------------------
+        // LOD 0 always contains all bones, each subsequent LOD contains fewer bones
+
+        inline int32_t GetNumLODs() const { return (int32_t) m_LODs.size(); }
+
+        // Get the number of bones that are updated for the specified LOD
+        inline int32_t GetNumBonesForLOD( int32_t lodIdx ) const
+        {
+            EE_ASSERT( lodIdx >= 0 && lodIdx < m_LODs.size() );
+            return m_LODs[lodIdx].m_numBones;
+        }
+
+        // Get the LOD to use for a character at the specified distance from the viewer
+        int32_t GetLODForDistance( float distance ) const;
+
         // Debug
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
         void DrawDebug( Drawing::DrawContext& ctx, Transform const& worldTransform ) const;
+
+        // Skeletons are normally loaded as resources, this creates one directly from a bone hierarchy (i.e. for benchmarks)
+        // Parents must be listed before their children and the first LOD must contain all bones
+        void InitializeProcedural( TVector<int32_t> const& parentIndices, TVector<Transform> const& localReferencePose, TVector<LOD> const& LODs );
         #endif
 
+    private:
+
+        // Calculate all the runtime data that is derived from the serialized bone hierarchy
+        void CalculateDerivedData();
+        void CalculateHierarchyLevels();
+
     private:
 
         TVector<StringID>                   m_boneIDs;
@@ -100,6 +158,10 @@ namespace EE::Animation
         TVector<Transform>                  m_localReferencePose;
         TVector<Transform>                  m_globalReferencePose;
         TVector<TBitFlags<BoneFlags>>       m_boneFlags;
+        TVector<LOD>                        m_LODs;
+        TVector<int32_t>                    m_depthSortedBoneIndices;
+        TVector<int32_t>                    m_depthSortedParentIndices;
+        TVector<int32_t>                    m_hierarchyLevelOffsets;
     };
 
     //-------------------------------------------------------------------------
@@ -74,6 +74,22 @@ namespace EE::Animation
         return ( m_pAnimation != nullptr ) ? m_pAnimation->GetSkeleton() : nullptr;
     }
 
+    void AnimationClipPlayerComponent::SetLOD( int32_t lodIdx )
+    {
+        EE_ASSERT( m_pPose != nullptr );
+
+        if ( lodIdx == m_pPose->GetLOD() )
+        {
+            return;
+        }
+
+        m_pPose->SetLOD( lodIdx );
+        m_pPose->CalculateGlobalTransforms();
+
+        // Force a resample since newly activated bones will not have been updated
+        m_previousAnimTime = Percentage( -1 );
+    }
+
     void AnimationClipPlayerComponent::Update( Seconds deltaTime, Transform const& characterTransform )
     {
         EE_PROFILE_FUNCTION_ANIMATION();
@@ -36,6 +36,9 @@ namespace EE::Animation
         Skeleton const* GetSkeleton() const;
         Pose const* GetPose() const { return m_pPose; }
 
+        // Set the skeleton LOD to use for sampling the animation
+        void SetLOD( int32_t lodIdx );
+
         // Does this component require a manual update via a custom entity system?
         inline bool RequiresManualUpdate() const { return m_requiresManualUpdate; }
 
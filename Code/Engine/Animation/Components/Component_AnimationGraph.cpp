@@ -51,6 +51,24 @@ namespace EE::Animation
         return m_pGraphInstance->GetPose();
     }
 
+    void AnimationGraphComponent::SetLOD( int32_t lodIdx )
+    {
+        EE_ASSERT( HasGraphInstance() );
+        m_pGraphInstance->SetLOD( lodIdx );
+    }
+
+    int32_t AnimationGraphComponent::GetLOD() const
+    {
+        EE_ASSERT( HasGraphInstance() );
+        return m_pGraphInstance->GetLOD();
+    }
+
+    void AnimationGraphComponent::SetTaskScheduler( EE::TaskSystem* pTaskScheduler )
+    {
+        EE_ASSERT( HasGraphInstance() );
+        m_pGraphInstance->SetTaskScheduler( pTaskScheduler );
+    }
+
     void AnimationGraphComponent::EvaluateGraph( Seconds deltaTime, Transform const& characterWorldTransform, Physics::Scene* pPhysicsScene )
     {
         EE_ASSERT( HasGraph() );
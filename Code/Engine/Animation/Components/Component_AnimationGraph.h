@@ -6,6 +6,10 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Animation
 {
     enum class TaskSystemDebugMode;
@@ -51,6 +55,15 @@ namespace EE::Animation
         // This function will change the graph and data-set used! Note: this can only be called for unloaded components
         void SetGraphVariation( ResourceID graphResourceID );
 
+        // Set the skeleton LOD to use for pose generation
+        void SetLOD( int32_t lodIdx );
+
+        // Get the current skeleton LOD
+        int32_t GetLOD() const;
+
+        // Set the task scheduler used to execute independent pose tasks in parallel
+        void SetTaskScheduler( EE::TaskSystem* pTaskScheduler );
+
         // Graph evaluation
         //-------------------------------------------------------------------------
 
@@ -149,6 +149,9 @@ namespace EE::Animation
 
         // Always use the task system from the context as this is guaranteed to be set
         auto pTaskSystem = pGraphInstance->m_graphContext.m_pTaskSystem;
+        ImGui::Text( "Task Memory: %.2f KB (High Water Mark: %.2f KB)", pTaskSystem->GetTaskMemoryUsed() / 1024.0f, pTaskSystem->GetTaskMemoryHighWaterMark() / 1024.0f );
+        ImGui::Text( "Skeleton LOD: %d (%d/%d bones)", pTaskSystem->GetLOD(), pTaskSystem->GetPose()->GetNumActiveBones(), pTaskSystem->GetSkeleton()->GetNumBones() );
+
         if ( !pTaskSystem->HasTasks() )
         {
             ImGui::Text( "No Active Tasks" );
@@ -179,6 +179,24 @@ namespace EE::Animation
         return m_pTaskSystem->RequiresUpdate();
     }
 
+    void GraphInstance::SetLOD( int32_t lodIdx )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        m_pTaskSystem->SetLOD( lodIdx );
+    }
+
+    int32_t GraphInstance::GetLOD() const
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        return m_pTaskSystem->GetLOD();
+    }
+
+    void GraphInstance::SetTaskScheduler( EE::TaskSystem* pTaskScheduler )
+    {
+        EE_ASSERT( m_pTaskSystem != nullptr );
+        m_pTaskSystem->SetTaskScheduler( pTaskScheduler );
+    }
+
     //-------------------------------------------------------------------------
 
     int32_t GraphInstance::GetExternalGraphSlotIndex( StringID slotID ) const
@@ -6,6 +6,11 @@
 
 //-------------------------------------------------------------------------
 
+namespace EE
+{
+    class TaskSystem;
+}
+
 namespace EE::Physics
 {
     class Scene;
@@ -84,6 +89,15 @@ namespace EE::Animation
         // Does the task system has unexecuted pose tasks
         bool DoesTaskSystemNeedUpdate() const;
 
+        // Set the skeleton LOD used by the task system (only valid for the main instance since it owns the task system)
+        void SetLOD( int32_t lodIdx );
+
+        // Get the skeleton LOD used by the task system
+        int32_t GetLOD() const;
+
+        // Set the task scheduler used to execute independent pose tasks in parallel (only valid for the main instance since it owns the task system)
+        void SetTaskScheduler( EE::TaskSystem* pTaskScheduler );
+
         // Graph State
         //-------------------------------------------------------------------------
 
@@ -18,21 +18,8 @@ namespace EE::Animation
         EE_ASSERT( pSkeleton->IsValid() );
         pResourceRecord->SetResourceData( pSkeleton );
 
-        // Calculate global reference pose
-        //-------------------------------------------------------------------------
-
-        int32_t const numBones = pSkeleton->GetNumBones();
-        pSkeleton->m_globalReferencePose.resize( numBones );
-
-        pSkeleton->m_globalReferencePose[0] = pSkeleton->m_localReferencePose[0];
-        for ( auto boneIdx = 1; boneIdx < numBones; boneIdx++ )
-        {
-            int32_t const parentIdx = pSkeleton->GetParentBoneIndex( boneIdx );
-            pSkeleton->m_globalReferencePose[boneIdx] = pSkeleton->m_localReferencePose[boneIdx] * pSkeleton->m_globalReferencePose[parentIdx];
-        }
-
-        //-------------------------------------------------------------------------
-
+        // Calculate the global reference pose and the hierarchy levels used for batched global transform calculation
+        pSkeleton->CalculateDerivedData();
         return true;
     }
 }
\ No newline at end of file
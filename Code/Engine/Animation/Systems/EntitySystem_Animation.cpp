@@ -2,9 +2,11 @@
 #include "Engine/Animation/Components/Component_AnimationClipPlayer.h"
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Render/Components/Component_SkeletalMesh.h"
+#include "WorldSystem_Animation.h"
 #include "Engine/Physics/Systems/WorldSystem_Physics.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Animation/AnimationPose.h"
+#include "System/Render/RenderViewport.h"
 #include "System/Profiling.h"
 #include "System/Log.h"
 
@@ -95,6 +97,11 @@ namespace EE::Animation
 
         //-------------------------------------------------------------------------
 
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
+        {
+            UpdateLODs( ctx, characterWorldTransform );
+        }
+
         UpdateAnimPlayers( ctx, characterWorldTransform );
         UpdateAnimGraphs( ctx, characterWorldTransform );
 
@@ -114,6 +121,40 @@ namespace EE::Animation
         }
     }
 
+    void AnimationSystem::UpdateLODs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform )
+    {
+        Render::Viewport const* pViewport = ctx.GetViewport();
+        if ( pViewport == nullptr )
+        {
+            return;
+        }
+
+        // All the animation components on this entity animate the same character, so they share the distance to the viewer
+        float const distanceToViewer = pViewport->GetViewPosition().GetDistance3( characterWorldTransform.GetTranslation() );
+
+        for ( auto pAnimComponent : m_animPlayers )
+        {
+            if ( !pAnimComponent->HasAnimationSet() )
+            {
+                continue;
+            }
+
+            int32_t const lodIdx = pAnimComponent->GetSkeleton()->GetLODForDistance( distanceToViewer );
+            pAnimComponent->SetLOD( lodIdx );
+        }
+
+        for ( auto pAnimComponent : m_animGraphs )
+        {
+            if ( !pAnimComponent->HasGraphInstance() )
+            {
+                continue;
+            }
+
+            int32_t const lodIdx = pAnimComponent->GetSkeleton()->GetLODForDistance( distanceToViewer );
+            pAnimComponent->SetLOD( lodIdx );
+        }
+    }
+
     void AnimationSystem::UpdateAnimPlayers( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform )
     {
         UpdateStage const updateStage = ctx.GetUpdateStage();
@@ -199,8 +240,8 @@ namespace EE::Animation
                         adjustedCharacterTransform = rootMotionDelta * characterWorldTransform;
                     }
 
-                    // Calculate pose tasks
-                    pAnimComponent->ExecutePrePhysicsTasks( ctx.GetDeltaTime(), adjustedCharacterTransform );
+                    // Queue pose tasks, these are executed for all characters together by the animation world system
+                    ctx.GetWorldSystem<AnimationWorldSystem>()->QueuePrePhysicsPoseTasks( pAnimComponent, ctx.GetDeltaTime(), adjustedCharacterTransform );
                 }
             }
         }
@@ -213,9 +254,10 @@ namespace EE::Animation
                     continue;
                 }
 
-                // Calculate the final pose tasks
+                // Calculate the final pose tasks, these read the simulation results (e.g. ragdoll poses)
                 if ( !pAnimComponent->RequiresManualUpdate() )
                 {
+                    ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->CompleteSimulation();
                     pAnimComponent->ExecutePostPhysicsTasks();
                 }
 
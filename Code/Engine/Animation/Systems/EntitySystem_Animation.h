@@ -39,6 +39,7 @@ namespace EE::Animation
         virtual void UnregisterComponent( EntityComponent* pComponent ) override;
         virtual void Update( EntityWorldUpdateContext const& ctx ) override;
 
+        void UpdateLODs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
         void UpdateAnimPlayers( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
         void UpdateAnimGraphs( EntityWorldUpdateContext const& ctx, Transform const& characterWorldTransform );
 
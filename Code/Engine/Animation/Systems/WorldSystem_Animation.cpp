@@ -2,14 +2,24 @@
 #include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "System/Drawing/DebugDrawing.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    void AnimationWorldSystem::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_pTaskSystem = systemRegistry.GetSystem<EE::TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+    }
+
     void AnimationWorldSystem::ShutdownSystem()
     {
         EE_ASSERT( m_graphComponents.empty() );
+        EE_ASSERT( m_poseTaskRequests.empty() );
+        m_pTaskSystem = nullptr;
     }
 
     void AnimationWorldSystem::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -17,6 +27,11 @@ namespace EE::Animation
         if ( auto pGraphComponent = TryCast<AnimationGraphComponent>( pComponent ) )
         {
             m_graphComponents.Add( pGraphComponent );
+
+            if ( pGraphComponent->HasGraphInstance() )
+            {
+                pGraphComponent->SetTaskScheduler( m_pTaskSystem );
+            }
         }
     }
 
@@ -24,12 +39,79 @@ namespace EE::Animation
     {
         if ( auto pGraphComponent = TryCast<AnimationGraphComponent>( pComponent ) )
         {
+            if ( pGraphComponent->HasGraphInstance() )
+            {
+                pGraphComponent->SetTaskScheduler( nullptr );
+            }
+
             m_graphComponents.Remove( pGraphComponent->GetID() );
         }
     }
 
+    //-------------------------------------------------------------------------
+
+    void AnimationWorldSystem::QueuePrePhysicsPoseTasks( AnimationGraphComponent* pComponent, Seconds deltaTime, Transform const& characterWorldTransform )
+    {
+        EE_ASSERT( pComponent != nullptr && pComponent->HasGraphInstance() );
+
+        Threading::ScopeLock lock( m_poseTaskRequestsMutex );
+        m_poseTaskRequests.push_back( { pComponent, deltaTime, characterWorldTransform } );
+    }
+
+    void AnimationWorldSystem::ExecuteQueuedPoseTasks()
+    {
+        struct PoseTaskBatch final : public ITaskSet
+        {
+            PoseTaskBatch( TVector<PoseTaskRequest> const& requests )
+                : m_requests( requests )
+            {
+                m_SetSize = (uint32_t) requests.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    EE_PROFILE_SCOPE_ANIMATION( "Character Pose Tasks" );
+                    auto const& request = m_requests[i];
+                    request.m_pComponent->ExecutePrePhysicsTasks( request.m_deltaTime, request.m_characterWorldTransform );
+                }
+            }
+
+        private:
+
+            TVector<PoseTaskRequest> const&                     m_requests;
+        };
+
+        //-------------------------------------------------------------------------
+
+        EE_PROFILE_SCOPE_ANIMATION( "Animation World System - Pose Tasks" );
+
+        // All entity updates are complete at this point so no more requests can be added
+        if ( m_poseTaskRequests.empty() )
+        {
+            return;
+        }
+
+        PoseTaskBatch poseTaskBatch( m_poseTaskRequests );
+        m_pTaskSystem->ScheduleTask( &poseTaskBatch );
+        m_pTaskSystem->WaitForTask( &poseTaskBatch );
+
+        m_poseTaskRequests.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
     void AnimationWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
+        {
+            ExecuteQueuedPoseTasks();
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         Drawing::DrawContext drawingCtx = ctx.GetDrawingContext();
         for ( auto pComponent : m_graphComponents )
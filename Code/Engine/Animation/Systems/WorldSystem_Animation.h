@@ -2,7 +2,15 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Animation/Components/Component_AnimationGraph.h"
 #include "System/Types/IDVector.h"
+#include "System/Threading/Threading.h"
+#include "System/Math/Transform.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
 
 //-------------------------------------------------------------------------
 
@@ -11,14 +19,28 @@ namespace EE::Animation
     class AnimationGraphComponent;
 
     //-------------------------------------------------------------------------
+    // Animation World System
+    //-------------------------------------------------------------------------
+    // Pose task execution for all characters is batched here, once all entities have been updated
+    // Each character is executed as a separate job and each character will further split its pose task tree into independent jobs
 
     class AnimationWorldSystem : public IEntityWorldSystem
     {
         friend class AnimationDebugView;
 
+        struct PoseTaskRequest
+        {
+            AnimationGraphComponent*                            m_pComponent = nullptr;
+            Seconds                                             m_deltaTime = 0.0f;
+            Transform                                           m_characterWorldTransform;
+        };
+
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::FrameEnd ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( AnimationWorldSystem, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::FrameEnd ), WritesData<AnimationGraphComponent>() );
+
+        // Queue the pre-physics pose tasks for a character, these will be executed once all entities have been updated - threadsafe
+        void QueuePrePhysicsPoseTasks( AnimationGraphComponent* pComponent, Seconds deltaTime, Transform const& characterWorldTransform );
 
         #if EE_DEVELOPMENT_TOOLS
         inline TVector<AnimationGraphComponent*> const& GetRegisteredGraphComponents() const { return m_graphComponents.GetVector(); }
@@ -26,13 +48,20 @@ namespace EE::Animation
 
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool IsWorldLocal() const override { return true; }
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+        void ExecuteQueuedPoseTasks();
+
     private:
 
-        TIDVector<ComponentID, AnimationGraphComponent*>          m_graphComponents;
+        EE::TaskSystem*                                         m_pTaskSystem = nullptr;
+        TIDVector<ComponentID, AnimationGraphComponent*>        m_graphComponents;
+        TVector<PoseTaskRequest>                                m_poseTaskRequests;
+        Threading::Mutex                                        m_poseTaskRequestsMutex;
     };
 } 
\ No newline at end of file
@@ -67,6 +67,9 @@ namespace EE::Animation
         // Do we have a dependency on the physics simulation?
         inline bool	HasPhysicsDependency() const { return m_updateStage != TaskUpdateStage::Any; }
 
+        // Does this task access state that is shared between tasks (e.g. cached poses)? These tasks are never executed in parallel with one another
+        virtual bool AccessesSharedState() const { return false; }
+
         #if EE_DEVELOPMENT_TOOLS
         virtual String GetDebugText() const { return String(); }
         virtual Color GetDebugColor() const { return Colors::White; }
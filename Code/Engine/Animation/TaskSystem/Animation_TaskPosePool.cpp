@@ -27,9 +27,11 @@ namespace EE::Animation
     {
         EE_ASSERT( m_pSkeleton != nullptr );
 
+        m_poseBuffers.reserve( s_maxBuffers );
+
         for ( auto i = 0; i < s_numInitialBuffers; i++ )
         {
-            m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+            m_poseBuffers.emplace_back( EE::New<PoseBuffer>( m_pSkeleton ) );
             m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
 
             #if EE_DEVELOPMENT_TOOLS
@@ -42,14 +44,19 @@ namespace EE::Animation
     PoseBufferPool::~PoseBufferPool()
     {
         Reset();
+
+        for ( auto& pPoseBuffer : m_poseBuffers )
+        {
+            EE::Delete( pPoseBuffer );
+        }
     }
 
     void PoseBufferPool::Reset()
     {
         // Reset all buffers
-        for ( auto& PoseBuffer : m_poseBuffers )
+        for ( auto pPoseBuffer : m_poseBuffers )
         {
-            PoseBuffer.Reset();
+            pPoseBuffer->Reset();
         }
 
         m_firstFreeBuffer = 0;
@@ -74,26 +81,49 @@ namespace EE::Animation
         #endif
     }
 
+    void PoseBufferPool::SetLOD( int32_t lodIdx )
+    {
+        if ( lodIdx == m_LOD )
+        {
+            return;
+        }
+
+        m_LOD = lodIdx;
+
+        for ( auto pPoseBuffer : m_poseBuffers )
+        {
+            pPoseBuffer->m_pose.SetLOD( m_LOD );
+        }
+
+        // Note: any cached poses will only have valid transforms for their previous LOD's bones
+        for ( auto& cachedBuffer : m_cachedBuffers )
+        {
+            cachedBuffer.m_pose.SetLOD( m_LOD );
+        }
+    }
+
     int8_t PoseBufferPool::RequestPoseBuffer()
     {
+        Threading::ScopeLock lock( m_poseBufferMutex );
+
         if ( m_firstFreeBuffer == m_poseBuffers.size() )
         {
             for ( auto i = 0; i < s_bufferGrowAmount; i++ )
             {
-                m_poseBuffers.emplace_back( PoseBuffer( m_pSkeleton ) );
+                m_poseBuffers.emplace_back( EE::New<PoseBuffer>( m_pSkeleton ) )->m_pose.SetLOD( m_LOD );
             }
-            EE_ASSERT( m_poseBuffers.size() < 255 );
+            EE_ASSERT( m_poseBuffers.size() < s_maxBuffers );
         }
 
         int8_t const freeBufferIdx = m_firstFreeBuffer;
-        EE_ASSERT( !m_poseBuffers[freeBufferIdx].m_isUsed );
-        m_poseBuffers[freeBufferIdx].m_isUsed = true;
+        EE_ASSERT( !m_poseBuffers[freeBufferIdx]->m_isUsed );
+        m_poseBuffers[freeBufferIdx]->m_isUsed = true;
 
         // Update free index
         int8_t const numPoseBuffers = (int8_t) m_poseBuffers.size();
         for ( ; m_firstFreeBuffer < numPoseBuffers; m_firstFreeBuffer++ )
         {
-            if ( !m_poseBuffers[m_firstFreeBuffer].m_isUsed )
+            if ( !m_poseBuffers[m_firstFreeBuffer]->m_isUsed )
             {
                 break;
             }
@@ -104,8 +134,10 @@ namespace EE::Animation
 
     void PoseBufferPool::ReleasePoseBuffer( int8_t BufferIdx )
     {
-        EE_ASSERT( m_poseBuffers[BufferIdx].m_isUsed );
-        m_poseBuffers[BufferIdx].m_isUsed = false;
+        Threading::ScopeLock lock( m_poseBufferMutex );
+
+        EE_ASSERT( m_poseBuffers[BufferIdx]->m_isUsed );
+        m_poseBuffers[BufferIdx]->m_isUsed = false;
         m_firstFreeBuffer = Math::Min( BufferIdx, m_firstFreeBuffer );
     }
 
@@ -118,6 +150,7 @@ namespace EE::Animation
             for ( auto i = 0; i < s_bufferGrowAmount; i++ )
             {
                 pCachedPoseBuffer = &m_cachedBuffers.emplace_back( CachedPoseBuffer( m_pSkeleton ) );
+                pCachedPoseBuffer->m_pose.SetLOD( m_LOD );
             }
 
             EE_ASSERT( m_cachedBuffers.size() < 255 );
@@ -194,6 +227,8 @@ namespace EE::Animation
             return;
         }
 
+        Threading::ScopeLock lock( m_poseBufferMutex );
+
         // If we are out of buffers, add additional debug buffers
         if ( m_firstFreeDebugBuffer == m_debugBuffers.size() )
         {
@@ -206,8 +241,8 @@ namespace EE::Animation
             EE_ASSERT( m_debugBuffers.size() < 255 );
         }
 
-        EE_ASSERT( m_poseBuffers[poseBufferIdx].m_isUsed );
-        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx].m_pose );
+        EE_ASSERT( m_poseBuffers[poseBufferIdx]->m_isUsed );
+        m_debugBuffers[m_firstFreeDebugBuffer].CopyFrom( m_poseBuffers[poseBufferIdx]->m_pose );
         m_debugBufferTaskIdxMapping[m_firstFreeDebugBuffer] = taskIdx;
         m_firstFreeDebugBuffer++;
     }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Animation/AnimationPose.h"
+#include "System/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -52,10 +53,13 @@ namespace EE::Animation
 
     //-------------------------------------------------------------------------
 
+    // Note: requesting and releasing pose buffers is threadsafe since independent tasks can be executed in parallel
+    // Pose buffers are individually allocated so that growing the pool never invalidates a buffer that is in use on another thread
     class PoseBufferPool
     {
         constexpr static int8_t const s_numInitialBuffers = 6;
         constexpr static int8_t const s_bufferGrowAmount = 3;
+        constexpr static int32_t const s_maxBuffers = 255;
 
     public:
 
@@ -64,6 +68,10 @@ namespace EE::Animation
 
         void Reset();
 
+        // Set the skeleton LOD for all pose buffers
+        void SetLOD( int32_t lodIdx );
+        inline int32_t GetLOD() const { return m_LOD; }
+
         // Poses
         //-------------------------------------------------------------------------
 
@@ -72,8 +80,8 @@ namespace EE::Animation
 
         inline PoseBuffer* GetBuffer( int8_t bufferIdx )
         {
-            EE_ASSERT( m_poseBuffers[bufferIdx].m_isUsed );
-            return &m_poseBuffers[bufferIdx];
+            EE_ASSERT( m_poseBuffers[bufferIdx]->m_isUsed );
+            return m_poseBuffers[bufferIdx];
         }
 
         // Cached Poses
@@ -97,11 +105,13 @@ namespace EE::Animation
     private:
 
         Skeleton const*                             m_pSkeleton = nullptr;
-        TVector<PoseBuffer>                         m_poseBuffers;
+        TVector<PoseBuffer*>                        m_poseBuffers;              // Storage is reserved up front so that this never reallocates
+        Threading::Mutex                            m_poseBufferMutex;
         TVector<CachedPoseBuffer>                   m_cachedBuffers;
         TInlineVector<UUID, 5>                      m_cachedPoseBuffersToDestroy;
         int8_t                                      m_firstFreeCachedBuffer = 0;
         int8_t                                      m_firstFreeBuffer = 0;
+        int32_t                                     m_LOD = 0;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<Pose>                               m_debugBuffers;
@@ -4,11 +4,27 @@
 #include "System/Log.h"
 #include "System/Drawing/DebugDrawing.h"
 #include "System/Profiling.h"
+#include "System/Threading/TaskSystem.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Animation
 {
+    // Executes a single dependency subtree on a worker thread
+    struct TaskSubtreeJob final : public ITaskSet
+    {
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_PROFILE_SCOPE_ANIMATION( "Anim Task Subtree" );
+            m_pTaskSystem->ExecuteTaskTree( m_taskIdx );
+        }
+
+        TaskSystem*     m_pTaskSystem = nullptr;
+        TaskIndex       m_taskIdx = InvalidIndex;
+    };
+
+    //-------------------------------------------------------------------------
+
     TaskSystem::TaskSystem( Skeleton const* pSkeleton )
         : m_posePool( pSkeleton )
         , m_taskContext( m_posePool )
@@ -25,27 +41,57 @@ namespace EE::Animation
 
     void TaskSystem::Reset()
     {
+        // Tasks are allocated from the linear allocator so only run the destructors here
         for ( auto pTask : m_tasks )
         {
-            EE::Delete( pTask );
+            pTask->~Task();
         }
 
         m_tasks.clear();
+        m_taskMemoryMarkers.clear();
+        m_taskAllocator.Reset();
         m_posePool.Reset();
         m_hasPhysicsDependency = false;
     }
 
     //-------------------------------------------------------------------------
 
+    void TaskSystem::SetLOD( int32_t lodIdx )
+    {
+        EE_ASSERT( lodIdx >= 0 && lodIdx < GetSkeleton()->GetNumLODs() );
+
+        if ( lodIdx == m_finalPose.GetLOD() )
+        {
+            return;
+        }
+
+        m_posePool.SetLOD( lodIdx );
+
+        // The final pose always needs to have valid global transforms
+        m_finalPose.SetLOD( lodIdx );
+        m_finalPose.CalculateGlobalTransforms();
+    }
+
+    //-------------------------------------------------------------------------
+
     void TaskSystem::RollbackToTaskIndexMarker( TaskIndex const marker )
     {
         EE_ASSERT( marker >= 0 && marker <= m_tasks.size() );
 
+        if ( marker == m_tasks.size() )
+        {
+            return;
+        }
+
         for ( int16_t t = (int16_t) m_tasks.size() - 1; t >= marker; t-- )
         {
-            EE::Delete( m_tasks[t] );
-            m_tasks.erase( m_tasks.begin() + t );
+            m_tasks[t]->~Task();
         }
+
+        // Rewind the task memory to where it was before the first rolled back task was allocated
+        m_taskAllocator.RollbackToMarker( m_taskMemoryMarkers[marker] );
+        m_tasks.resize( marker );
+        m_taskMemoryMarkers.resize( marker );
     }
 
     //-------------------------------------------------------------------------
@@ -125,17 +171,7 @@ namespace EE::Animation
             {
                 for ( TaskIndex prePhysicsTaskIdx : m_prePhysicsTaskIndices )
                 {
-                    m_taskContext.m_currentTaskIdx = prePhysicsTaskIdx;
-
-                    // Set dependencies
-                    m_taskContext.m_dependencies.clear();
-                    for ( auto depTaskIdx : m_tasks[prePhysicsTaskIdx]->GetDependencyIndices() )
-                    {
-                        EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
-                        m_taskContext.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
-                    }
-
-                    m_tasks[prePhysicsTaskIdx]->Execute( m_taskContext );
+                    ExecuteTask( prePhysicsTaskIdx, m_taskContext );
                 }
             }
         }
@@ -197,29 +233,126 @@ namespace EE::Animation
         }
     }
 
+    void TaskSystem::ExecuteTask( TaskIndex taskIdx, TaskContext& context )
+    {
+        context.m_currentTaskIdx = taskIdx;
+
+        // Set dependencies
+        context.m_dependencies.clear();
+        for ( auto depTaskIdx : m_tasks[taskIdx]->GetDependencyIndices() )
+        {
+            EE_ASSERT( m_tasks[depTaskIdx]->IsComplete() );
+            context.m_dependencies.emplace_back( m_tasks[depTaskIdx] );
+        }
+
+        // Execute task
+        m_tasks[taskIdx]->Execute( context );
+    }
+
     void TaskSystem::ExecuteTasks()
     {
+        if ( m_pTaskScheduler != nullptr && m_tasks.size() >= s_minTasksForParallelExecution )
+        {
+            ExecuteTasksInParallel();
+        }
+
+        // Execute any remaining tasks in registration order (for serial execution, this is all the tasks)
         int16_t const numTasks = (int8_t) m_tasks.size();
         for ( TaskIndex i = 0; i < numTasks; i++ )
         {
             if ( !m_tasks[i]->IsComplete() )
             {
-                m_taskContext.m_currentTaskIdx = i;
+                ExecuteTask( i, m_taskContext );
+            }
+        }
 
-                // Set dependencies
-                m_taskContext.m_dependencies.clear();
-                for ( auto DepTaskIdx : m_tasks[i]->GetDependencyIndices() )
-                {
-                    EE_ASSERT( m_tasks[DepTaskIdx]->IsComplete() );
-                    m_taskContext.m_dependencies.emplace_back( m_tasks[DepTaskIdx] );
-                }
+        m_needsUpdate = false;
+    }
+
+    void TaskSystem::ExecuteTasksInParallel()
+    {
+        EE_PROFILE_SCOPE_ANIMATION( "Anim Parallel Tasks" );
+
+        // Calculate subtree info - dependencies are always registered before the tasks that depend on them
+        //-------------------------------------------------------------------------
+
+        int32_t const numTasks = (int32_t) m_tasks.size();
+        m_subtrees.resize( numTasks );
+
+        for ( auto i = 0; i < numTasks; i++ )
+        {
+            Task const* pTask = m_tasks[i];
+            bool const isComplete = pTask->IsComplete();
+
+            SubtreeInfo& subtree = m_subtrees[i];
+            subtree.m_numTasks = isComplete ? 0 : 1;
+            subtree.m_accessesSharedState = !isComplete && pTask->AccessesSharedState();
 
-                // Execute task
-                m_tasks[i]->Execute( m_taskContext );
+            for ( auto depTaskIdx : pTask->GetDependencyIndices() )
+            {
+                EE_ASSERT( depTaskIdx < i );
+                subtree.m_numTasks += m_subtrees[depTaskIdx].m_numTasks;
+                subtree.m_accessesSharedState |= m_subtrees[depTaskIdx].m_accessesSharedState;
             }
         }
 
-        m_needsUpdate = false;
+        // Execute the task tree from the final task
+        //-------------------------------------------------------------------------
+
+        ExecuteTaskTree( (TaskIndex) ( numTasks - 1 ) );
+    }
+
+    void TaskSystem::ExecuteTaskTree( TaskIndex taskIdx )
+    {
+        Task* pTask = m_tasks[taskIdx];
+        if ( pTask->IsComplete() )
+        {
+            return;
+        }
+
+        // Execute dependencies
+        //-------------------------------------------------------------------------
+        // Independent subtrees (other than the first) are kicked off as separate jobs and the rest are executed on this thread in registration order
+        // Subtrees that access shared state are never kicked off, this ensures that only a single thread will ever access the shared state and in the expected order
+
+        auto const& dependencies = pTask->GetDependencyIndices();
+        int32_t const numDependencies = (int32_t) dependencies.size();
+
+        TaskSubtreeJob jobs[s_maxParallelDependencies];
+        bool isDependencyScheduled[s_maxParallelDependencies + 1] = { false };
+        int32_t numJobs = 0;
+
+        for ( auto i = 1; i < numDependencies && i <= s_maxParallelDependencies; i++ )
+        {
+            SubtreeInfo const& subtree = m_subtrees[dependencies[i]];
+            if ( subtree.m_numTasks >= s_minTasksPerParallelSubtree && !subtree.m_accessesSharedState )
+            {
+                jobs[numJobs].m_pTaskSystem = this;
+                jobs[numJobs].m_taskIdx = dependencies[i];
+                m_pTaskScheduler->ScheduleTask( &jobs[numJobs] );
+                isDependencyScheduled[i] = true;
+                numJobs++;
+            }
+        }
+
+        for ( auto i = 0; i < numDependencies; i++ )
+        {
+            if ( i > s_maxParallelDependencies || !isDependencyScheduled[i] )
+            {
+                ExecuteTaskTree( dependencies[i] );
+            }
+        }
+
+        for ( auto i = 0; i < numJobs; i++ )
+        {
+            m_pTaskScheduler->WaitForTask( &jobs[i] );
+        }
+
+        // Execute task
+        //-------------------------------------------------------------------------
+
+        TaskContext context = m_taskContext;
+        ExecuteTask( taskIdx, context );
     }
 
     //-------------------------------------------------------------------------
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Animation_Task.h"
+#include "System/Memory/LinearAllocator.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
 
 //-------------------------------------------------------------------------
 
@@ -21,6 +26,17 @@ namespace EE::Animation
     class TaskSystem
     {
         friend class AnimationDebugView;
+        friend struct TaskSubtreeJob;
+
+        constexpr static int32_t const s_minTasksForParallelExecution = 4;  // Below this, the job overhead outweighs any gains
+        constexpr static int32_t const s_minTasksPerParallelSubtree = 2;    // The minimum number of tasks in a subtree for it to be worth executing as a separate job
+        constexpr static int32_t const s_maxParallelDependencies = 4;       // The maximum number of dependency subtrees we will kick off as separate jobs for a single task
+
+        struct SubtreeInfo
+        {
+            int16_t                     m_numTasks = 0;                     // The number of tasks in this subtree that still need to be executed
+            bool                        m_accessesSharedState = false;      // Does any task in this subtree access shared state (i.e. needs to be executed in registration order)
+        };
 
     public:
 
@@ -38,6 +54,13 @@ namespace EE::Animation
         // Get the final pose generated by the task system
         Pose const* GetPose() const{ return &m_finalPose; }
 
+        // LOD
+        //-------------------------------------------------------------------------
+
+        // Set the skeleton LOD to use for all poses, lower detail LODs only sample, blend and calculate global transforms for a subset of the bones
+        void SetLOD( int32_t lodIdx );
+        inline int32_t GetLOD() const { return m_finalPose.GetLOD(); }
+
         // Execution
         //-------------------------------------------------------------------------
 
@@ -53,6 +76,9 @@ namespace EE::Animation
         // Run all post-physics tasks and fill out the final pose buffer
         void UpdatePostPhysics();
 
+        // Set the task scheduler used to execute independent task subtrees in parallel, if this is not set all tasks are executed serially on the calling thread
+        inline void SetTaskScheduler( EE::TaskSystem* pTaskScheduler ) { m_pTaskScheduler = pTaskScheduler; }
+
         // Cached Pose storage
         //-------------------------------------------------------------------------
 
@@ -69,7 +95,8 @@ namespace EE::Animation
         inline TaskIndex RegisterTask( ConstructorParams&&... params )
         {
             EE_ASSERT( m_tasks.size() < 0xFF );
-            auto pNewTask = m_tasks.emplace_back( EE::New<T>( std::forward<ConstructorParams>( params )... ) );
+            m_taskMemoryMarkers.emplace_back( m_taskAllocator.GetMarker() );
+            auto pNewTask = m_tasks.emplace_back( m_taskAllocator.New<T>( std::forward<ConstructorParams>( params )... ) );
             m_hasPhysicsDependency |= pNewTask->HasPhysicsDependency();
             m_needsUpdate = true;
             return (TaskIndex) ( m_tasks.size() - 1 );
@@ -78,6 +105,15 @@ namespace EE::Animation
         TaskIndex GetCurrentTaskIndexMarker() const { return (TaskIndex) m_tasks.size(); }
         void RollbackToTaskIndexMarker( TaskIndex const marker );
 
+        // Task Memory
+        //-------------------------------------------------------------------------
+
+        // Get the number of bytes currently used by the registered tasks
+        inline size_t GetTaskMemoryUsed() const { return m_taskAllocator.GetUsedMemory(); }
+
+        // Get the maximum number of bytes ever used by the registered tasks
+        inline size_t GetTaskMemoryHighWaterMark() const { return m_taskAllocator.GetHighWaterMark(); }
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -90,8 +126,13 @@ namespace EE::Animation
     private:
 
         bool AddTaskChainToPrePhysicsList( TaskIndex taskIdx );
+        void ExecuteTask( TaskIndex taskIdx, TaskContext& context );
         void ExecuteTasks();
 
+        // Execute the task tree in parallel, starting from the final task. Independent dependency subtrees are executed as separate jobs
+        void ExecuteTasksInParallel();
+        void ExecuteTaskTree( TaskIndex taskIdx );
+
         #if EE_DEVELOPMENT_TOOLS
         void CalculateTaskOffset( TaskIndex taskIdx, Float2 const& currentOffset, TInlineVector<Float2, 16>& offsets );
         #endif
@@ -99,9 +140,13 @@ namespace EE::Animation
     private:
 
         TVector<Task*>                  m_tasks;
+        LinearAllocator                 m_taskAllocator;                // All tasks are allocated from this and it is reset each frame
+        TVector<LinearAllocator::Marker> m_taskMemoryMarkers;           // The allocator position before each task was allocated, needed for rollback
         PoseBufferPool                  m_posePool;
         TaskContext                     m_taskContext;
         TInlineVector<TaskIndex, 16>    m_prePhysicsTaskIndices;
+        EE::TaskSystem*                 m_pTaskScheduler = nullptr;
+        TVector<SubtreeInfo>            m_subtrees;                     // Per-task subtree info, only valid during parallel execution
         Pose                            m_finalPose;
         bool                            m_hasPhysicsDependency = false;
         bool                            m_hasCodependentPhysicsTasks = false;
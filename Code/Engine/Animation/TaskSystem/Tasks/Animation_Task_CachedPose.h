@@ -12,6 +12,7 @@ namespace EE::Animation::Tasks
 
         CachedPoseWriteTask( TaskSourceID sourceID, TaskIndex sourceTaskIdx, UUID cachedPoseID );
         virtual void Execute( TaskContext const& context ) override;
+        virtual bool AccessesSharedState() const override { return true; }
 
         #if EE_DEVELOPMENT_TOOLS
         virtual String GetDebugText() const override { return String( "Write Cached Pose" ); }
@@ -32,6 +33,7 @@ namespace EE::Animation::Tasks
 
         CachedPoseReadTask( TaskSourceID sourceID, UUID cachedPoseID );
         virtual void Execute( TaskContext const& context ) override;
+        virtual bool AccessesSharedState() const override { return true; }
 
         #if EE_DEVELOPMENT_TOOLS
         virtual String GetDebugText() const override { return String( "Read Cached Pose" ); }
@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Camera/Components/Component_Camera.h"
 #include "System/Math/Vector.h"
 
 //-------------------------------------------------------------------------
@@ -18,7 +19,7 @@ namespace EE
 
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( CameraManager, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Highest ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( CameraManager, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Highest ), ReadsData<CameraComponent>() );
 
         //-------------------------------------------------------------------------
 
@@ -47,6 +48,7 @@ namespace EE
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool IsWorldLocal() const override { return true; }
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
         #if EE_DEVELOPMENT_TOOLS
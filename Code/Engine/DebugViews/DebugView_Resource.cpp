@@ -2,6 +2,7 @@
 #include "System/Resource/ResourceSystem.h"
 #include "System/Systems.h"
 #include "System/Imgui/ImguiX.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
@@ -150,14 +151,18 @@ namespace EE::Resource
                 if ( ImGui::IsItemHovered() ) { ImGui::SetTooltip( "File Read Time" ); }
 
                 ImGui::TableSetColumnIndex( 5 );
+                ImGui::Text( "%.3fms", pRecord->GetDecompressionTime().ToFloat() );
+                if ( ImGui::IsItemHovered() ) { ImGui::SetTooltip( "Decompression Time" ); }
+
+                ImGui::TableSetColumnIndex( 6 );
                 ImGui::Text( "%.3fms", pRecord->GetLoadTime().ToFloat() );
                 if ( ImGui::IsItemHovered() ) { ImGui::SetTooltip( "Load Time" ); }
 
-                ImGui::TableSetColumnIndex( 6 );
+                ImGui::TableSetColumnIndex( 7 );
                 ImGui::Text( "%.3fms", pRecord->GetDependenciesWaitTime().ToFloat() );
                 if ( ImGui::IsItemHovered() ) { ImGui::SetTooltip( "Wait for Dependencies Time" ); }
 
-                ImGui::TableSetColumnIndex( 7 );
+                ImGui::TableSetColumnIndex( 8 );
                 ImGui::Text( "%.3fms", pRecord->GetInstallTime().ToFloat() );
                 if ( ImGui::IsItemHovered() ) { ImGui::SetTooltip( "Install Time" ); }
             }
@@ -171,13 +176,22 @@ namespace EE::Resource
 
             ImGui::Separator();
 
-            if ( ImGui::BeginTable( "Resource Reference Tracker Table", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable ) )
+            DrawSchedulingStats( pResourceSystem );
+
+            ImGui::Separator();
+
+            DrawMemoryStats( pResourceSystem );
+
+            ImGui::Separator();
+
+            if ( ImGui::BeginTable( "Resource Reference Tracker Table", 9, ImGuiTableFlags_Borders | ImGuiTableFlags_Resizable ) )
             {
                 ImGui::TableSetupColumn( "Type", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 30 );
                 ImGui::TableSetupColumn( "Refs", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 24 );
                 ImGui::TableSetupColumn( "Status", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 60 );
                 ImGui::TableSetupColumn( "ID", ImGuiTableColumnFlags_WidthStretch );
                 ImGui::TableSetupColumn( "FRT", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 0 );
+                ImGui::TableSetupColumn( "DT", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 0 );
                 ImGui::TableSetupColumn( "LT", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 0 );
                 ImGui::TableSetupColumn( "DWT", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 0 );
                 ImGui::TableSetupColumn( "IT", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoResize, 0 );
@@ -201,6 +215,164 @@ namespace EE::Resource
         ImGui::End();
     }
 
+    void ResourceDebugView::DrawSchedulingStats( ResourceSystem* pResourceSystem )
+    {
+        EE_ASSERT( pResourceSystem != nullptr );
+
+        // The active requests are owned by the async task while it is running
+        if ( !pResourceSystem->m_isAsyncTaskRunning )
+        {
+            size_t inFlightReadBytes = 0;
+            for ( ResourceRequest const* pRequest : pResourceSystem->m_activeRequests )
+            {
+                inFlightReadBytes += pRequest->GetInFlightDataSize();
+            }
+
+            ImGui::Text( "Active Requests: %d, In-Flight Reads: %.2fMB / %.2fMB", pResourceSystem->m_activeRequests.size(), float( inFlightReadBytes ) / ( 1024 * 1024 ), float( pResourceSystem->m_maxInFlightReadBytes ) / ( 1024 * 1024 ) );
+        }
+        else
+        {
+            ImGui::Text( "Active Requests: %d", pResourceSystem->m_activeRequests.size() );
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( ImGui::BeginTable( "Load Latency Table", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit ) )
+        {
+            ImGui::TableSetupColumn( "Priority" );
+            ImGui::TableSetupColumn( "Samples" );
+            ImGui::TableSetupColumn( "P50" );
+            ImGui::TableSetupColumn( "P90" );
+            ImGui::TableSetupColumn( "P99" );
+            ImGui::TableSetupColumn( "Max" );
+            ImGui::TableHeadersRow();
+
+            //-------------------------------------------------------------------------
+
+            TVector<float> sortedSamples;
+            auto GetPercentile = [&sortedSamples] ( float percentile )
+            {
+                int32_t const sampleIdx = Math::Min( (int32_t) ( percentile * sortedSamples.size() ), (int32_t) sortedSamples.size() - 1 );
+                return sortedSamples[sampleIdx];
+            };
+
+            for ( uint8_t i = 0; i < (uint8_t) ResourcePriority::NumPriorities; i++ )
+            {
+                sortedSamples = pResourceSystem->m_loadLatencies[i].m_samples;
+                eastl::sort( sortedSamples.begin(), sortedSamples.end() );
+
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex( 0 );
+                ImGui::Text( "%s", GetPriorityName( (ResourcePriority) i ) );
+
+                ImGui::TableSetColumnIndex( 1 );
+                ImGui::Text( "%d", (int32_t) sortedSamples.size() );
+
+                if ( sortedSamples.empty() )
+                {
+                    continue;
+                }
+
+                ImGui::TableSetColumnIndex( 2 );
+                ImGui::Text( "%.2fms", GetPercentile( 0.5f ) );
+
+                ImGui::TableSetColumnIndex( 3 );
+                ImGui::Text( "%.2fms", GetPercentile( 0.9f ) );
+
+                ImGui::TableSetColumnIndex( 4 );
+                ImGui::Text( "%.2fms", GetPercentile( 0.99f ) );
+
+                ImGui::TableSetColumnIndex( 5 );
+                ImGui::Text( "%.2fms", sortedSamples.back() );
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
+    void ResourceDebugView::DrawMemoryStats( ResourceSystem* pResourceSystem )
+    {
+        EE_ASSERT( pResourceSystem != nullptr );
+
+        constexpr static float const s_bytesToMB = 1.0f / ( 1024 * 1024 );
+
+        bool isCacheEnabled = pResourceSystem->IsResourceCacheEnabled();
+        if ( ImGui::Checkbox( "Enable Resource Cache", &isCacheEnabled ) )
+        {
+            pResourceSystem->SetResourceCacheEnabled( isCacheEnabled );
+        }
+
+        ImGui::SameLine();
+        ImGui::Text( "Cached Resources: %d", pResourceSystem->m_cachedResources.size() );
+
+        //-------------------------------------------------------------------------
+
+        if ( ImGui::BeginTable( "Resource Memory Table", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit ) )
+        {
+            ImGui::TableSetupColumn( "Type" );
+            ImGui::TableSetupColumn( "Resident" );
+            ImGui::TableSetupColumn( "Cached" );
+            ImGui::TableSetupColumn( "Budget" );
+            ImGui::TableSetupColumn( "Hits" );
+            ImGui::TableSetupColumn( "Misses" );
+            ImGui::TableSetupColumn( "Hit Rate" );
+            ImGui::TableSetupColumn( "Evictions" );
+            ImGui::TableHeadersRow();
+
+            //-------------------------------------------------------------------------
+
+            for ( auto const& statsPair : pResourceSystem->m_typeMemoryStats )
+            {
+                ResourceSystem::TypeMemoryStats const& stats = statsPair.second;
+                size_t const budget = pResourceSystem->GetSettings().GetResourceCacheBudget( statsPair.first );
+
+                ImGui::TableNextRow();
+
+                ImGui::TableSetColumnIndex( 0 );
+                ImGui::Text( statsPair.first.ToString().c_str() );
+
+                ImGui::TableSetColumnIndex( 1 );
+                ImGui::TextColored( ( budget > 0 && stats.m_residentBytes > budget ) ? Colors::Red.ToFloat4() : Colors::White.ToFloat4(), "%.2fMB", stats.m_residentBytes * s_bytesToMB );
+
+                ImGui::TableSetColumnIndex( 2 );
+                ImGui::Text( "%.2fMB", stats.m_cachedBytes * s_bytesToMB );
+
+                ImGui::TableSetColumnIndex( 3 );
+                if ( budget > 0 )
+                {
+                    ImGui::Text( "%.2fMB", budget * s_bytesToMB );
+                }
+                else
+                {
+                    ImGui::Text( "-" );
+                }
+
+                ImGui::TableSetColumnIndex( 4 );
+                ImGui::Text( "%u", stats.m_numCacheHits );
+
+                ImGui::TableSetColumnIndex( 5 );
+                ImGui::Text( "%u", stats.m_numCacheMisses );
+
+                ImGui::TableSetColumnIndex( 6 );
+                uint32_t const numRequests = stats.m_numCacheHits + stats.m_numCacheMisses;
+                if ( numRequests > 0 )
+                {
+                    ImGui::Text( "%.1f%%", 100.0f * stats.m_numCacheHits / numRequests );
+                }
+                else
+                {
+                    ImGui::Text( "-" );
+                }
+
+                ImGui::TableSetColumnIndex( 7 );
+                ImGui::Text( "%u", stats.m_numEvictions );
+            }
+
+            ImGui::EndTable();
+        }
+    }
+
     void ResourceDebugView::DrawLogWindow( ResourceSystem* pResourceSystem, bool* pIsOpen )
     {
         if ( ImGui::Begin( "Resource Request History", pIsOpen ) )
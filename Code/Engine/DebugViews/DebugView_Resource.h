@@ -20,6 +20,12 @@ namespace EE::Resource
         static void DrawLogWindow( ResourceSystem* pResourceSystem, bool* pIsOpen );
         static void DrawOverviewWindow( ResourceSystem* pResourceSystem, bool* pIsOpen );
 
+        // Draw the request scheduling state and the per-priority load latency percentiles
+        static void DrawSchedulingStats( ResourceSystem* pResourceSystem );
+
+        // Draw the per-type memory usage and resource cache stats
+        static void DrawMemoryStats( ResourceSystem* pResourceSystem );
+
     public:
 
         ResourceDebugView();
@@ -6,6 +6,8 @@
 #include "Engine/UpdateContext.h"
 #include "Engine/Entity/EntityWorldManager.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Resource/ResourceSystem.h"
+#include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
@@ -21,6 +23,11 @@ namespace EE
     {
         EE_ASSERT( m_pWorld != nullptr );
 
+        if ( m_benchmarkMapID.IsValid() )
+        {
+            UpdateLoadBenchmark( context );
+        }
+
         if ( m_isWorldBrowserOpen )
         {
             if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
@@ -32,6 +39,12 @@ namespace EE
             if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
             DrawMapLoader( context );
         }
+
+        if ( m_isSystemUpdateGraphWindowOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawSystemUpdateGraphs( context );
+        }
     }
 
     void EntityDebugView::DrawMenu( EntityWorldUpdateContext const& context )
@@ -45,6 +58,11 @@ namespace EE
         {
             m_isMapLoaderOpen = true;
         }
+
+        if ( ImGui::MenuItem( "Show World System Updates" ) )
+        {
+            m_isSystemUpdateGraphWindowOpen = true;
+        }
     }
 
     //-------------------------------------------------------------------------
@@ -87,6 +105,140 @@ namespace EE
                     }
                 }
             }
+
+            // Load Benchmark
+            //-------------------------------------------------------------------------
+
+            ImGui::Separator();
+            ImGui::Text( "Load Benchmark" );
+
+            auto pResourceSystem = context.GetSystem<Resource::ResourceSystem>();
+            int32_t maxConcurrentLoads = pResourceSystem->GetMaxConcurrentLoads();
+            if ( ImGui::SliderInt( "Max Concurrent Loads", &maxConcurrentLoads, 1, 128 ) )
+            {
+                pResourceSystem->SetMaxConcurrentLoads( maxConcurrentLoads );
+            }
+
+            if ( m_benchmarkMapID.IsValid() )
+            {
+                ImGui::Text( "Benchmarking: %s (%.2fms)", m_benchmarkMapID.c_str(), m_benchmarkTimer.GetElapsedTimeMilliseconds().ToFloat() );
+            }
+            else
+            {
+                for ( auto i = 0; i < 4; i++ )
+                {
+                    // Only maps that are not loaded can be benchmarked, otherwise the resources would already be resident
+                    if ( !m_pWorld->HasMap( maps[i].second ) )
+                    {
+                        tempStr.sprintf( "Benchmark Load: %s", maps[i].first.c_str() );
+                        if ( ImGui::Button( tempStr.c_str() ) )
+                        {
+                            m_benchmarkMapID = maps[i].second;
+                            m_benchmarkTimer.Start();
+                            const_cast<EntityWorld*>( m_pWorld )->LoadMap( m_benchmarkMapID );
+                        }
+                    }
+                }
+            }
+
+            if ( m_lastBenchmarkMaxConcurrentLoads > 0 )
+            {
+                ImGui::Text( "Last Load: %.2fms (Max Concurrent Loads: %d)", m_lastBenchmarkTime.ToFloat(), m_lastBenchmarkMaxConcurrentLoads );
+            }
+        }
+        ImGui::End();
+    }
+
+    void EntityDebugView::UpdateLoadBenchmark( EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( m_benchmarkMapID.IsValid() );
+
+        // The map was unloaded or failed to load during the benchmark
+        if ( !m_pWorld->HasMap( m_benchmarkMapID ) || m_pWorld->GetMap( m_benchmarkMapID )->HasLoadingFailed() )
+        {
+            m_benchmarkMapID.Clear();
+            return;
+        }
+
+        auto pMap = m_pWorld->GetMap( m_benchmarkMapID );
+
+        // The map is only fully loaded once all its entities have been created and all the resources they requested are loaded
+        auto pResourceSystem = context.GetSystem<Resource::ResourceSystem>();
+        if ( !pMap->IsLoaded() || pMap->IsLoadingEntities() || pResourceSystem->IsBusy() )
+        {
+            return;
+        }
+
+        m_lastBenchmarkTime = m_benchmarkTimer.GetElapsedTimeMilliseconds();
+        m_lastBenchmarkMaxConcurrentLoads = pResourceSystem->GetMaxConcurrentLoads();
+        EE_LOG_MESSAGE( "Resource", "Benchmark", "Loaded map %s in %.2fms (Max Concurrent Loads: %d)", m_benchmarkMapID.c_str(), m_lastBenchmarkTime.ToFloat(), m_lastBenchmarkMaxConcurrentLoads );
+        m_benchmarkMapID.Clear();
+    }
+
+    //-------------------------------------------------------------------------
+    // World Systems
+    //-------------------------------------------------------------------------
+
+    void EntityDebugView::DrawSystemUpdateGraphs( EntityWorldUpdateContext const& context )
+    {
+        static char const* const stageNames[] = { "Frame Start", "Pre-Physics", "Physics", "Post-Physics", "Frame End", "Paused" };
+        static_assert( sizeof( stageNames ) / sizeof( stageNames[0] ) == (int32_t) UpdateStage::NumStages, "Stage names out of date" );
+
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "World System Updates", &m_isSystemUpdateGraphWindowOpen ) )
+        {
+            bool isConcurrentUpdateEnabled = m_pWorld->IsConcurrentSystemUpdateEnabled();
+            if ( ImGui::Checkbox( "Concurrent System Updates", &isConcurrentUpdateEnabled ) )
+            {
+                const_cast<EntityWorld*>( m_pWorld )->SetConcurrentSystemUpdateEnabled( isConcurrentUpdateEnabled );
+            }
+
+            bool isDeferredTransformUpdateEnabled = m_pWorld->IsDeferredTransformUpdateEnabled();
+            if ( ImGui::Checkbox( "Deferred Transform Updates", &isDeferredTransformUpdateEnabled ) )
+            {
+                const_cast<EntityWorld*>( m_pWorld )->SetDeferredTransformUpdateEnabled( isDeferredTransformUpdateEnabled );
+            }
+
+            TVector<int32_t> criticalPath;
+
+            for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+            {
+                auto const& updateGraph = m_pWorld->m_systemUpdateGraphs[i];
+                auto const& nodes = updateGraph.GetNodes();
+                if ( nodes.empty() )
+                {
+                    continue;
+                }
+
+                Milliseconds const criticalPathTime = updateGraph.GetCriticalPath( criticalPath );
+
+                ImGui::Separator();
+                ImGui::Text( "%s - %s - Critical Path: %.3fms", stageNames[i], updateGraph.IsConcurrent() ? "Concurrent" : "Serial", criticalPathTime.ToFloat() );
+
+                for ( int32_t n = 0; n < (int32_t) nodes.size(); n++ )
+                {
+                    auto const& node = nodes[n];
+                    bool const isOnCriticalPath = VectorContains( criticalPath, n );
+
+                    InlineString dependenciesStr;
+                    for ( auto dependencyIdx : node.m_dependencies )
+                    {
+                        dependenciesStr.append_sprintf( dependenciesStr.empty() ? "%s" : ", %s", nodes[dependencyIdx].m_pSystem->GetTypeInfo()->GetFriendlyTypeName() );
+                    }
+
+                    if ( isOnCriticalPath )
+                    {
+                        ImGui::PushStyleColor( ImGuiCol_Text, 0xFF00FFFF );
+                    }
+
+                    ImGui::BulletText( "%s - %.3fms%s%s", node.m_pSystem->GetTypeInfo()->GetFriendlyTypeName(), node.m_lastUpdateTime.ToFloat(), dependenciesStr.empty() ? "" : " - Waits On: ", dependenciesStr.c_str() );
+
+                    if ( isOnCriticalPath )
+                    {
+                        ImGui::PopStyleColor( 1 );
+                    }
+                }
+            }
         }
         ImGui::End();
     }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Resource/ResourceID.h"
+#include "System/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
@@ -29,6 +31,8 @@ namespace EE
         void DrawMenu( EntityWorldUpdateContext const& context );
         void DrawWorldBrowser( EntityWorldUpdateContext const& context );
         void DrawMapLoader( EntityWorldUpdateContext const& context );
+        void UpdateLoadBenchmark( EntityWorldUpdateContext const& context );
+        void DrawSystemUpdateGraphs( EntityWorldUpdateContext const& context );
 
         void DrawComponentEntry( EntityComponent const* pComponent );
         void DrawSpatialComponentTree( SpatialEntityComponent const* pComponent );
@@ -37,6 +41,13 @@ namespace EE
 
         bool                    m_isWorldBrowserOpen = false;
         bool                    m_isMapLoaderOpen = false;
+        bool                    m_isSystemUpdateGraphWindowOpen = false;
+
+        // Load Benchmark - times a map load from the request until all its entities and resources are loaded
+        ResourceID              m_benchmarkMapID;
+        Timer<PlatformClock>    m_benchmarkTimer;
+        Milliseconds            m_lastBenchmarkTime = 0.0f;
+        int32_t                 m_lastBenchmarkMaxConcurrentLoads = 0;
 
         // Browser Data
         TVector<Entity*>        m_entities;
@@ -85,15 +85,27 @@ namespace EE
         EE_ASSERT( m_status == Status::Unloaded );
         Threading::RecursiveScopeLock myLock( m_internalStateMutex );
 
+        EntityModel::LoadingContext const componentLoadingContext = GetComponentLoadingContext( loadingContext );
         for ( auto pComponent : m_components )
         {
             EE_ASSERT( pComponent->IsUnloaded() );
-            pComponent->Load( loadingContext, Resource::ResourceRequesterID( m_ID.m_value ) );
+            pComponent->Load( componentLoadingContext, Resource::ResourceRequesterID( m_ID.m_value ) );
         }
 
         m_status = Status::Loaded;
     }
 
+    EntityModel::LoadingContext Entity::GetComponentLoadingContext( EntityModel::LoadingContext const& loadingContext ) const
+    {
+        EntityModel::LoadingContext componentLoadingContext = loadingContext;
+        if ( m_hasResourcePriorityOverride )
+        {
+            componentLoadingContext.m_resourcePriority = m_resourcePriorityOverride;
+        }
+
+        return componentLoadingContext;
+    }
+
     void Entity::UnloadComponents( EntityModel::LoadingContext const& loadingContext )
     {
         EE_ASSERT( m_status == Status::Loaded );
@@ -146,6 +158,14 @@ namespace EE
 
         if ( IsSpatialEntity() )
         {
+            for ( auto pComponent : m_components )
+            {
+                if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
+                {
+                    pSpatialComponent->m_pTransformQueue = initializationContext.m_pSpatialTransformQueue;
+                }
+            }
+
             m_pRootSpatialComponent->CalculateWorldTransform( false );
         }
 
@@ -371,7 +391,7 @@ namespace EE
 
                     auto pComponent = (EntityComponent*) action.m_ptr;
                     AddComponentImmediate( pComponent, pParentComponent );
-                    pComponent->Load( loadingContext, Resource::ResourceRequesterID( m_ID.m_value ) );
+                    pComponent->Load( GetComponentLoadingContext( loadingContext ), Resource::ResourceRequesterID( m_ID.m_value ) );
                     m_deferredActions.erase( m_deferredActions.begin() + i );
                     i--;
                 }
@@ -460,6 +480,7 @@ namespace EE
 
                 if ( auto pSpatialComponent = TryCast<SpatialEntityComponent>( pComponent ) )
                 {
+                    pSpatialComponent->m_pTransformQueue = initializationContext.m_pSpatialTransformQueue;
                     pSpatialComponent->CalculateWorldTransform( false );
                 }
 
@@ -201,6 +201,14 @@ namespace EE
         inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
         inline bool HasStateChangeActionsPending() const { return !m_deferredActions.empty(); }
 
+        // Resources
+        //-------------------------------------------------------------------------
+        // By default, component resources are requested with the priority of the map the entity is in
+        // An override replaces that priority (e.g. the player's resources are always critical), it only affects requests made after it is set
+
+        inline void SetResourcePriorityOverride( Resource::ResourcePriority priority ) { EE_ASSERT( priority < Resource::ResourcePriority::NumPriorities ); m_resourcePriorityOverride = priority; m_hasResourcePriorityOverride = true; }
+        inline void ClearResourcePriorityOverride() { m_hasResourcePriorityOverride = false; }
+
         // Components
         //-------------------------------------------------------------------------
         // NB!!! Add and remove operations execute immediately for unloaded entities BUT will be deferred to the next loading phase for loaded entities
@@ -344,6 +352,9 @@ namespace EE
         // Request initial load of all components
         void LoadComponents( EntityModel::LoadingContext const& loadingContext );
 
+        // Get the loading context to use for our components, this applies our resource priority override
+        EntityModel::LoadingContext GetComponentLoadingContext( EntityModel::LoadingContext const& loadingContext ) const;
+
         // Request final unload of all components
         void UnloadComponents( EntityModel::LoadingContext const& loadingContext );
 
@@ -377,6 +388,9 @@ namespace EE
         EE_EXPOSE StringID                              m_parentAttachmentSocketID;                                             // The socket that we are attached to on the parent
         bool                                            m_isSpatialAttachmentCreated = false;                                   // Has the actual component-to-component attachment been created
 
+        Resource::ResourcePriority                      m_resourcePriorityOverride = Resource::ResourcePriority::Normal;        // The priority to request our component resources with, if the override is set
+        bool                                            m_hasResourcePriorityOverride = false;
+
         TVector<EntityInternalStateAction>              m_deferredActions;                                                      // The set of internal entity state changes that need to be executed
         Threading::RecursiveMutex                       m_internalStateMutex;                                                   // A mutex that needs to be lock due to internal state changes
     };
@@ -1,6 +1,7 @@
 #pragma once
 #include "System/Threading/Threading.h"
 #include "System/TypeSystem/TypeID.h"
+#include "System/Resource/ResourcePriority.h"
 
 //-------------------------------------------------------------------------
 
@@ -11,6 +12,7 @@ namespace EE
     class EntityComponent;
     class TaskSystem;
     class IEntityWorldSystem;
+    namespace EntityModel { class SpatialTransformQueue; }
     namespace Resource { class ResourceSystem; }
     namespace TypeSystem { class TypeRegistry; }
 }
@@ -41,6 +43,7 @@ namespace EE::EntityModel
         TaskSystem*                                                     m_pTaskSystem = nullptr;
         TypeSystem::TypeRegistry const*                                 m_pTypeRegistry = nullptr;
         Resource::ResourceSystem*                                       m_pResourceSystem = nullptr;
+        Resource::ResourcePriority                                      m_resourcePriority = Resource::ResourcePriority::Normal; // The priority with which component resources are requested
     };
 
     //-------------------------------------------------------------------------
@@ -79,13 +82,14 @@ namespace EE::EntityModel
             if ( m_pComponentTypeMap == nullptr ) return false;
             #endif
 
-            return m_pTaskSystem != nullptr && m_pTypeRegistry != nullptr;
+            return m_pTaskSystem != nullptr && m_pTypeRegistry != nullptr && m_pSpatialTransformQueue != nullptr;
         }
 
     public:
 
         TaskSystem* const                                           m_pTaskSystem = nullptr;
         TypeSystem::TypeRegistry const*                             m_pTypeRegistry = nullptr;
+        SpatialTransformQueue* const                                m_pSpatialTransformQueue = nullptr;
 
         // World system registration
         Threading::LockFreeQueue<EntityComponentPair>               m_componentsToRegister;
@@ -6,12 +6,18 @@
 #include "Entity.h"
 #include "System/Resource/ResourceSystem.h"
 #include "System/TypeSystem/TypeRegistry.h"
+#include "System/Time/Timers.h"
 #include "System/Profiling.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::EntityModel
 {
+    // The number of entities we load/initialize between budget checks when a time budget is set
+    constexpr static size_t const s_entityInitializationBatchSize = 64;
+
+    //-------------------------------------------------------------------------
+
     EntityMap::EntityMap()
         : m_entityUpdateEventBindingID( Entity::OnEntityInternalStateUpdated().Bind( [this] ( Entity* pEntity ) { OnEntityStateUpdated( pEntity ); } ) )
         , m_isTransientMap( true )
@@ -60,6 +66,7 @@ namespace EE::EntityModel
         #endif
 
         m_pMapDesc = map.m_pMapDesc;
+        m_resourcePriority = map.m_resourcePriority;
         const_cast<bool&>( m_isTransientMap ) = map.m_isTransientMap;
         return *this;
     }
@@ -76,6 +83,7 @@ namespace EE::EntityModel
         m_pMapDesc = eastl::move( map.m_pMapDesc );
         m_entitiesCurrentlyLoading = eastl::move( map.m_entitiesCurrentlyLoading );
         m_status = map.m_status;
+        m_resourcePriority = map.m_resourcePriority;
         const_cast<bool&>( m_isTransientMap ) = map.m_isTransientMap;
 
         // Clear source map
@@ -276,7 +284,7 @@ namespace EE::EntityModel
         }
         else // Request loading of map resource
         {
-            loadingContext.m_pResourceSystem->LoadResource( m_pMapDesc );
+            loadingContext.m_pResourceSystem->LoadResource( m_pMapDesc, Resource::ResourceRequesterID(), m_resourcePriority );
             m_status = Status::Loading;
         }
     }
@@ -486,7 +494,14 @@ namespace EE::EntityModel
         }
     }
 
-    void EntityMap::ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext )
+    LoadingContext EntityMap::GetEntityLoadingContext( LoadingContext const& loadingContext ) const
+    {
+        LoadingContext entityLoadingContext = loadingContext;
+        entityLoadingContext.m_resourcePriority = m_resourcePriority;
+        return entityLoadingContext;
+    }
+
+    void EntityMap::ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext, Milliseconds timeBudget )
     {
         EE_PROFILE_SCOPE_ENTITY( "Entity Loading/Initialization" );
 
@@ -509,12 +524,12 @@ namespace EE::EntityModel
 
         struct EntityLoadingTask : public ITaskSet
         {
-            EntityLoadingTask( LoadingContext const& loadingContext, InitializationContext& initializationContext, TVector<Entity*>& entitiesToLoad )
+            EntityLoadingTask( LoadingContext const& loadingContext, InitializationContext& initializationContext, Entity* const* pEntitiesToLoad, uint32_t numEntitiesToLoad )
                 : m_loadingContext( loadingContext )
                 , m_initializationContext( initializationContext )
-                , m_entitiesToLoad( entitiesToLoad )
+                , m_pEntitiesToLoad( pEntitiesToLoad )
             {
-                m_SetSize = (uint32_t) m_entitiesToLoad.size();
+                m_SetSize = numEntitiesToLoad;
             }
 
             virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
@@ -522,7 +537,7 @@ namespace EE::EntityModel
                 EE_PROFILE_SCOPE_ENTITY( "Load and Initialize Entities" );
                 for ( uint32_t i = range.start; i < range.end; ++i )
                 {
-                    auto pEntity = m_entitiesToLoad[i];
+                    auto pEntity = m_pEntitiesToLoad[i];
                     if ( pEntity->UpdateEntityState( m_loadingContext, m_initializationContext ) )
                     {
                         #if EE_DEVELOPMENT_TOOLS
@@ -567,25 +582,51 @@ namespace EE::EntityModel
 
             LoadingContext const&                   m_loadingContext;
             InitializationContext&                  m_initializationContext;
-            TVector<Entity*>&                       m_entitiesToLoad;
+            Entity* const*                          m_pEntitiesToLoad = nullptr;
         };
 
         //-------------------------------------------------------------------------
 
-        if ( !m_entitiesCurrentlyLoading.empty() )
+        if ( m_entitiesCurrentlyLoading.empty() )
+        {
+            return;
+        }
+
+        // Without a budget, we process all entities in a single batch
+        size_t const numEntitiesToProcess = m_entitiesCurrentlyLoading.size();
+        size_t const batchSize = ( timeBudget > 0.0f ) ? Math::Min( numEntitiesToProcess, s_entityInitializationBatchSize ) : numEntitiesToProcess;
+
+        Timer<PlatformClock> timer;
+        TVector<Entity*> stillLoadingEntities;
+        size_t numEntitiesProcessed = 0;
+
+        // Always process at least one batch so that we are guaranteed to make progress
+        do
         {
-            EntityLoadingTask loadingTask( loadingContext, initializationContext, m_entitiesCurrentlyLoading );
+            uint32_t const numEntitiesInBatch = (uint32_t) Math::Min( batchSize, numEntitiesToProcess - numEntitiesProcessed );
+            EntityLoadingTask loadingTask( loadingContext, initializationContext, m_entitiesCurrentlyLoading.data() + numEntitiesProcessed, numEntitiesInBatch );
             loadingContext.m_pTaskSystem->ScheduleTask( &loadingTask );
             loadingContext.m_pTaskSystem->WaitForTask( &loadingTask );
+            numEntitiesProcessed += numEntitiesInBatch;
 
-            //-------------------------------------------------------------------------
-
-            // Track the number of entities that still need loading
+            // Track the entities that still need loading
             size_t const numEntitiesStillLoading = loadingTask.m_stillLoadingEntities.size_approx();
-            m_entitiesCurrentlyLoading.resize( numEntitiesStillLoading );
-            size_t numDequeued = loadingTask.m_stillLoadingEntities.try_dequeue_bulk( m_entitiesCurrentlyLoading.data(), numEntitiesStillLoading );
+            size_t const previousSize = stillLoadingEntities.size();
+            stillLoadingEntities.resize( previousSize + numEntitiesStillLoading );
+            size_t numDequeued = loadingTask.m_stillLoadingEntities.try_dequeue_bulk( stillLoadingEntities.data() + previousSize, numEntitiesStillLoading );
             EE_ASSERT( numEntitiesStillLoading == numDequeued );
+
+            // Register the newly initialized entities so that the registration cost is included in the budget
+            if ( timeBudget > 0.0f )
+            {
+                ProcessEntityRegistrationRequests( initializationContext );
+            }
         }
+        while ( numEntitiesProcessed < numEntitiesToProcess && timer.GetElapsedTimeMilliseconds() < timeBudget );
+
+        // Any unprocessed entities are kept at the front of the list so they are processed first in the next update
+        m_entitiesCurrentlyLoading.erase( m_entitiesCurrentlyLoading.begin(), m_entitiesCurrentlyLoading.begin() + numEntitiesProcessed );
+        m_entitiesCurrentlyLoading.insert( m_entitiesCurrentlyLoading.end(), stillLoadingEntities.begin(), stillLoadingEntities.end() );
     }
 
     //-------------------------------------------------------------------------
@@ -754,7 +795,7 @@ namespace EE::EntityModel
 
     //-------------------------------------------------------------------------
 
-    bool EntityMap::UpdateLoadingAndStateChanges( LoadingContext const& loadingContext, InitializationContext& initializationContext )
+    bool EntityMap::UpdateLoadingAndStateChanges( LoadingContext const& loadingContext, InitializationContext& initializationContext, Milliseconds initializationTimeBudget )
     {
         EE_PROFILE_SCOPE_ENTITY( "Map State Update" );
         EE_ASSERT( Threading::IsMainThread() && loadingContext.IsValid() && initializationContext.IsValid() );
@@ -798,7 +839,7 @@ namespace EE::EntityModel
         // Update entity load states
         //-------------------------------------------------------------------------
 
-        ProcessEntityLoadingAndInitialization( loadingContext, initializationContext );
+        ProcessEntityLoadingAndInitialization( GetEntityLoadingContext( loadingContext ), initializationContext, initializationTimeBudget );
         ProcessEntityRegistrationRequests( initializationContext );
 
         // Return status
@@ -914,7 +955,7 @@ namespace EE::EntityModel
         EE_ASSERT( !VectorContains( m_entitiesCurrentlyLoading, pEntity ) );
         EE_ASSERT( VectorContains( m_editedEntities, pEntity ) ); // Cant end an edit that was never started!
 
-        pEntity->LoadComponents( loadingContext );
+        pEntity->LoadComponents( GetEntityLoadingContext( loadingContext ) );
         m_entitiesCurrentlyLoading.emplace_back( pEntity );
         m_editedEntities.erase_first_unsorted( pEntity );
     }
@@ -986,7 +1027,7 @@ namespace EE::EntityModel
         for ( auto pEntityToHotReload : m_entitiesToHotReload )
         {
             EE_ASSERT( pEntityToHotReload->IsUnloaded() );
-            pEntityToHotReload->LoadComponents( loadingContext );
+            pEntityToHotReload->LoadComponents( GetEntityLoadingContext( loadingContext ) );
             m_entitiesCurrentlyLoading.emplace_back( pEntityToHotReload );
         }
 
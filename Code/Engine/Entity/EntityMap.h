@@ -5,7 +5,9 @@
 #include "System/Types/Event.h"
 #include "System/Threading/Threading.h"
 #include "System/Resource/ResourcePtr.h"
+#include "System/Resource/ResourcePriority.h"
 #include "System/Math/Transform.h"
+#include "System/Time/Time.h"
 
 //-------------------------------------------------------------------------
 // Entity Map
@@ -70,6 +72,10 @@ namespace EE
             inline EntityMapID GetID() const { return m_ID; }
             inline bool IsTransientMap() const { return m_isTransientMap; }
 
+            // The priority with which the map and its entities' resources are requested, this only affects requests made after it is set
+            inline Resource::ResourcePriority GetResourcePriority() const { return m_resourcePriority; }
+            inline void SetResourcePriority( Resource::ResourcePriority priority ) { EE_ASSERT( priority < Resource::ResourcePriority::NumPriorities ); m_resourcePriority = priority; }
+
             // Loading
             //-------------------------------------------------------------------------
 
@@ -80,7 +86,9 @@ namespace EE
             //-------------------------------------------------------------------------
 
             // Updates map loading and entity state, returns true if all loading/state changes are complete, false otherwise
-            bool UpdateLoadingAndStateChanges( LoadingContext const& loadingContext, InitializationContext& initializationContext );
+            // The time budget limits how long we spend loading/initializing entities, a budget of zero means no limit
+            // Note: the budget does not cover creating the map's entities once the map descriptor has loaded, or unloading the map, both are always done in full in a single update
+            bool UpdateLoadingAndStateChanges( LoadingContext const& loadingContext, InitializationContext& initializationContext, Milliseconds initializationTimeBudget = 0.0f );
 
             // Do we have any pending entity addition or removal requests?
             inline bool HasPendingAddOrRemoveRequests() const { return ( m_entitiesToLoad.size() + m_entitiesToRemove.size() ) > 0; }
@@ -88,8 +96,12 @@ namespace EE
             bool IsLoading() const { return m_status == Status::Loading; }
             inline bool IsLoaded() const { return m_status == Status::Loaded; }
             inline bool IsUnloaded() const { return m_status == Status::Unloaded; }
+            inline bool IsUnloading() const { return m_status == Status::Unloading; }
             inline bool HasLoadingFailed() const { return m_status == Status::LoadFailed; }
 
+            // Are there any entities that are still being added or are still loading their components
+            inline bool IsLoadingEntities() const { return HasPendingAddOrRemoveRequests() || !m_entitiesCurrentlyLoading.empty(); }
+
             //-------------------------------------------------------------------------
             // Entity API
             //-------------------------------------------------------------------------
@@ -177,11 +189,14 @@ namespace EE
             void ProcessEntityRegistrationRequests( InitializationContext& initializationContext );
             void ProcessEntityShutdownRequests( InitializationContext& initializationContext );
             void ProcessEntityRemovalRequests( LoadingContext const& loadingContext );
-            void ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext );
+            void ProcessEntityLoadingAndInitialization( LoadingContext const& loadingContext, InitializationContext& initializationContext, Milliseconds timeBudget );
 
             // Remove entity
             Entity* RemoveEntityInternal( EntityID entityID, bool destroyEntityOnceRemoved );
 
+            // Get the loading context to use for our entities, this applies our resource priority
+            LoadingContext GetEntityLoadingContext( LoadingContext const& loadingContext ) const;
+
         private:
 
             EntityMapID                                 m_ID = UUID::GenerateID(); // ID is always regenerated at creation time, do not rely on the ID being the same for a map on different runs
@@ -194,6 +209,7 @@ namespace EE
             TInlineVector<RemovalRequest, 5>            m_entitiesToRemove;
             EventBindingID                              m_entityUpdateEventBindingID;
             Status                                      m_status = Status::Unloaded;
+            Resource::ResourcePriority                  m_resourcePriority = Resource::ResourcePriority::Normal;
             bool const                                  m_isTransientMap = false; // If this is set, then this is a transient map i.e.created and managed at runtime and not loaded from disk
 
             #if EE_DEVELOPMENT_TOOLS
@@ -1,4 +1,5 @@
 #include "EntitySpatialComponent.h"
+#include "EntitySpatialTransformQueue.h"
 #include "EntityLog.h"
 
 //-------------------------------------------------------------------------
@@ -123,9 +124,55 @@ namespace EE
 
     void SpatialEntityComponent::NotifySocketsUpdated()
     {
+        bool const isDeferringTransformUpdates = IsDeferringTransformUpdates();
         for ( auto& pChildComponent : m_spatialChildren )
         {
-            pChildComponent->CalculateWorldTransform();
+            if ( isDeferringTransformUpdates )
+            {
+                pChildComponent->MarkWorldTransformDirty();
+            }
+            else
+            {
+                pChildComponent->CalculateWorldTransform();
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool SpatialEntityComponent::IsDeferringTransformUpdates() const
+    {
+        return m_pTransformQueue != nullptr && m_pTransformQueue->IsDeferring();
+    }
+
+    void SpatialEntityComponent::MarkWorldTransformDirty()
+    {
+        EE_ASSERT( IsDeferringTransformUpdates() );
+
+        m_isWorldTransformDirty = true;
+
+        if ( !m_isQueuedForTransformUpdate )
+        {
+            m_isQueuedForTransformUpdate = true;
+            m_pTransformQueue->Enqueue( this );
+        }
+    }
+
+    void SpatialEntityComponent::ResolveDirtyAncestors()
+    {
+        SpatialEntityComponent* pTopMostDirtyAncestor = nullptr;
+        for ( auto pAncestor = m_pSpatialParent; pAncestor != nullptr; pAncestor = pAncestor->m_pSpatialParent )
+        {
+            if ( pAncestor->m_isWorldTransformDirty )
+            {
+                pTopMostDirtyAncestor = pAncestor;
+            }
+        }
+
+        // The ancestor stays in the queue, it will be skipped when the queue is resolved since it is no longer dirty
+        if ( pTopMostDirtyAncestor != nullptr )
+        {
+            pTopMostDirtyAncestor->CalculateWorldTransform();
         }
     }
 
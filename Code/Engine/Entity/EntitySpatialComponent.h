@@ -8,12 +8,14 @@
 
 namespace EE
 {
-    #if EE_DEVELOPMENT_TOOLS
     namespace EntityModel
     {
+        class SpatialTransformQueue;
+
+        #if EE_DEVELOPMENT_TOOLS
         class EntityStructureEditor;
+        #endif
     }
-    #endif
 
     //-------------------------------------------------------------------------
 
@@ -26,6 +28,7 @@ namespace EE
         friend EntityModel::Serializer;
         friend EntityModel::EntityMapEditor;
         friend EntityModel::EntityCollection;
+        friend EntityModel::SpatialTransformQueue;
 
         #if EE_DEVELOPMENT_TOOLS
         friend EntityModel::EntityStructureEditor;
@@ -69,18 +72,45 @@ namespace EE
         inline Vector GetRightVector() const { return m_worldTransform.GetRightVector(); }
 
         // Call to update the local transform - this will also update the world transform for this component and all children
+        // If the world is deferring transform updates, the world transforms will only be updated when the world resolves its dirty hierarchies
         inline void SetLocalTransform( Transform const& newTransform )
         {
             m_transform = newTransform;
-            CalculateWorldTransform();
+
+            if ( IsDeferringTransformUpdates() )
+            {
+                MarkWorldTransformDirty();
+            }
+            else
+            {
+                CalculateWorldTransform();
+            }
         }
 
         // Call to update the world transform - this will also updated the local transform for this component and all children's world transforms
+        // If the world is deferring transform updates, the world and local transforms are set immediately but children are only updated when the world resolves its dirty hierarchies
         inline void SetWorldTransform( Transform const& newTransform )
         {
-            SetWorldTransformDirectly( newTransform );
+            if ( IsDeferringTransformUpdates() )
+            {
+                // Our local transform is relative to our parent's current world transform, so any earlier writes to our ancestors need to be applied first
+                ResolveDirtyAncestors();
+
+                m_worldTransform = newTransform;
+                m_transform = ( m_pSpatialParent != nullptr ) ? Transform::Delta( m_pSpatialParent->GetAttachmentSocketTransform( m_parentAttachmentSocketID ), newTransform ) : newTransform;
+                m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
+                MarkWorldTransformDirty();
+            }
+            else
+            {
+                SetWorldTransformDirectly( newTransform );
+            }
         }
 
+        // Was our transform written and is our hierarchy waiting to be resolved by the deferred transform update?
+        // Note: this is only set on the component that was moved, children of a moved component are not flagged even though their world transforms are also stale
+        inline bool IsWorldTransformDirty() const { return m_isWorldTransformDirty; }
+
         // Move the component by the specified delta transform
         inline void MoveByDelta( Transform const& deltaTransform )
         {
@@ -198,6 +228,8 @@ namespace EE
                 m_transform = newWorldTransform;
             }
 
+            m_isWorldTransformDirty = false;
+
             // Calculate world bounds
             m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
 
@@ -220,6 +252,15 @@ namespace EE
 
     private:
 
+        // Are transform writes to this component currently being deferred by the world?
+        bool IsDeferringTransformUpdates() const;
+
+        // Flag this component as needing a world transform update and queue it with the world
+        void MarkWorldTransformDirty();
+
+        // Immediately resolve the hierarchy of our top-most dirty ancestor (if any), this ensures that our parent's world transform is up to date
+        void ResolveDirtyAncestors();
+
         // Called whenever the local transform is modified
         inline void CalculateWorldTransform( bool triggerCallback = true )
         {
@@ -234,6 +275,8 @@ namespace EE
                 m_worldTransform = m_transform;
             }
 
+            m_isWorldTransformDirty = false;
+
             // Calculate world bounds
             m_worldBounds = m_bounds.GetTransformed( m_worldTransform );
 
@@ -264,6 +307,12 @@ namespace EE
 
         //-------------------------------------------------------------------------
 
+        EntityModel::SpatialTransformQueue*                                 m_pTransformQueue = nullptr;            // The owning world's deferred transform queue, set on initialization
+        bool                                                                m_isWorldTransformDirty = false;        // Does our hierarchy need to be recalculated by the deferred update
+        bool                                                                m_isQueuedForTransformUpdate = false;   // Are we already in the world's deferred transform queue
+
+        //-------------------------------------------------------------------------
+
         #if EE_DEVELOPMENT_TOOLS
         bool                                                                m_boundsValidationGuard = false;
         #endif
@@ -0,0 +1,262 @@
+#include "EntitySpatialTransformQueue.h"
+#include "EntitySpatialComponent.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+#include <eastl/sort.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    // Below this number of independent hierarchies, it's cheaper to resolve everything on the calling thread
+    constexpr static int32_t const g_minHierarchiesForParallelResolve = 8;
+
+    //-------------------------------------------------------------------------
+
+    SpatialTransformQueue::~SpatialTransformQueue()
+    {
+        EE_ASSERT( !m_isDeferring );
+        EE_ASSERT( m_queuedComponents.size_approx() == 0 );
+    }
+
+    void SpatialTransformQueue::BeginDeferral()
+    {
+        EE_ASSERT( !m_isDeferring );
+        m_isDeferring = true;
+    }
+
+    void SpatialTransformQueue::EndDeferral( TaskSystem* pTaskSystem )
+    {
+        EE_ASSERT( m_isDeferring );
+
+        // Stop deferring before resolving so that any writes from the transform update callbacks are applied immediately
+        m_isDeferring = false;
+        ResolveTransforms( pTaskSystem );
+    }
+
+    void SpatialTransformQueue::Enqueue( SpatialEntityComponent* pComponent )
+    {
+        EE_ASSERT( m_isDeferring && pComponent != nullptr );
+        m_queuedComponents.enqueue( pComponent );
+    }
+
+    void SpatialTransformQueue::ResolveHierarchy( TVector<ResolutionRoot> const& resolutionRoots, int32_t startIdx, int32_t endIdx )
+    {
+        for ( int32_t i = startIdx; i < endIdx; i++ )
+        {
+            resolutionRoots[i].m_pComponent->CalculateWorldTransform();
+        }
+    }
+
+    void SpatialTransformQueue::ResolveTransforms( TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION_ENTITY();
+
+        // Collect all dirty components
+        //-------------------------------------------------------------------------
+
+        m_dequeuedComponents.clear();
+
+        SpatialEntityComponent* pQueuedComponent = nullptr;
+        while ( m_queuedComponents.try_dequeue( pQueuedComponent ) )
+        {
+            m_dequeuedComponents.emplace_back( pQueuedComponent );
+        }
+
+        if ( m_dequeuedComponents.empty() )
+        {
+            return;
+        }
+
+        // Find the resolution roots
+        //-------------------------------------------------------------------------
+        // Any component with a dirty ancestor will be updated when that ancestor is resolved, so it can be skipped
+
+        m_resolutionRoots.clear();
+
+        for ( SpatialEntityComponent* pComponent : m_dequeuedComponents )
+        {
+            pComponent->m_isQueuedForTransformUpdate = false;
+
+            // This component might have been updated immediately after being queued
+            if ( !pComponent->m_isWorldTransformDirty )
+            {
+                continue;
+            }
+
+            ResolutionRoot resolutionRoot;
+            resolutionRoot.m_pComponent = pComponent;
+            resolutionRoot.m_pHierarchyRoot = pComponent;
+
+            bool hasDirtyAncestor = false;
+            while ( resolutionRoot.m_pHierarchyRoot->m_pSpatialParent != nullptr )
+            {
+                resolutionRoot.m_pHierarchyRoot = resolutionRoot.m_pHierarchyRoot->m_pSpatialParent;
+                resolutionRoot.m_depth++;
+
+                if ( resolutionRoot.m_pHierarchyRoot->m_isWorldTransformDirty )
+                {
+                    hasDirtyAncestor = true;
+                    break;
+                }
+            }
+
+            if ( !hasDirtyAncestor )
+            {
+                m_resolutionRoots.emplace_back( resolutionRoot );
+            }
+        }
+
+        // Group the resolution roots by hierarchy, within each hierarchy resolve shallower components first
+        //-------------------------------------------------------------------------
+
+        auto SortPredicate = [] ( ResolutionRoot const& a, ResolutionRoot const& b )
+        {
+            if ( a.m_pHierarchyRoot != b.m_pHierarchyRoot )
+            {
+                return a.m_pHierarchyRoot < b.m_pHierarchyRoot;
+            }
+
+            return a.m_depth < b.m_depth;
+        };
+
+        eastl::sort( m_resolutionRoots.begin(), m_resolutionRoots.end(), SortPredicate );
+
+        m_hierarchyStartIndices.clear();
+        int32_t const numResolutionRoots = (int32_t) m_resolutionRoots.size();
+        for ( int32_t i = 0; i < numResolutionRoots; i++ )
+        {
+            if ( i == 0 || m_resolutionRoots[i].m_pHierarchyRoot != m_resolutionRoots[i - 1].m_pHierarchyRoot )
+            {
+                m_hierarchyStartIndices.emplace_back( i );
+            }
+        }
+        m_hierarchyStartIndices.emplace_back( numResolutionRoots );
+
+        // Resolve transforms
+        //-------------------------------------------------------------------------
+
+        struct ResolveTransformsTask final : public ITaskSet
+        {
+            ResolveTransformsTask( TVector<ResolutionRoot> const& resolutionRoots, TVector<int32_t> const& hierarchyStartIndices )
+                : m_resolutionRoots( resolutionRoots )
+                , m_hierarchyStartIndices( hierarchyStartIndices )
+            {
+                m_SetSize = (uint32_t) hierarchyStartIndices.size() - 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_ENTITY( "Resolve Spatial Transforms" );
+
+                for ( uint32_t h = range.start; h < range.end; h++ )
+                {
+                    ResolveHierarchy( m_resolutionRoots, m_hierarchyStartIndices[h], m_hierarchyStartIndices[h + 1] );
+                }
+            }
+
+        private:
+
+            TVector<ResolutionRoot> const&      m_resolutionRoots;
+            TVector<int32_t> const&             m_hierarchyStartIndices;
+        };
+
+        ResolveTransformsTask resolveTask( m_resolutionRoots, m_hierarchyStartIndices );
+        int32_t const numHierarchies = (int32_t) m_hierarchyStartIndices.size() - 1;
+        if ( pTaskSystem != nullptr && numHierarchies >= g_minHierarchiesForParallelResolve )
+        {
+            pTaskSystem->ScheduleTask( &resolveTask );
+            pTaskSystem->WaitForTask( &resolveTask );
+        }
+        else
+        {
+            resolveTask.ExecuteRange( { 0u, (uint32_t) numHierarchies }, 0 );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    bool SpatialTransformQueue::ValidateDeferredWrites()
+    {
+        using WriteSequence = void( * )( SpatialEntityComponent& parent, SpatialEntityComponent& child );
+
+        Transform const parentTransform( Quaternion( AxisAngle( Float3::UnitZ, Degrees( 90.0f ) ) ), Vector( 1.0f, 2.0f, 0.0f ) );
+        Transform const childTransform( Quaternion( AxisAngle( Float3::UnitX, Degrees( 45.0f ) ) ), Vector( 0.0f, 0.5f, 1.0f ) );
+
+        static WriteSequence const writeSequences[] =
+        {
+            // Child world write followed by a parent move, the child needs to move with its parent
+            [] ( SpatialEntityComponent& parent, SpatialEntityComponent& child )
+            {
+                child.SetWorldTransform( Transform( Quaternion::Identity, Vector( 3.0f, 0.0f, 0.0f ) ) );
+                parent.SetWorldTransform( Transform( Quaternion( AxisAngle( Float3::UnitY, Degrees( 30.0f ) ) ), Vector( -2.0f, 1.0f, 0.0f ) ) );
+            },
+
+            // Parent move followed by a child world write
+            [] ( SpatialEntityComponent& parent, SpatialEntityComponent& child )
+            {
+                parent.SetWorldTransform( Transform( Quaternion( AxisAngle( Float3::UnitY, Degrees( 30.0f ) ) ), Vector( -2.0f, 1.0f, 0.0f ) ) );
+                child.SetWorldTransform( Transform( Quaternion::Identity, Vector( 3.0f, 0.0f, 0.0f ) ) );
+            },
+
+            // Parent local write followed by a child world write and a second parent write
+            [] ( SpatialEntityComponent& parent, SpatialEntityComponent& child )
+            {
+                parent.SetLocalTransform( Transform( Quaternion::Identity, Vector( 0.0f, 0.0f, 4.0f ) ) );
+                child.SetWorldTransform( Transform( Quaternion( AxisAngle( Float3::UnitZ, Degrees( -60.0f ) ) ), Vector( 1.0f, 1.0f, 1.0f ) ) );
+                parent.SetLocalTransform( Transform( Quaternion( AxisAngle( Float3::UnitX, Degrees( 10.0f ) ) ), Vector( 5.0f, 0.0f, 0.0f ) ) );
+            },
+
+            // Child local write followed by a parent move
+            [] ( SpatialEntityComponent& parent, SpatialEntityComponent& child )
+            {
+                child.SetLocalTransform( Transform( Quaternion::Identity, Vector( 0.0f, 2.0f, 0.0f ) ) );
+                parent.SetWorldTransform( Transform( Quaternion( AxisAngle( Float3::UnitZ, Degrees( 180.0f ) ) ), Vector::Zero ) );
+            },
+        };
+
+        //-------------------------------------------------------------------------
+
+        bool isEquivalent = true;
+
+        for ( WriteSequence writeSequence : writeSequences )
+        {
+            Transform results[2][2] = { { Transform::Identity, Transform::Identity }, { Transform::Identity, Transform::Identity } };
+
+            for ( int32_t isDeferred = 0; isDeferred < 2; isDeferred++ )
+            {
+                SpatialTransformQueue queue;
+                SpatialEntityComponent parent;
+                SpatialEntityComponent child;
+
+                parent.SetLocalTransform( parentTransform );
+                parent.m_spatialChildren.emplace_back( &child );
+                child.m_pSpatialParent = &parent;
+                child.SetLocalTransform( childTransform );
+
+                parent.m_pTransformQueue = &queue;
+                child.m_pTransformQueue = &queue;
+
+                if ( isDeferred )
+                {
+                    queue.BeginDeferral();
+                    writeSequence( parent, child );
+                    queue.EndDeferral( nullptr );
+                }
+                else
+                {
+                    writeSequence( parent, child );
+                }
+
+                results[isDeferred][0] = parent.GetWorldTransform();
+                results[isDeferred][1] = child.GetWorldTransform();
+            }
+
+            isEquivalent &= ( results[0][0] == results[1][0] ) && ( results[0][1] == results[1][1] );
+        }
+
+        return isEquivalent;
+    }
+    #endif
+}
\ No newline at end of file
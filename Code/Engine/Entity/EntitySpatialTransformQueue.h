@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Threading/Threading.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Spatial Transform Queue
+//-------------------------------------------------------------------------
+// While deferral is active, spatial transform writes only mark the written component dirty and add it to this queue
+// Resolving the queue updates each dirty hierarchy exactly once, parents before children
+// Hierarchies that do not share a root are independent and are resolved in parallel
+// World transform writes resolve any dirty ancestors immediately, so the results match those of immediate writes regardless of the order of parent and child writes
+
+namespace EE
+{
+    class TaskSystem;
+    class SpatialEntityComponent;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API SpatialTransformQueue
+    {
+        // A dirty component that has no dirty ancestors, resolving it will also resolve all its dirty descendants
+        struct ResolutionRoot
+        {
+            SpatialEntityComponent*                             m_pHierarchyRoot = nullptr;
+            SpatialEntityComponent*                             m_pComponent = nullptr;
+            int32_t                                             m_depth = 0;
+        };
+
+    public:
+
+        ~SpatialTransformQueue();
+
+        // Are transform writes currently being deferred?
+        inline bool IsDeferring() const { return m_isDeferring; }
+
+        // Start deferring transform writes, this should only be called for the duration of a world update
+        void BeginDeferral();
+
+        // Resolve all pending transforms and stop deferring writes
+        void EndDeferral( TaskSystem* pTaskSystem );
+
+        // Queue a component whose world transform needs to be recalculated - thread-safe
+        void Enqueue( SpatialEntityComponent* pComponent );
+
+        // Recalculate the world transforms of all dirty hierarchies
+        void ResolveTransforms( TaskSystem* pTaskSystem );
+
+        #if EE_DEVELOPMENT_TOOLS
+        // Check that deferred parent and child writes result in the same transforms as immediate writes, returns false on any mismatch
+        static bool ValidateDeferredWrites();
+        #endif
+
+    private:
+
+        static void ResolveHierarchy( TVector<ResolutionRoot> const& resolutionRoots, int32_t startIdx, int32_t endIdx );
+
+    private:
+
+        Threading::LockFreeQueue<SpatialEntityComponent*>       m_queuedComponents;
+        TVector<SpatialEntityComponent*>                        m_dequeuedComponents;
+        TVector<ResolutionRoot>                                 m_resolutionRoots;
+        TVector<int32_t>                                        m_hierarchyStartIndices;
+        bool                                                    m_isDeferring = false;
+    };
+}
\ No newline at end of file
@@ -2,7 +2,9 @@
 #include "EntityWorldUpdateContext.h"
 #include "EntityWorldDebugView.h"
 #include "System/Resource/ResourceSystem.h"
+#include "System/Time/Timers.h"
 #include "System/Profiling.h"
+#include "System/Log.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include <eastl/sort.h>
 
@@ -53,6 +55,7 @@ namespace EE
 
         const_cast<TaskSystem*&>( m_initializationContext.m_pTaskSystem ) = m_pTaskSystem;
         const_cast<TypeSystem::TypeRegistry const*&>( m_initializationContext.m_pTypeRegistry ) = m_loadingContext.m_pTypeRegistry;
+        const_cast<EntityModel::SpatialTransformQueue*&>( m_initializationContext.m_pSpatialTransformQueue ) = &m_spatialTransformQueue;
         
         #if EE_DEVELOPMENT_TOOLS
         m_initializationContext.SetComponentTypeMapPtr( &m_componentTypeLookup );
@@ -63,6 +66,8 @@ namespace EE
         // Create World Systems
         //-------------------------------------------------------------------------
 
+        m_canUpdateConcurrently = true;
+
         for ( auto pTypeInfo : worldSystemTypeInfos )
         {
             // Create and initialize world system
@@ -70,6 +75,9 @@ namespace EE
             pWorldSystem->InitializeSystem( systemsRegistry );
             m_worldSystems.push_back( pWorldSystem );
 
+            // A single system touching shared state means the whole world needs to be updated serially
+            m_canUpdateConcurrently &= pWorldSystem->IsWorldLocal();
+
             // Add to update lists
             for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
             {
@@ -90,6 +98,29 @@ namespace EE
             }
         }
 
+        // Build the system update graphs once all systems have been added
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_systemUpdateGraphs[i].Build( m_systemUpdateLists[i] );
+
+            // A single undeclared system forces the whole stage to update serially, so make sure that this is never silent
+            #if EE_DEVELOPMENT_TOOLS
+            if ( m_systemUpdateLists[i].size() > 1 && !m_systemUpdateGraphs[i].IsConcurrent() )
+            {
+                for ( auto pWorldSystem : m_systemUpdateLists[i] )
+                {
+                    if ( !pWorldSystem->GetDataAccess().IsDeclared() )
+                    {
+                        EE_LOG_WARNING( "Entity", "World Systems", "World system '%s' does not declare its data access, update stage %d will be updated serially!", pWorldSystem->GetTypeInfo()->GetFriendlyTypeName(), i );
+                    }
+                }
+            }
+            #endif
+        }
+
+        // All engine pre-physics systems declare their data access, so this stage should always be able to update concurrently
+        EE_ASSERT( m_systemUpdateLists[(int8_t) UpdateStage::PrePhysics].size() <= 1 || m_systemUpdateGraphs[(int8_t) UpdateStage::PrePhysics].IsConcurrent() );
+
         // Create and initialize the persistent map
         //-------------------------------------------------------------------------
 
@@ -105,6 +136,11 @@ namespace EE
     {
         // Unload maps
         //-------------------------------------------------------------------------
+
+        {
+            Threading::ScopeLock lock( m_mapRequestMutex );
+            m_mapRequests.clear();
+        }
         
         for ( auto& pMap : m_maps )
         {
@@ -122,6 +158,11 @@ namespace EE
         // Shutdown all world systems
         //-------------------------------------------------------------------------
 
+        for ( int8_t i = 0; i < (int8_t) UpdateStage::NumStages; i++ )
+        {
+            m_systemUpdateGraphs[i].Reset();
+        }
+
         for( auto pWorldSystem : m_worldSystems )
         {
             // Remove from update lists
@@ -202,14 +243,28 @@ namespace EE
     {
         EE_PROFILE_SCOPE_ENTITY( "World Loading" );
 
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> loadingUpdateTimer( m_lastLoadingUpdateTime );
+        #endif
+
+        ProcessMapRequests();
+
         // Update all maps internal loading state
         //-------------------------------------------------------------------------
         // This will fill the world initialization/registration lists used below
         // This will also handle all hot-reload unload/load requests
+        // The entity initialization budget is shared between all maps, each map is always allowed to make some progress
 
+        Timer<PlatformClock> budgetTimer;
         for ( int32_t i = (int32_t) m_maps.size() - 1; i >= 0; i-- )
         {
-            if ( m_maps[i]->UpdateLoadingAndStateChanges( m_loadingContext, m_initializationContext ) )
+            Milliseconds remainingBudget = 0.0f;
+            if ( m_entityInitializationBudget > 0.0f )
+            {
+                remainingBudget = Math::Max( m_entityInitializationBudget - budgetTimer.GetElapsedTimeMilliseconds(), Milliseconds( 0.001f ) );
+            }
+
+            if ( m_maps[i]->UpdateLoadingAndStateChanges( m_loadingContext, m_initializationContext, remainingBudget ) )
             {
                 if ( m_maps[i]->IsUnloaded() )
                 {
@@ -222,7 +277,8 @@ namespace EE
 
     void EntityWorld::Update( UpdateContext const& context )
     {
-        EE_ASSERT( Threading::IsMainThread() );
+        // Worlds that can be updated concurrently are updated from worker threads
+        EE_ASSERT( Threading::IsMainThread() || m_canUpdateConcurrently );
         EE_ASSERT( !m_isSuspended );
 
         struct EntityUpdateTask final : public ITaskSet
@@ -299,6 +355,13 @@ namespace EE
 
         EntityWorldUpdateContext entityWorldUpdateContext( context, this );
 
+        // Transform writes are only ever deferred within the update, so no component can be destroyed while it is still queued
+        bool const deferTransformUpdates = m_isDeferredTransformUpdateEnabled;
+        if ( deferTransformUpdates )
+        {
+            m_spatialTransformQueue.BeginDeferral();
+        }
+
         // Update entities
         //-------------------------------------------------------------------------
 
@@ -309,14 +372,28 @@ namespace EE
         // Force execution on main thread for debugging purposes
         //entityUpdateTask.ExecuteRange( { 0u, (uint32_t) m_entityUpdateList.size() }, 0 );
 
+        // World systems need up to date transforms
+        if ( deferTransformUpdates )
+        {
+            m_spatialTransformQueue.ResolveTransforms( m_pTaskSystem );
+        }
+
         // Update systems
         //-------------------------------------------------------------------------
 
-        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
         {
             EE_PROFILE_SCOPE_ENTITY( "Update World Systems" );
-            EE_ASSERT( pSystem->GetRequiredUpdatePriorities().IsStageEnabled( updateStage ) );
-            pSystem->UpdateSystem( entityWorldUpdateContext );
+            m_systemUpdateGraphs[(int8_t) updateStage].Execute( m_isConcurrentSystemUpdateEnabled ? m_pTaskSystem : nullptr, entityWorldUpdateContext );
+        }
+
+        if ( deferTransformUpdates )
+        {
+            m_spatialTransformQueue.EndDeferral( m_pTaskSystem );
+        }
+
+        for ( auto pSystem : m_systemUpdateLists[(int8_t) updateStage] )
+        {
+            pSystem->PostStageUpdate( entityWorldUpdateContext );
         }
 
         //-------------------------------------------------------------------------
@@ -425,12 +502,13 @@ namespace EE
         return *foundMapIter;
     }
 
-    EntityMapID EntityWorld::LoadMap( ResourceID const& mapResourceID )
+    EntityMapID EntityWorld::LoadMap( ResourceID const& mapResourceID, Resource::ResourcePriority priority )
     {
         EE_ASSERT( mapResourceID.IsValid() && mapResourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() );
 
         EE_ASSERT( !HasMap( mapResourceID ) );
         auto pNewMap = m_maps.emplace_back( EE::New<EntityModel::EntityMap>( mapResourceID ) );
+        pNewMap->SetResourcePriority( priority );
         pNewMap->Load( m_loadingContext, m_initializationContext );
         return pNewMap->GetID();
     }
@@ -444,6 +522,79 @@ namespace EE
         ( *foundMapIter )->Unload( m_loadingContext, m_initializationContext );
     }
 
+    void EntityWorld::QueueMapLoad( ResourceID const& mapResourceID, Resource::ResourcePriority priority )
+    {
+        EE_ASSERT( mapResourceID.IsValid() && mapResourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() );
+
+        QueueMapRequest( mapResourceID, true, priority );
+    }
+
+    void EntityWorld::QueueMapUnload( ResourceID const& mapResourceID )
+    {
+        EE_ASSERT( mapResourceID.IsValid() && mapResourceID.GetResourceTypeID() == EntityModel::SerializedEntityMap::GetStaticResourceTypeID() );
+
+        QueueMapRequest( mapResourceID, false, Resource::ResourcePriority::Normal );
+    }
+
+    void EntityWorld::QueueMapRequest( ResourceID const& mapResourceID, bool isLoadRequest, Resource::ResourcePriority priority )
+    {
+        Threading::ScopeLock lock( m_mapRequestMutex );
+
+        auto const foundRequestIter = VectorFind( m_mapRequests, mapResourceID, [] ( MapRequest const& request, ResourceID const& mapResourceID ) { return request.m_mapResourceID == mapResourceID; } );
+        if ( foundRequestIter != m_mapRequests.end() )
+        {
+            foundRequestIter->m_isLoadRequest = isLoadRequest;
+            foundRequestIter->m_priority = priority;
+        }
+        else
+        {
+            m_mapRequests.emplace_back( mapResourceID, isLoadRequest, priority );
+        }
+    }
+
+    void EntityWorld::ProcessMapRequests()
+    {
+        EE_ASSERT( Threading::IsMainThread() );
+
+        Threading::ScopeLock lock( m_mapRequestMutex );
+
+        // Requests are applied in the order they were queued, any deferred requests are kept in order
+        size_t numRemainingRequests = 0;
+        for ( size_t i = 0; i < m_mapRequests.size(); i++ )
+        {
+            MapRequest const& request = m_mapRequests[i];
+            EntityModel::EntityMap* pMap = GetMap( request.m_mapResourceID );
+
+            if ( request.m_isLoadRequest )
+            {
+                // A map that is still unloading needs to complete its unload before it can be loaded again, so keep the request around
+                if ( pMap != nullptr && pMap->IsUnloading() )
+                {
+                    m_mapRequests[numRemainingRequests++] = request;
+                    continue;
+                }
+
+                if ( pMap == nullptr )
+                {
+                    LoadMap( request.m_mapResourceID, request.m_priority );
+                }
+                else
+                {
+                    pMap->SetResourcePriority( request.m_priority );
+                }
+            }
+            else
+            {
+                if ( pMap != nullptr && !pMap->IsUnloading() )
+                {
+                    UnloadMap( request.m_mapResourceID );
+                }
+            }
+        }
+
+        m_mapRequests.erase( m_mapRequests.begin() + numRemainingRequests, m_mapRequests.end() );
+    }
+
     //-------------------------------------------------------------------------
     // Editing / Hot Reload
     //-------------------------------------------------------------------------
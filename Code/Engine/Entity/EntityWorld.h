@@ -4,6 +4,8 @@
 #include "EntityContexts.h"
 #include "Entity.h"
 #include "EntityMap.h"
+#include "EntitySpatialTransformQueue.h"
+#include "EntityWorldSystemUpdateGraph.h"
 #include "System/Render/RenderViewport.h"
 #include "System/Types/Arrays.h"
 #include "System/Drawing/DebugDrawingSystem.h"
@@ -32,6 +34,15 @@ namespace EE
         friend class EntityDebugView;
         friend class EntityWorldUpdateContext;
 
+        struct MapRequest
+        {
+            MapRequest( ResourceID const& mapResourceID, bool isLoadRequest, Resource::ResourcePriority priority ) : m_mapResourceID( mapResourceID ), m_priority( priority ), m_isLoadRequest( isLoadRequest ) {}
+
+            ResourceID                      m_mapResourceID;
+            Resource::ResourcePriority      m_priority = Resource::ResourcePriority::Normal;
+            bool                            m_isLoadRequest = true;
+        };
+
     public:
 
         EntityWorld( EntityWorldType worldType = EntityWorldType::Game );
@@ -59,10 +70,37 @@ namespace EE
         // Run entity and system updates
         void Update( UpdateContext const& context );
 
+        // Can this world be updated concurrently with other worlds? i.e. do all its systems only touch world-local state
+        inline bool CanUpdateConcurrently() const { return m_canUpdateConcurrently; }
+
         // This function will handle all actual loading/unloading operations for the world/maps.
         // Any queued requests will be handled here as will any requests to the resource system.
         void UpdateLoading();
 
+        // Get the time budget for entity loading/initialization per loading update - zero means there is no limit
+        inline Milliseconds GetEntityInitializationBudget() const { return m_entityInitializationBudget; }
+
+        // Limit the time spent loading/initializing entities per loading update, any remaining work is spread across subsequent updates
+        // Note: creating a newly loaded map's entities and unloading a map are not budgeted, each is always done in full within a single update
+        inline void SetEntityInitializationBudget( Milliseconds budget ) { EE_ASSERT( budget >= 0.0f ); m_entityInitializationBudget = budget; }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // How long did the last loading update take
+        inline Milliseconds GetLastLoadingUpdateTime() const { return m_lastLoadingUpdateTime; }
+        #endif
+
+        // Are spatial transform writes made during world updates deferred?
+        inline bool IsDeferredTransformUpdateEnabled() const { return m_isDeferredTransformUpdateEnabled; }
+
+        // When enabled, any transform writes during the entity and system updates will only mark the hierarchy as dirty
+        // All dirty hierarchies are then resolved once after the entity updates and once after the world system updates of each stage
+        // Note: world transforms of children (and anything derived from a local transform write) are stale until the hierarchy is resolved
+        inline void SetDeferredTransformUpdateEnabled( bool isEnabled ) { m_isDeferredTransformUpdateEnabled = isEnabled; }
+
+        // Are world systems with non-conflicting data access updated concurrently within a stage?
+        inline bool IsConcurrentSystemUpdateEnabled() const { return m_isConcurrentSystemUpdateEnabled; }
+        inline void SetConcurrentSystemUpdateEnabled( bool isEnabled ) { m_isConcurrentSystemUpdateEnabled = isEnabled; }
+
         //-------------------------------------------------------------------------
         // Systems
         //-------------------------------------------------------------------------
@@ -164,9 +202,15 @@ namespace EE
         bool IsMapLoaded( EntityMapID const& mapID ) const;
 
         // These functions queue up load and unload requests to be processed during the next loading update for the world
-        EntityMapID LoadMap( ResourceID const& mapResourceID );
+        // The priority is used for the map and its entities' resource requests
+        EntityMapID LoadMap( ResourceID const& mapResourceID, Resource::ResourcePriority priority = Resource::ResourcePriority::Normal );
         void UnloadMap( ResourceID const& mapResourceID );
 
+        // Threadsafe deferred versions of the above, these are applied at the start of the next loading update
+        // A new request for a map replaces any previously queued request for that map, a load request for an existing map updates its priority
+        void QueueMapLoad( ResourceID const& mapResourceID, Resource::ResourcePriority priority = Resource::ResourcePriority::Normal );
+        void QueueMapUnload( ResourceID const& mapResourceID );
+
         // Find an entity in the map
         inline Entity* FindEntity( EntityID entityID ) const
         {
@@ -267,6 +311,13 @@ namespace EE
         void EndHotReload();
         #endif
 
+    private:
+
+        void QueueMapRequest( ResourceID const& mapResourceID, bool isLoadRequest, Resource::ResourcePriority priority );
+
+        // Apply all queued map load/unload requests
+        void ProcessMapRequests();
+
     private:
 
         EntityWorldID                                                           m_worldID = UUID::GenerateID();
@@ -278,14 +329,22 @@ namespace EE
         EntityWorldType                                                         m_worldType = EntityWorldType::Game;
         bool                                                                    m_initialized = false;
         bool                                                                    m_isSuspended = false;
+        bool                                                                    m_isDeferredTransformUpdateEnabled = true;
+        bool                                                                    m_canUpdateConcurrently = false;
+        bool                                                                    m_isConcurrentSystemUpdateEnabled = true;
         Render::Viewport                                                        m_viewport = Render::Viewport( Int2::Zero, Int2( 640, 480 ), Math::ViewVolume( Float2( 640, 480 ), FloatRange( 0.1f, 100.0f ) ) );
 
         // Maps
         TInlineVector<EntityModel::EntityMap*, 3>                               m_maps;
+        Threading::Mutex                                                        m_mapRequestMutex;
+        TVector<MapRequest>                                                     m_mapRequests;
+        Milliseconds                                                            m_entityInitializationBudget = 0.0f;
 
         // Entities
         TVector<Entity*>                                                        m_entityUpdateList;
         TVector<IEntityWorldSystem*>                                            m_systemUpdateLists[(int8_t) UpdateStage::NumStages];
+        EntityModel::SystemUpdateGraph                                          m_systemUpdateGraphs[(int8_t) UpdateStage::NumStages];
+        EntityModel::SpatialTransformQueue                                      m_spatialTransformQueue;
 
         // Time Scaling + Pause
         float                                                                   m_timeScale = 1.0f; // <= 0 means that the world is paused
@@ -297,6 +356,7 @@ namespace EE
         Drawing::DrawingSystem                                                  m_debugDrawingSystem;
         TVector<EntityWorldDebugView*>                                          m_debugViews;
         String                                                                  m_debugName;
+        Milliseconds                                                            m_lastLoadingUpdateTime = 0.0f;
         #endif
     };
 }
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include "System/TypeSystem/TypeRegistry.h"
 #include "Engine/UpdateContext.h"
 #include "System/Systems.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
 
 //-------------------------------------------------------------------------
 
@@ -174,30 +176,62 @@ namespace EE
         }
     }
 
-    void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
+    void EntityWorldManager::UpdateWorld( EntityWorld* pWorld, UpdateContext const& context )
     {
+        EE_ASSERT( pWorld != nullptr && !pWorld->IsSuspended() );
+
+        // Run world updates
         //-------------------------------------------------------------------------
-        // World Update
+
+        pWorld->Update( context );
+
+        // Update world view
         //-------------------------------------------------------------------------
+        // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
 
-        for ( auto const& pWorld : m_worlds )
+        if ( context.GetUpdateStage() == UpdateStage::PostPhysics && pWorld->GetViewport() != nullptr )
         {
-            if ( pWorld->IsSuspended() )
+            auto pViewport = pWorld->GetViewport();
+            auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
+            if ( pCameraManager->HasActiveCamera() )
             {
-                continue;
+                auto pActiveCamera = pCameraManager->GetActiveCamera();
+
+                // Update camera view dimensions if needed
+                if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
+                {
+                    pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
+                }
+
+                // Update world viewport
+                pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
             }
+        }
+    }
 
-            // Reflect input state
-            //-------------------------------------------------------------------------
+    void EntityWorldManager::UpdateWorlds( UpdateContext const& context )
+    {
+        //-------------------------------------------------------------------------
+        // Reflect input state
+        //-------------------------------------------------------------------------
+        // This is done up front on the main thread, so that worlds never touch the input system during their update
 
-            if ( context.GetUpdateStage() == UpdateStage::FrameStart )
+        if ( context.GetUpdateStage() == UpdateStage::FrameStart )
+        {
+            auto pInputSystem = context.GetSystem<Input::InputSystem>();
+
+            for ( auto const& pWorld : m_worlds )
             {
+                if ( pWorld->IsSuspended() )
+                {
+                    continue;
+                }
+
                 auto pPlayerManager = pWorld->GetWorldSystem<PlayerManager>();
                 auto pWorldInputState = pWorld->GetInputState();
 
                 if ( pPlayerManager->IsPlayerEnabled() )
                 {
-                    auto pInputSystem = context.GetSystem<Input::InputSystem>();
                     pInputSystem->ReflectState( context.GetDeltaTime(), pWorld->GetTimeScale(), *pWorldInputState );
                 }
                 else
@@ -205,34 +239,78 @@ namespace EE
                     pWorldInputState->Clear();
                 }
             }
+        }
 
-            // Run world updates
-            //-------------------------------------------------------------------------
+        //-------------------------------------------------------------------------
+        // World Update
+        //-------------------------------------------------------------------------
+        // Worlds that only contain world-local systems are updated concurrently, each world is a separate task
+        // All other worlds are updated serially on the main thread once the concurrent updates have completed
 
-            pWorld->Update( context );
+        TInlineVector<EntityWorld*, 5> concurrentWorlds;
+        TInlineVector<EntityWorld*, 5> serialWorlds;
 
-            // Update world view
-            //-------------------------------------------------------------------------
-            // We explicitly reflect the camera at the end of the post-physics stage as we assume it has been updated at that point
+        for ( auto const& pWorld : m_worlds )
+        {
+            if ( pWorld->IsSuspended() )
+            {
+                continue;
+            }
+
+            if ( m_concurrentWorldUpdatesEnabled && pWorld->CanUpdateConcurrently() )
+            {
+                concurrentWorlds.emplace_back( pWorld );
+            }
+            else
+            {
+                serialWorlds.emplace_back( pWorld );
+            }
+        }
+
+        // Not worth the scheduling overhead for a single world
+        if ( concurrentWorlds.size() == 1 )
+        {
+            serialWorlds.insert( serialWorlds.begin(), concurrentWorlds[0] );
+            concurrentWorlds.clear();
+        }
 
-            if ( context.GetUpdateStage() == UpdateStage::PostPhysics && pWorld->GetViewport() != nullptr )
+        if ( !concurrentWorlds.empty() )
+        {
+            struct WorldUpdateTask final : public ITaskSet
             {
-                auto pViewport = pWorld->GetViewport();
-                auto pCameraManager = pWorld->GetWorldSystem<CameraManager>();
-                if ( pCameraManager->HasActiveCamera() )
+                WorldUpdateTask( EntityWorldManager* pWorldManager, UpdateContext const& context, TInlineVector<EntityWorld*, 5> const& worlds )
+                    : m_pWorldManager( pWorldManager )
+                    , m_context( context )
+                    , m_worlds( worlds )
                 {
-                    auto pActiveCamera = pCameraManager->GetActiveCamera();
+                    m_SetSize = (uint32_t) worlds.size();
+                }
 
-                    // Update camera view dimensions if needed
-                    if ( pViewport->GetDimensions() != pActiveCamera->GetViewVolume().GetViewDimensions() )
+                virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+                {
+                    for ( uint32_t i = range.start; i < range.end; i++ )
                     {
-                        pActiveCamera->UpdateViewDimensions( pViewport->GetDimensions() );
+                        EE_PROFILE_SCOPE_ENTITY( "Update World" );
+                        m_pWorldManager->UpdateWorld( m_worlds[i], m_context );
                     }
-
-                    // Update world viewport
-                    pViewport->SetViewVolume( pActiveCamera->GetViewVolume() );
                 }
-            }
+
+            private:
+
+                EntityWorldManager*                         m_pWorldManager = nullptr;
+                UpdateContext const&                        m_context;
+                TInlineVector<EntityWorld*, 5> const&       m_worlds;
+            };
+
+            auto pTaskSystem = context.GetSystem<TaskSystem>();
+            WorldUpdateTask worldUpdateTask( this, context, concurrentWorlds );
+            pTaskSystem->ScheduleTask( &worldUpdateTask );
+            pTaskSystem->WaitForTask( &worldUpdateTask );
+        }
+
+        for ( auto pWorld : serialWorlds )
+        {
+            UpdateWorld( pWorld, context );
         }
 
         //-------------------------------------------------------------------------
@@ -67,6 +67,10 @@ namespace EE
         // Run the world update - updates all entities, systems and camera
         void UpdateWorlds( UpdateContext const& context );
 
+        // Should worlds that only contain world-local systems be updated concurrently?
+        inline bool AreConcurrentWorldUpdatesEnabled() const { return m_concurrentWorldUpdatesEnabled; }
+        inline void SetConcurrentWorldUpdatesEnabled( bool isEnabled ) { m_concurrentWorldUpdatesEnabled = isEnabled; }
+
         // Hot Reload
         //-------------------------------------------------------------------------
 
@@ -75,11 +79,17 @@ namespace EE
         void EndHotReload();
         #endif
 
+    private:
+
+        // Updates a single world and reflects its camera into its viewport, safe to call concurrently for worlds that can update concurrently
+        void UpdateWorld( EntityWorld* pWorld, UpdateContext const& context );
+
     private:
 
         SystemRegistry const*                               m_pSystemsRegistry = nullptr;
         TInlineVector<EntityWorld*, 5>                      m_worlds;
         TVector<TypeSystem::TypeInfo const*>                m_worldSystemTypeInfos;
+        bool                                                m_concurrentWorldUpdatesEnabled = true;
 
         #if EE_DEVELOPMENT_TOOLS
         TVector<TypeSystem::TypeInfo const*>                m_debugViewTypeInfos;
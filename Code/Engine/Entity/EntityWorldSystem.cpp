@@ -1,3 +1,45 @@
 #include "EntityWorldSystem.h"
 
 //-------------------------------------------------------------------------
+
+namespace EE
+{
+    namespace
+    {
+        // Derived types are considered to be the same data as their parents, i.e. writing a derived component conflicts with reading its base type
+        bool DoTypesOverlap( TypeSystem::TypeInfo const* pTypeA, TypeSystem::TypeInfo const* pTypeB )
+        {
+            EE_ASSERT( pTypeA != nullptr && pTypeB != nullptr );
+            return pTypeA->IsDerivedFrom( pTypeB->m_ID ) || pTypeB->IsDerivedFrom( pTypeA->m_ID );
+        }
+
+        bool DoTypeListsOverlap( TInlineVector<TypeSystem::TypeInfo const*, 4> const& listA, TInlineVector<TypeSystem::TypeInfo const*, 4> const& listB )
+        {
+            for ( auto pTypeA : listA )
+            {
+                for ( auto pTypeB : listB )
+                {
+                    if ( DoTypesOverlap( pTypeA, pTypeB ) )
+                    {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool EntityWorldSystemDataAccess::ConflictsWith( EntityWorldSystemDataAccess const& other ) const
+    {
+        // We have no idea what undeclared systems touch
+        if ( !m_isDeclared || !other.m_isDeclared )
+        {
+            return true;
+        }
+
+        return DoTypeListsOverlap( m_writes, other.m_writes ) || DoTypeListsOverlap( m_writes, other.m_reads ) || DoTypeListsOverlap( m_reads, other.m_writes );
+    }
+}
\ No newline at end of file
@@ -18,7 +18,78 @@ namespace EE
     class EntityWorldUpdateContext;
     class Entity;
     class EntityComponent;
-    namespace EntityModel { class EntityMap; }
+    namespace EntityModel { class EntityMap; class SystemUpdateGraph; }
+
+    //-------------------------------------------------------------------------
+    // World System Data Access
+    //-------------------------------------------------------------------------
+    // World systems can declare the registered types (components, other world systems, etc.) they read and write in their update
+    // This is done in the registration macro, i.e. EE_REGISTER_ENTITY_WORLD_SYSTEM( MySystem, RequiresUpdate( ... ), ReadsData<A, B>(), WritesData<C>() )
+    // The world uses this to update all non-conflicting systems within a stage concurrently
+    // Systems that do not declare any access are assumed to touch everything and force their stages to be updated serially
+
+    template<typename... T> struct ReadsData {};
+    template<typename... T> struct WritesData {};
+
+    class EE_ENGINE_API EntityWorldSystemDataAccess
+    {
+    public:
+
+        EntityWorldSystemDataAccess() = default;
+
+        template<typename... Args>
+        EntityWorldSystemDataAccess( Args&&... args )
+        {
+            ( Add( std::forward<Args>( args ) ), ... );
+        }
+
+        inline bool IsDeclared() const { return m_isDeclared; }
+
+        // Do these two sets of accesses need to be ordered? i.e. does either of them write to something the other one touches
+        bool ConflictsWith( EntityWorldSystemDataAccess const& other ) const;
+
+    private:
+
+        inline void Add( UpdateStagePriority const& ) {}
+
+        template<typename... T>
+        inline void Add( ReadsData<T...> const& )
+        {
+            m_isDeclared = true;
+            ( m_reads.emplace_back( T::s_pTypeInfo ), ... );
+        }
+
+        template<typename... T>
+        inline void Add( WritesData<T...> const& )
+        {
+            m_isDeclared = true;
+            ( m_writes.emplace_back( T::s_pTypeInfo ), ... );
+        }
+
+    private:
+
+        TInlineVector<TypeSystem::TypeInfo const*, 4>       m_reads;
+        TInlineVector<TypeSystem::TypeInfo const*, 4>       m_writes;
+        bool                                                m_isDeclared = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    namespace EntityModel
+    {
+        inline void AddToUpdatePriorityList( UpdatePriorityList& list, UpdateStagePriority&& stagePriority ) { list.SetStagePriority( std::move( stagePriority ) ); }
+        template<typename... T> inline void AddToUpdatePriorityList( UpdatePriorityList& list, ReadsData<T...> const& ) {}
+        template<typename... T> inline void AddToUpdatePriorityList( UpdatePriorityList& list, WritesData<T...> const& ) {}
+
+        // Creates the update priority list from the registration macro arguments, skipping any data access declarations
+        template<typename... Args>
+        inline UpdatePriorityList CreateWorldSystemUpdatePriorityList( Args&&... args )
+        {
+            UpdatePriorityList list;
+            ( AddToUpdatePriorityList( list, std::forward<Args>( args ) ), ... );
+            return list;
+        }
+    }
 
     //-------------------------------------------------------------------------
 
@@ -28,22 +99,33 @@ namespace EE
 
         friend class EntityWorld;
         friend EntityModel::EntityMap;
+        friend EntityModel::SystemUpdateGraph;
 
     public:
 
         virtual uint32_t GetSystemID() const = 0;
 
+        // Does this system only ever touch state owned by its world (or state that is explicitly thread-safe)?
+        // Worlds whose systems are all world-local can be updated concurrently with other worlds
+        virtual bool IsWorldLocal() const { return false; }
+
     protected:
 
         // Get the required update stages and priorities for this component
         virtual UpdatePriorityList const& GetRequiredUpdatePriorities() = 0;
 
+        // Get the data this system reads and writes during its update
+        virtual EntityWorldSystemDataAccess const& GetDataAccess() const = 0;
+
         // Called when the system is registered with the world - using explicit "EntitySystem" name to allow for a standalone initialize function
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) {};
 
         // Called when the system is removed from the world - using explicit "EntitySystem" name to allow for a standalone shutdown function
         virtual void ShutdownSystem() {};
 
+        // Called at the end of each stage this system updates in, once all entity and world system updates for that stage have completed
+        virtual void PostStageUpdate( EntityWorldUpdateContext const& ctx ) {};
+
         // System Update - using explicit "EntitySystem" name to allow for a standalone update functions
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) {};
 
@@ -62,4 +144,5 @@ namespace EE
     constexpr static uint32_t const s_entitySystemID = Hash::FNV1a::GetHash32( #Type );\
     virtual uint32_t GetSystemID() const override final { return Type::s_entitySystemID; }\
     static UpdatePriorityList const PriorityList;\
-    virtual UpdatePriorityList const& GetRequiredUpdatePriorities() override { static UpdatePriorityList const priorityList = UpdatePriorityList( __VA_ARGS__ ); return priorityList; };\
+    virtual UpdatePriorityList const& GetRequiredUpdatePriorities() override { static UpdatePriorityList const priorityList = EE::EntityModel::CreateWorldSystemUpdatePriorityList( __VA_ARGS__ ); return priorityList; };\
+    virtual EE::EntityWorldSystemDataAccess const& GetDataAccess() const override { static EE::EntityWorldSystemDataAccess const dataAccess = EE::EntityWorldSystemDataAccess( __VA_ARGS__ ); return dataAccess; };\
@@ -0,0 +1,245 @@
+#include "EntityWorldSystemUpdateGraph.h"
+#include "EntityWorldSystem.h"
+#include "EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Time/Timers.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class SystemUpdateGraph::SystemUpdateTask final : public ITaskSet
+    {
+    public:
+
+        SystemUpdateTask( Node* pNode )
+            : m_pNode( pNode )
+        {
+            m_SetSize = 1;
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_ASSERT( m_pContext != nullptr );
+            SystemUpdateGraph::UpdateSystem( *m_pNode, *m_pContext );
+        }
+
+    public:
+
+        Node*                                                   m_pNode = nullptr;
+        EntityWorldUpdateContext const*                         m_pContext = nullptr;
+        TVector<enki::Dependency>                               m_dependencies;
+    };
+
+    //-------------------------------------------------------------------------
+
+    SystemUpdateGraph::~SystemUpdateGraph()
+    {
+        EE_ASSERT( m_nodes.empty() && m_tasks.empty() );
+    }
+
+    void SystemUpdateGraph::Build( TVector<IEntityWorldSystem*> const& systemUpdateList )
+    {
+        Reset();
+
+        int32_t const numSystems = (int32_t) systemUpdateList.size();
+        EE_ASSERT( numSystems <= 64 );
+
+        // Create dependencies
+        //-------------------------------------------------------------------------
+        // Only add a dependency if the earlier system is not already an ancestor of the node, this keeps the graph minimal
+
+        TInlineVector<uint64_t, 16> ancestors;
+        ancestors.resize( numSystems, 0 );
+
+        bool areAllAccessesDeclared = true;
+        m_nodes.resize( numSystems );
+
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            Node& node = m_nodes[i];
+            node.m_pSystem = systemUpdateList[i];
+
+            EntityWorldSystemDataAccess const& dataAccess = node.m_pSystem->GetDataAccess();
+            areAllAccessesDeclared &= dataAccess.IsDeclared();
+
+            for ( int32_t j = i - 1; j >= 0; j-- )
+            {
+                if ( ( ancestors[i] & ( 1ull << j ) ) != 0 )
+                {
+                    continue;
+                }
+
+                if ( dataAccess.ConflictsWith( m_nodes[j].m_pSystem->GetDataAccess() ) )
+                {
+                    node.m_dependencies.emplace_back( j );
+                    m_nodes[j].m_dependents.emplace_back( i );
+                    ancestors[i] |= ( 1ull << j ) | ancestors[j];
+                }
+            }
+        }
+
+        // The graph is only worth executing if at least one pair of adjacent systems is independent
+        // Since dependencies always point to earlier systems, a system can only depend on the one preceding it directly
+        //-------------------------------------------------------------------------
+
+        m_isConcurrent = false;
+
+        if ( areAllAccessesDeclared )
+        {
+            for ( int32_t i = 1; i < numSystems; i++ )
+            {
+                if ( ( ancestors[i] & ( 1ull << ( i - 1 ) ) ) == 0 )
+                {
+                    m_isConcurrent = true;
+                    break;
+                }
+            }
+        }
+
+        if ( !m_isConcurrent )
+        {
+            return;
+        }
+
+        // Create tasks
+        //-------------------------------------------------------------------------
+        // Nodes are not modified after this point so the task node ptrs remain valid
+
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            m_tasks.emplace_back( EE::New<SystemUpdateTask>( &m_nodes[i] ) );
+        }
+
+        for ( int32_t i = 0; i < numSystems; i++ )
+        {
+            Node const& node = m_nodes[i];
+            SystemUpdateTask* pTask = m_tasks[i];
+
+            pTask->m_dependencies.resize( node.m_dependencies.size() );
+            for ( int32_t d = 0; d < (int32_t) node.m_dependencies.size(); d++ )
+            {
+                pTask->m_dependencies[d].SetDependency( m_tasks[node.m_dependencies[d]], pTask );
+            }
+
+            if ( node.m_dependencies.empty() )
+            {
+                m_rootNodes.emplace_back( i );
+            }
+
+            if ( node.m_dependents.empty() )
+            {
+                m_leafNodes.emplace_back( i );
+            }
+        }
+    }
+
+    void SystemUpdateGraph::Reset()
+    {
+        // Destroy in reverse order, since tasks only ever depend on earlier tasks
+        for ( int32_t i = (int32_t) m_tasks.size() - 1; i >= 0; i-- )
+        {
+            EE::Delete( m_tasks[i] );
+        }
+
+        m_tasks.clear();
+        m_nodes.clear();
+        m_rootNodes.clear();
+        m_leafNodes.clear();
+        m_isConcurrent = false;
+    }
+
+    void SystemUpdateGraph::UpdateSystem( Node& node, EntityWorldUpdateContext const& context )
+    {
+        EE_PROFILE_SCOPE_ENTITY( "Update World System" );
+
+        #if EE_DEVELOPMENT_TOOLS
+        ScopedTimer<PlatformClock> timer( node.m_lastUpdateTime );
+        #endif
+
+        node.m_pSystem->UpdateSystem( context );
+    }
+
+    void SystemUpdateGraph::Execute( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context )
+    {
+        if ( !m_isConcurrent || pTaskSystem == nullptr )
+        {
+            for ( auto& node : m_nodes )
+            {
+                UpdateSystem( node, context );
+            }
+
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        for ( auto pTask : m_tasks )
+        {
+            EE_ASSERT( pTask->GetIsComplete() );
+            pTask->m_pContext = &context;
+        }
+
+        // Scheduling the roots will run the rest of the graph as dependencies complete
+        for ( auto rootIdx : m_rootNodes )
+        {
+            pTaskSystem->ScheduleTask( m_tasks[rootIdx] );
+        }
+
+        // Every node is an ancestor of some leaf, so once all leaves are complete the whole graph is complete
+        for ( auto leafIdx : m_leafNodes )
+        {
+            pTaskSystem->WaitForTask( m_tasks[leafIdx] );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    Milliseconds SystemUpdateGraph::GetCriticalPath( TVector<int32_t>& outNodeIndices ) const
+    {
+        outNodeIndices.clear();
+
+        int32_t const numNodes = (int32_t) m_nodes.size();
+        if ( numNodes == 0 )
+        {
+            return Milliseconds( 0.0f );
+        }
+
+        // Nodes are already topologically sorted, so we can calculate the earliest finish time of each node in a single pass
+        TInlineVector<float, 16> finishTimes;
+        TInlineVector<int32_t, 16> criticalDependency;
+        finishTimes.resize( numNodes, 0.0f );
+        criticalDependency.resize( numNodes, InvalidIndex );
+
+        int32_t lastNodeIdx = 0;
+        for ( int32_t i = 0; i < numNodes; i++ )
+        {
+            float startTime = 0.0f;
+            for ( auto dependencyIdx : m_nodes[i].m_dependencies )
+            {
+                if ( finishTimes[dependencyIdx] > startTime )
+                {
+                    startTime = finishTimes[dependencyIdx];
+                    criticalDependency[i] = dependencyIdx;
+                }
+            }
+
+            finishTimes[i] = startTime + m_nodes[i].m_lastUpdateTime.ToFloat();
+            if ( finishTimes[i] > finishTimes[lastNodeIdx] )
+            {
+                lastNodeIdx = i;
+            }
+        }
+
+        // Walk back from the latest finishing node
+        for ( int32_t nodeIdx = lastNodeIdx; nodeIdx != InvalidIndex; nodeIdx = criticalDependency[nodeIdx] )
+        {
+            outNodeIndices.insert( outNodeIndices.begin(), nodeIdx );
+        }
+
+        return Milliseconds( finishTimes[lastNodeIdx] );
+    }
+    #endif
+}
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Types/Arrays.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// World System Update Graph
+//-------------------------------------------------------------------------
+// Dependency graph for all the world systems that update in a given stage
+// Systems are ordered by their update priority and a system depends on every earlier system whose declared data access conflicts with its own
+// The graph is executed as a set of dependent tasks, so any systems that do not depend on each other are updated concurrently
+
+namespace EE
+{
+    class TaskSystem;
+    class IEntityWorldSystem;
+    class EntityWorldUpdateContext;
+}
+
+//-------------------------------------------------------------------------
+
+namespace EE::EntityModel
+{
+    class EE_ENGINE_API SystemUpdateGraph
+    {
+        class SystemUpdateTask;
+
+    public:
+
+        struct Node
+        {
+            IEntityWorldSystem*                                 m_pSystem = nullptr;
+            TInlineVector<int32_t, 4>                           m_dependencies;         // The nodes that need to complete before this one can run
+            TInlineVector<int32_t, 4>                           m_dependents;           // The nodes that are waiting on this one
+
+            #if EE_DEVELOPMENT_TOOLS
+            Milliseconds                                        m_lastUpdateTime = 0.0f;
+            #endif
+        };
+
+    public:
+
+        ~SystemUpdateGraph();
+
+        // Build the graph from a priority sorted system update list
+        void Build( TVector<IEntityWorldSystem*> const& systemUpdateList );
+        void Reset();
+
+        // Can this graph run any of its systems concurrently? If not, the systems should just be updated serially in priority order
+        inline bool IsConcurrent() const { return m_isConcurrent; }
+
+        // Run all system updates and wait for them to complete
+        // If the graph is not concurrent or no task system is supplied, the systems are updated serially in priority order on the calling thread
+        void Execute( TaskSystem* pTaskSystem, EntityWorldUpdateContext const& context );
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline TVector<Node> const& GetNodes() const { return m_nodes; }
+
+        // Get the most expensive chain of dependent systems from the last execution, returns the total time of the chain
+        Milliseconds GetCriticalPath( TVector<int32_t>& outNodeIndices ) const;
+        #endif
+
+    private:
+
+        static void UpdateSystem( Node& node, EntityWorldUpdateContext const& context );
+
+    private:
+
+        TVector<Node>                                           m_nodes;
+        TVector<SystemUpdateTask*>                              m_tasks;
+        TInlineVector<int32_t, 4>                               m_rootNodes;
+        TInlineVector<int32_t, 4>                               m_leafNodes;
+        bool                                                    m_isConcurrent = false;
+    };
+}
\ No newline at end of file
@@ -44,6 +44,22 @@ namespace EE
         return m_pWorld->GetPersistentMap();
     }
 
+    void EntityWorldUpdateContext::RequestMapLoad( ResourceID const& mapResourceID, Resource::ResourcePriority priority ) const
+    {
+        m_pWorld->QueueMapLoad( mapResourceID, priority );
+    }
+
+    bool EntityWorldUpdateContext::HasMapLoadingFailed( ResourceID const& mapResourceID ) const
+    {
+        EntityModel::EntityMap const* pMap = const_cast<EntityWorld const*>( m_pWorld )->GetMap( mapResourceID );
+        return pMap != nullptr && pMap->HasLoadingFailed();
+    }
+
+    void EntityWorldUpdateContext::RequestMapUnload( ResourceID const& mapResourceID ) const
+    {
+        m_pWorld->QueueMapUnload( mapResourceID );
+    }
+
     Render::Viewport const* EntityWorldUpdateContext::GetViewport() const
     {
         return m_pWorld->GetViewport();
@@ -1,6 +1,7 @@
 #pragma once
 #include "Engine/_Module/API.h"
 #include "EntityIDs.h"
+#include "System/Resource/ResourcePriority.h"
 #include "Engine/UpdateContext.h"
 
 //-------------------------------------------------------------------------
@@ -9,6 +10,7 @@ namespace EE
 {
     class IEntityWorldSystem;
     class EntityWorld;
+    class ResourceID;
     namespace Input { class InputState; }
     namespace Render { class Viewport; }
     namespace EntityModel{ class EntityMap; }
@@ -47,6 +49,13 @@ namespace EE
         // Get the persistent map - threadsafe - all dynamic entity creation is done in this map
         EntityModel::EntityMap* GetPersistentMap() const;
 
+        // Queue a map load/unload request - threadsafe - requests are applied during the next loading update of the world
+        void RequestMapLoad( ResourceID const& mapResourceID, Resource::ResourcePriority priority = Resource::ResourcePriority::Normal ) const;
+        void RequestMapUnload( ResourceID const& mapResourceID ) const;
+
+        // Has the load of the specified map failed? - threadsafe since maps are only added/removed during the world's loading update
+        bool HasMapLoadingFailed( ResourceID const& mapResourceID ) const;
+
         // Get the viewport for this world
         Render::Viewport const* GetViewport() const;
 
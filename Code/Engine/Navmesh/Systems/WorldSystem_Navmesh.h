@@ -62,6 +62,13 @@ namespace EE::Navmesh
         void RegisterNavmesh( NavmeshComponent* pComponent );
         void UnregisterNavmesh( NavmeshComponent* pComponent );
 
+        // The NavPower middleware makes no guarantees about simulating multiple instances concurrently
+        #if EE_ENABLE_NAVPOWER
+        virtual bool IsWorldLocal() const override { return false; }
+        #else
+        virtual bool IsWorldLocal() const override { return true; }
+        #endif
+
         void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
     private:
@@ -93,6 +93,14 @@ namespace EE::Physics
         // Note: the actual physics actor will only be moved during the next physics simulation step
         void MoveTo( Transform const& newWorldTransform );
 
+        // Simulated Poses
+        //-------------------------------------------------------------------------
+        // Dynamic actors are simulated at a fixed time step, these are the actor poses after the last two simulation steps
+        // The world transform of a dynamic component is interpolated between these poses, based on how far we are into the next step
+
+        inline Transform const& GetPreviousPhysicsPose() const { return m_previousPhysicsPose; }
+        inline Transform const& GetCurrentPhysicsPose() const { return m_currentPhysicsPose; }
+
     protected:
 
         // Check if the physics setup if valid for this component, will log any problems detected!
@@ -122,6 +130,9 @@ namespace EE::Physics
 
         physx::PxRigidActor*                            m_pPhysicsActor = nullptr;
         physx::PxShape*                                 m_pPhysicsShape = nullptr;
+        Transform                                       m_previousPhysicsPose;
+        Transform                                       m_currentPhysicsPose;
+        bool                                            m_hasPhysicsPose = false;
 
         #if EE_DEVELOPMENT_TOOLS
         String                                          m_debugName; // Keep a debug name here since the physx SDK doesnt store the name data
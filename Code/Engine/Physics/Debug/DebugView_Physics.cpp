@@ -6,6 +6,7 @@
 #include "Engine/Physics/Components/Component_PhysicsBox.h"
 #include "Engine/Entity/EntityWorld.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/Imgui/ImguiX.h"
 
 #include <PxVisualizationParameter.h>
@@ -129,6 +130,7 @@ namespace EE::Physics
         stateUpdated |= ImGui::SliderFloat( "Visualization Distance", &drawDistance, 1.0f, 100.0f );
 
         DrawPVDMenu( context );
+        DrawSimulationMenu( context );
 
         ImGui::Separator();
 
@@ -229,6 +231,65 @@ namespace EE::Physics
         }
     }
 
+    void PhysicsDebugView::DrawSimulationMenu( EntityWorldUpdateContext const& context )
+    {
+        if ( ImGui::BeginMenu( "Simulation" ) )
+        {
+            int32_t stepRate = (int32_t) Math::Round( 1.0f / m_pPhysicsWorldSystem->GetFixedTimeStep() );
+            if ( ImGui::SliderInt( "Step Rate (Hz)", &stepRate, 10, 240 ) )
+            {
+                m_pPhysicsWorldSystem->SetFixedTimeStep( 1.0f / stepRate );
+            }
+
+            int32_t maxSubsteps = m_pPhysicsWorldSystem->GetMaxSubsteps();
+            if ( ImGui::SliderInt( "Max Substeps", &maxSubsteps, 1, 16 ) )
+            {
+                m_pPhysicsWorldSystem->SetMaxSubsteps( maxSubsteps );
+            }
+
+            bool isPoseInterpolationEnabled = m_pPhysicsWorldSystem->IsPoseInterpolationEnabled();
+            if ( ImGui::Checkbox( "Interpolate Dynamic Poses", &isPoseInterpolationEnabled ) )
+            {
+                m_pPhysicsWorldSystem->SetPoseInterpolationEnabled( isPoseInterpolationEnabled );
+            }
+
+            ImGui::Text( "Steps This Frame: %d", m_pPhysicsWorldSystem->GetNumStepsThisFrame() );
+            ImGui::Text( "Interpolation Alpha: %.2f", m_pPhysicsWorldSystem->GetInterpolationAlpha() );
+
+            //-------------------------------------------------------------------------
+
+            ImGui::Separator();
+
+            if ( ImGui::Button( "Run Simulation Benchmark", ImVec2( -1, 0 ) ) )
+            {
+                BenchmarkSettings settings;
+                settings.m_timeStep = m_pPhysicsWorldSystem->GetFixedTimeStep();
+                m_lastBenchmarkResults = RunSimulationBenchmark( *m_pPhysicsSystem, settings );
+            }
+
+            if ( m_lastBenchmarkResults.IsValid() )
+            {
+                ImGui::Text( "Bodies: %d, Steps: %d", m_lastBenchmarkResults.m_numBodies, m_lastBenchmarkResults.m_numSteps );
+                ImGui::Text( "Avg Step: %.3fms", m_lastBenchmarkResults.m_averageStepTime.ToFloat() );
+                ImGui::Text( "Min Step: %.3fms, Max Step: %.3fms", m_lastBenchmarkResults.m_minStepTime.ToFloat(), m_lastBenchmarkResults.m_maxStepTime.ToFloat() );
+            }
+
+            if ( ImGui::Button( "Run Query Benchmark", ImVec2( -1, 0 ) ) )
+            {
+                m_lastQueryBenchmarkResults = RunQueryBenchmark( *m_pPhysicsSystem, context.GetSystem<TaskSystem>() );
+            }
+
+            if ( m_lastQueryBenchmarkResults.IsValid() )
+            {
+                ImGui::Text( "Queries: %d, Bodies: %d", m_lastQueryBenchmarkResults.m_numQueries, m_lastQueryBenchmarkResults.m_numBodies );
+                ImGui::Text( "Per-Call: %.3fms, Batched: %.3fms", m_lastQueryBenchmarkResults.m_averagePerCallTime.ToFloat(), m_lastQueryBenchmarkResults.m_averageBatchedTime.ToFloat() );
+                ImGui::Text( "Speedup: %.2fx", m_lastQueryBenchmarkResults.GetSpeedup() );
+            }
+
+            ImGui::EndMenu();
+        }
+    }
+
     void PhysicsDebugView::DrawComponentsWindow( EntityWorldUpdateContext const& context )
     {
         TInlineString<50> componentID;
@@ -2,6 +2,7 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "Engine/Physics/PhysicsBenchmark.h"
 
 //-------------------------------------------------------------------------
 
@@ -39,6 +40,7 @@ namespace EE::Physics
 
         void DrawPhysicsMenu( EntityWorldUpdateContext const& context );
         void DrawPVDMenu( EntityWorldUpdateContext const& context );
+        void DrawSimulationMenu( EntityWorldUpdateContext const& context );
         void DrawComponentsWindow( EntityWorldUpdateContext const& context );
         void DrawMaterialDatabaseWindow( EntityWorldUpdateContext const& context );
 
@@ -52,6 +54,8 @@ namespace EE::Physics
         float                   m_recordingTimeSeconds = 0.5f;
         bool                    m_isComponentWindowOpen = false;
         bool                    m_isMaterialDatabaseWindowOpen = false;
+        BenchmarkResults        m_lastBenchmarkResults;
+        QueryBenchmarkResults   m_lastQueryBenchmarkResults;
     };
 }
 #endif
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "System/Math/Plane.h"
 #include "System/Math/BoundingVolumes.h"
 #include "System/Types/Color.h"
+#include "System/Types/Arrays.h"
 #include "System/Log.h"
 
 #include <PxPhysicsAPI.h>
@@ -201,8 +202,22 @@ namespace EE::Physics
 
     class PhysXTaskDispatcher final : public physx::PxCpuDispatcher
     {
+    public:
+
+        // While a task queue is set for a thread, any tasks submitted from that thread are added to the queue instead of being run immediately
+        // This allows a simulation step to be started on one thread and its work to be run later on another
+        static void SetThreadTaskQueue( TVector<physx::PxBaseTask*>* pTaskQueue ) { s_pThreadTaskQueue = pTaskQueue; }
+
+    private:
+
         virtual void submitTask( physx::PxBaseTask& task ) override
         {
+            if ( s_pThreadTaskQueue != nullptr )
+            {
+                s_pThreadTaskQueue->emplace_back( &task );
+                return;
+            }
+
             // Surprisingly it is faster to run all physics tasks on a single thread since there is a fair amount of gaps when spreading the tasks across multiple cores.
             // TODO: re-evaluate this when we have additional work. Perhaps we can interleave other tasks while physics tasks are waiting
             auto pTask = &task;
@@ -214,5 +229,9 @@ namespace EE::Physics
         {
             return 1;
         }
+
+    private:
+
+        inline static thread_local TVector<physx::PxBaseTask*>*    s_pThreadTaskQueue = nullptr;
     };
 }
\ No newline at end of file
@@ -0,0 +1,250 @@
+#include "PhysicsBatchQuery.h"
+#include "PhysicsScene.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Profiling.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    void BatchQuery::Reset()
+    {
+        m_rayCastRequests.clear();
+        m_sweepRequests.clear();
+        m_overlapRequests.clear();
+
+        m_rayCastResults.clear();
+        m_sweepResults.clear();
+        m_overlapResults.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t BatchQuery::AddRayCast( Vector const& start, Vector const& end, QueryFilter const& filter )
+    {
+        EE_ASSERT( !( end - start ).IsNearZero3() );
+
+        auto& request = m_rayCastRequests.emplace_back();
+        request.m_start = start;
+        request.m_end = end;
+        request.m_filter = filter;
+        return (int32_t) m_rayCastRequests.size() - 1;
+    }
+
+    int32_t BatchQuery::AddSphereSweep( float radius, Vector const& start, Vector const& end, QueryFilter const& filter )
+    {
+        EE_ASSERT( radius > 0.0f );
+        EE_ASSERT( !( end - start ).IsNearZero3() );
+
+        auto& request = m_sweepRequests.emplace_back();
+        request.m_shapeType = ShapeType::Sphere;
+        request.m_dimensions = Vector( radius );
+        request.m_start = start;
+        request.m_end = end;
+        request.m_filter = filter;
+        return (int32_t) m_sweepRequests.size() - 1;
+    }
+
+    int32_t BatchQuery::AddCapsuleSweep( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& start, Vector const& end, QueryFilter const& filter )
+    {
+        EE_ASSERT( cylinderPortionHalfHeight > 0.0f && radius > 0.0f );
+        EE_ASSERT( !( end - start ).IsNearZero3() );
+
+        auto& request = m_sweepRequests.emplace_back();
+        request.m_shapeType = ShapeType::Capsule;
+        request.m_dimensions = Vector( cylinderPortionHalfHeight, radius, 0.0f );
+        request.m_orientation = orientation;
+        request.m_start = start;
+        request.m_end = end;
+        request.m_filter = filter;
+        return (int32_t) m_sweepRequests.size() - 1;
+    }
+
+    int32_t BatchQuery::AddBoxSweep( Vector const& halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryFilter const& filter )
+    {
+        EE_ASSERT( !( end - start ).IsNearZero3() );
+
+        auto& request = m_sweepRequests.emplace_back();
+        request.m_shapeType = ShapeType::Box;
+        request.m_dimensions = halfExtents;
+        request.m_orientation = orientation;
+        request.m_start = start;
+        request.m_end = end;
+        request.m_filter = filter;
+        return (int32_t) m_sweepRequests.size() - 1;
+    }
+
+    int32_t BatchQuery::AddSphereOverlap( float radius, Vector const& position, QueryFilter const& filter )
+    {
+        EE_ASSERT( radius > 0.0f );
+
+        auto& request = m_overlapRequests.emplace_back();
+        request.m_shapeType = ShapeType::Sphere;
+        request.m_dimensions = Vector( radius );
+        request.m_start = position;
+        request.m_filter = filter;
+        return (int32_t) m_overlapRequests.size() - 1;
+    }
+
+    int32_t BatchQuery::AddCapsuleOverlap( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& position, QueryFilter const& filter )
+    {
+        EE_ASSERT( cylinderPortionHalfHeight > 0.0f && radius > 0.0f );
+
+        auto& request = m_overlapRequests.emplace_back();
+        request.m_shapeType = ShapeType::Capsule;
+        request.m_dimensions = Vector( cylinderPortionHalfHeight, radius, 0.0f );
+        request.m_orientation = orientation;
+        request.m_start = position;
+        request.m_filter = filter;
+        return (int32_t) m_overlapRequests.size() - 1;
+    }
+
+    int32_t BatchQuery::AddBoxOverlap( Vector const& halfExtents, Quaternion const& orientation, Vector const& position, QueryFilter const& filter )
+    {
+        auto& request = m_overlapRequests.emplace_back();
+        request.m_shapeType = ShapeType::Box;
+        request.m_dimensions = halfExtents;
+        request.m_orientation = orientation;
+        request.m_start = position;
+        request.m_filter = filter;
+        return (int32_t) m_overlapRequests.size() - 1;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void BatchQuery::Execute( Scene* pScene, TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_SCOPE_PHYSICS( "Batch Query" );
+        EE_ASSERT( pScene != nullptr );
+
+        // Create the results in place - the result buffers are self-referencing so we cant copy them into the arrays
+        //-------------------------------------------------------------------------
+
+        m_rayCastResults.clear();
+        m_sweepResults.clear();
+        m_overlapResults.clear();
+
+        m_rayCastResults.resize( m_rayCastRequests.size() );
+        m_sweepResults.resize( m_sweepRequests.size() );
+        m_overlapResults.resize( m_overlapRequests.size() );
+
+        uint32_t const numQueries = (uint32_t) GetNumQueries();
+        if ( numQueries == 0 )
+        {
+            return;
+        }
+
+        // Small batches are run on the calling thread under a single read lock
+        //-------------------------------------------------------------------------
+
+        if ( pTaskSystem == nullptr || numQueries < 2 * s_minQueriesPerTask )
+        {
+            pScene->AcquireReadLock();
+            ExecuteQueries( pScene, 0, numQueries );
+            pScene->ReleaseReadLock();
+            return;
+        }
+
+        // Split the batch across the workers
+        //-------------------------------------------------------------------------
+        // PhysX tracks read lock ownership per-thread, so each task range needs to hold its own read lock while querying
+        // We intentionally do not hold a lock on the calling thread while waiting, since a pending writer would block the workers from acquiring theirs
+
+        struct BatchQueryTask final : public ITaskSet
+        {
+            BatchQueryTask( BatchQuery* pBatch, Scene* pScene, uint32_t numQueries )
+                : m_pBatch( pBatch )
+                , m_pScene( pScene )
+            {
+                m_SetSize = numQueries;
+                m_MinRange = s_minQueriesPerTask;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_PHYSICS( "Batch Query Range" );
+                m_pScene->AcquireReadLock();
+                m_pBatch->ExecuteQueries( m_pScene, range.start, range.end );
+                m_pScene->ReleaseReadLock();
+            }
+
+        private:
+
+            BatchQuery*     m_pBatch = nullptr;
+            Scene*          m_pScene = nullptr;
+        };
+
+        BatchQueryTask task( this, pScene, numQueries );
+        pTaskSystem->ScheduleTask( &task );
+        pTaskSystem->WaitForTask( &task );
+    }
+
+    void BatchQuery::ExecuteQueries( Scene* pScene, uint32_t startIdx, uint32_t endIdx )
+    {
+        uint32_t const numRayCasts = (uint32_t) m_rayCastRequests.size();
+        uint32_t const numSweeps = (uint32_t) m_sweepRequests.size();
+        EE_ASSERT( startIdx <= endIdx && endIdx <= (uint32_t) GetNumQueries() );
+
+        for ( uint32_t i = startIdx; i < endIdx; i++ )
+        {
+            // Ray Casts
+            //-------------------------------------------------------------------------
+
+            if ( i < numRayCasts )
+            {
+                RayCastRequest& request = m_rayCastRequests[i];
+                pScene->RayCast( request.m_start, request.m_end, request.m_filter, m_rayCastResults[i] );
+                continue;
+            }
+
+            // Sweeps
+            //-------------------------------------------------------------------------
+
+            if ( i < numRayCasts + numSweeps )
+            {
+                uint32_t const sweepIdx = i - numRayCasts;
+                ShapeRequest& request = m_sweepRequests[sweepIdx];
+                SweepResult& result = m_sweepResults[sweepIdx];
+
+                switch ( request.m_shapeType )
+                {
+                    case ShapeType::Sphere:
+                    pScene->SphereSweep( request.m_dimensions.GetX(), request.m_start, request.m_end, request.m_filter, result );
+                    break;
+
+                    case ShapeType::Capsule:
+                    pScene->CapsuleSweep( request.m_dimensions.GetX(), request.m_dimensions.GetY(), request.m_orientation, request.m_start, request.m_end, request.m_filter, result );
+                    break;
+
+                    case ShapeType::Box:
+                    pScene->BoxSweep( request.m_dimensions, request.m_orientation, request.m_start, request.m_end, request.m_filter, result );
+                    break;
+                }
+
+                continue;
+            }
+
+            // Overlaps
+            //-------------------------------------------------------------------------
+
+            uint32_t const overlapIdx = i - numRayCasts - numSweeps;
+            ShapeRequest& request = m_overlapRequests[overlapIdx];
+            OverlapResult& result = m_overlapResults[overlapIdx];
+
+            switch ( request.m_shapeType )
+            {
+                case ShapeType::Sphere:
+                pScene->SphereOverlap( request.m_dimensions.GetX(), request.m_start, request.m_filter, result );
+                break;
+
+                case ShapeType::Capsule:
+                pScene->CapsuleOverlap( request.m_dimensions.GetX(), request.m_dimensions.GetY(), request.m_orientation, request.m_start, request.m_filter, result );
+                break;
+
+                case ShapeType::Box:
+                pScene->BoxOverlap( request.m_dimensions, request.m_orientation, request.m_start, request.m_filter, result );
+                break;
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Physics/PhysicsQuery.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+// Batched Scene Queries
+//-------------------------------------------------------------------------
+// Allows a system to submit a large number of ray casts, sweeps and overlaps and execute them all in one go
+// The queries are spread across the task system workers and the results are written into contiguous arrays (one per query type)
+// Each query owns a copy of its filter, so the same filter can safely be reused for multiple queries
+//
+// Usage: add all the queries, call execute and then read back the results using the index returned when adding the query
+// Results are only valid until the next call to Reset() or Execute()
+//
+// WARNING!!! Execute acquires the scene read locks itself, do not call it while holding a lock on the scene!
+
+namespace EE::Physics
+{
+    class Scene;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API BatchQuery final
+    {
+        constexpr static int32_t const s_maxHitsPerQuery = 8;
+
+    public:
+
+        // The minimum number of queries each worker will execute, below this it is cheaper to run the queries on the calling thread
+        constexpr static uint32_t const s_minQueriesPerTask = 16;
+
+        using RayCastResult = RayCastResultBuffer<s_maxHitsPerQuery>;
+        using SweepResult = SweepResultBuffer<s_maxHitsPerQuery>;
+        using OverlapResult = OverlapResultBuffer<s_maxHitsPerQuery>;
+
+        enum class ShapeType : uint8_t
+        {
+            Sphere,
+            Capsule,
+            Box
+        };
+
+        struct RayCastRequest
+        {
+            Vector                  m_start;
+            Vector                  m_end;
+            QueryFilter             m_filter;
+        };
+
+        struct ShapeRequest
+        {
+            Quaternion              m_orientation = Quaternion::Identity;
+            Vector                  m_start;
+            Vector                  m_end;                          // Unused for overlaps
+            Vector                  m_dimensions;                   // Sphere: (radius), Capsule: (cylinder portion half-height, radius), Box: half-extents
+            QueryFilter             m_filter;
+            ShapeType               m_shapeType = ShapeType::Sphere;
+        };
+
+    public:
+
+        BatchQuery() = default;
+        BatchQuery( BatchQuery const& ) = delete;
+        BatchQuery& operator=( BatchQuery const& ) = delete;
+
+        // Clear all requests and results, this will not free any memory so the batch can be reused every frame
+        void Reset();
+
+        inline int32_t GetNumQueries() const { return (int32_t) ( m_rayCastRequests.size() + m_sweepRequests.size() + m_overlapRequests.size() ); }
+
+        // Requests
+        //-------------------------------------------------------------------------
+        // All functions return the index of the result in the relevant result array
+        // NOTE!!! Make sure to always use the Physics world transform for the shape and not the component transforms directly!!!!
+
+        int32_t AddRayCast( Vector const& start, Vector const& end, QueryFilter const& filter );
+
+        int32_t AddSphereSweep( float radius, Vector const& start, Vector const& end, QueryFilter const& filter );
+        int32_t AddCapsuleSweep( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& start, Vector const& end, QueryFilter const& filter );
+        int32_t AddBoxSweep( Vector const& halfExtents, Quaternion const& orientation, Vector const& start, Vector const& end, QueryFilter const& filter );
+
+        int32_t AddSphereOverlap( float radius, Vector const& position, QueryFilter const& filter );
+        int32_t AddCapsuleOverlap( float cylinderPortionHalfHeight, float radius, Quaternion const& orientation, Vector const& position, QueryFilter const& filter );
+        int32_t AddBoxOverlap( Vector const& halfExtents, Quaternion const& orientation, Vector const& position, QueryFilter const& filter );
+
+        // Execution
+        //-------------------------------------------------------------------------
+
+        // Execute all queries, this will block until all results are available
+        // If no task system is provided (or the batch is too small to be worth splitting) all queries are run on the calling thread
+        void Execute( Scene* pScene, TaskSystem* pTaskSystem = nullptr );
+
+        // Results
+        //-------------------------------------------------------------------------
+
+        inline TVector<RayCastResult> const& GetRayCastResults() const { return m_rayCastResults; }
+        inline TVector<SweepResult> const& GetSweepResults() const { return m_sweepResults; }
+        inline TVector<OverlapResult> const& GetOverlapResults() const { return m_overlapResults; }
+
+        inline RayCastResult const& GetRayCastResult( int32_t idx ) const { EE_ASSERT( idx >= 0 && idx < m_rayCastResults.size() ); return m_rayCastResults[idx]; }
+        inline SweepResult const& GetSweepResult( int32_t idx ) const { EE_ASSERT( idx >= 0 && idx < m_sweepResults.size() ); return m_sweepResults[idx]; }
+        inline OverlapResult const& GetOverlapResult( int32_t idx ) const { EE_ASSERT( idx >= 0 && idx < m_overlapResults.size() ); return m_overlapResults[idx]; }
+
+    private:
+
+        // Run all queries in the range [startIdx, endIdx), indices are into the combined (ray casts, sweeps, overlaps) query range
+        void ExecuteQueries( Scene* pScene, uint32_t startIdx, uint32_t endIdx );
+
+    private:
+
+        TVector<RayCastRequest>     m_rayCastRequests;
+        TVector<ShapeRequest>       m_sweepRequests;
+        TVector<ShapeRequest>       m_overlapRequests;
+
+        // The result buffers point to their own internal hit storage, so these arrays must never be copied or grow once filled
+        TVector<RayCastResult>      m_rayCastResults;
+        TVector<SweepResult>        m_sweepResults;
+        TVector<OverlapResult>      m_overlapResults;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "PhysicsBenchmark.h"
+#include "PhysicsSystem.h"
+#include "PhysicsScene.h"
+#include "PhysicsBatchQuery.h"
+#include "PhysX.h"
+#include "System/Math/MathRandom.h"
+#include "System/Time/Timers.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+
+using namespace physx;
+
+//-------------------------------------------------------------------------
+
+namespace EE::Physics
+{
+    static constexpr float const g_benchmarkBoxHalfExtent = 0.5f;
+
+    // The scene shared by all benchmarks: a ground plane and box stacks
+    // Each stack is slightly offset so that they topple into their neighbours
+    // The actors are owned by the PhysX SDK (not the scene) so we need to keep track of them and release them ourselves
+    class BenchmarkScene
+    {
+    public:
+
+        BenchmarkScene( PhysicsSystem& physicsSystem, int32_t numStacks, int32_t stackHeight )
+        {
+            PxPhysics* pPhysics = physicsSystem.GetPxPhysics();
+            PxMaterial* pMaterial = physicsSystem.GetDefaultMaterial();
+            EE_ASSERT( pPhysics != nullptr && pMaterial != nullptr );
+
+            m_pScene = physicsSystem.CreateScene();
+            PxScene* pPxScene = m_pScene->GetPxScene();
+
+            float const stackSpacing = g_benchmarkBoxHalfExtent * 3.0f;
+            int32_t const numStacksPerRow = Math::Max( 1, (int32_t) Math::Sqrt( (float) numStacks ) );
+            m_sceneSize = numStacksPerRow * stackSpacing;
+
+            m_pScene->AcquireWriteLock();
+            {
+                PxRigidStatic* pGroundPlane = PxCreatePlane( *pPhysics, PxPlane( 0, 0, 1, 0 ), *pMaterial );
+                pPxScene->addActor( *pGroundPlane );
+                m_actors.emplace_back( pGroundPlane );
+
+                PxBoxGeometry const boxGeometry( g_benchmarkBoxHalfExtent, g_benchmarkBoxHalfExtent, g_benchmarkBoxHalfExtent );
+                for ( int32_t stackIdx = 0; stackIdx < numStacks; stackIdx++ )
+                {
+                    float const stackX = ( stackIdx % numStacksPerRow ) * stackSpacing;
+                    float const stackY = ( stackIdx / numStacksPerRow ) * stackSpacing;
+
+                    for ( int32_t boxIdx = 0; boxIdx < stackHeight; boxIdx++ )
+                    {
+                        float const offset = ( boxIdx % 2 ) * g_benchmarkBoxHalfExtent * 0.25f;
+                        PxTransform const boxPose( PxVec3( stackX + offset, stackY, g_benchmarkBoxHalfExtent + boxIdx * g_benchmarkBoxHalfExtent * 2.0f ) );
+                        PxRigidDynamic* pBox = PxCreateDynamic( *pPhysics, boxPose, boxGeometry, *pMaterial, 1.0f );
+                        pPxScene->addActor( *pBox );
+                        m_actors.emplace_back( pBox );
+                        m_numBodies++;
+                    }
+                }
+            }
+            m_pScene->ReleaseWriteLock();
+        }
+
+        ~BenchmarkScene()
+        {
+            m_pScene->AcquireWriteLock();
+            for ( auto pActor : m_actors )
+            {
+                pActor->release();
+            }
+            m_pScene->ReleaseWriteLock();
+
+            EE::Delete( m_pScene );
+        }
+
+        inline Scene* GetScene() const { return m_pScene; }
+        inline int32_t GetNumBodies() const { return m_numBodies; }
+        inline float GetSceneSize() const { return m_sceneSize; }
+
+    private:
+
+        Scene*                      m_pScene = nullptr;
+        TVector<PxRigidActor*>      m_actors;
+        int32_t                     m_numBodies = 0;
+        float                       m_sceneSize = 0.0f;
+    };
+
+    //-------------------------------------------------------------------------
+
+    BenchmarkResults RunSimulationBenchmark( PhysicsSystem& physicsSystem, BenchmarkSettings const& settings )
+    {
+        EE_ASSERT( settings.m_numStacks > 0 && settings.m_stackHeight > 0 && settings.m_numSteps > 0 && settings.m_timeStep > 0.0f );
+
+        BenchmarkScene const benchmarkScene( physicsSystem, settings.m_numStacks, settings.m_stackHeight );
+        Scene* pScene = benchmarkScene.GetScene();
+
+        BenchmarkResults results;
+        results.m_numBodies = benchmarkScene.GetNumBodies();
+
+        // Simulate
+        //-------------------------------------------------------------------------
+
+        results.m_numSteps = settings.m_numSteps;
+        results.m_minStepTime = FLT_MAX;
+
+        pScene->AcquireWriteLock();
+        for ( int32_t i = 0; i < settings.m_numSteps; i++ )
+        {
+            Milliseconds stepTime = 0.0f;
+            {
+                ScopedTimer<PlatformClock> timer( stepTime );
+                pScene->BeginSimulation( settings.m_timeStep );
+                pScene->EndSimulation();
+            }
+
+            results.m_totalTime += stepTime;
+            results.m_minStepTime = Math::Min( results.m_minStepTime.ToFloat(), stepTime.ToFloat() );
+            results.m_maxStepTime = Math::Max( results.m_maxStepTime.ToFloat(), stepTime.ToFloat() );
+        }
+        pScene->ReleaseWriteLock();
+
+        results.m_averageStepTime = results.m_totalTime.ToFloat() / settings.m_numSteps;
+
+        //-------------------------------------------------------------------------
+
+        EE_LOG_MESSAGE( "Physics", "Benchmark", "Simulated %d bodies for %d steps (%.2fms step): Total: %.3fms, Avg: %.3fms, Min: %.3fms, Max: %.3fms", results.m_numBodies, results.m_numSteps, settings.m_timeStep.ToMilliseconds().ToFloat(), results.m_totalTime.ToFloat(), results.m_averageStepTime.ToFloat(), results.m_minStepTime.ToFloat(), results.m_maxStepTime.ToFloat() );
+
+        return results;
+    }
+
+    //-------------------------------------------------------------------------
+
+    QueryBenchmarkResults RunQueryBenchmark( PhysicsSystem& physicsSystem, TaskSystem* pTaskSystem, QueryBenchmarkSettings const& settings )
+    {
+        EE_ASSERT( settings.m_numStacks > 0 && settings.m_stackHeight > 0 && settings.m_numQueriesPerType > 0 && settings.m_numIterations > 0 );
+
+        BenchmarkScene const benchmarkScene( physicsSystem, settings.m_numStacks, settings.m_stackHeight );
+        Scene* pScene = benchmarkScene.GetScene();
+        float const sceneSize = benchmarkScene.GetSceneSize();
+
+        QueryBenchmarkResults results;
+        results.m_numBodies = benchmarkScene.GetNumBodies();
+
+        // Generate queries
+        //-------------------------------------------------------------------------
+        // Each query position generates a downwards ray cast, a horizontal sphere sweep and a box overlap
+        // We use a fixed seed so that results are comparable between runs
+
+        float const sceneHeight = settings.m_stackHeight * g_benchmarkBoxHalfExtent * 2.0f;
+        float const sphereRadius = g_benchmarkBoxHalfExtent * 0.5f;
+        Vector const overlapHalfExtents( g_benchmarkBoxHalfExtent * 0.75f );
+        Vector const rayOffset( 0, 0, sceneHeight + 1.0f, 0 );
+        Vector const sweepOffset( sceneSize, 0, 0, 0 );
+
+        Math::RNG rng( 0 );
+        TVector<Vector> queryPositions;
+        queryPositions.reserve( settings.m_numQueriesPerType );
+        for ( int32_t i = 0; i < settings.m_numQueriesPerType; i++ )
+        {
+            queryPositions.emplace_back( rng.GetFloat( -1.0f, sceneSize ), rng.GetFloat( -1.0f, sceneSize ), rng.GetFloat( 0.1f, sceneHeight ) );
+        }
+
+        QueryFilter filter;
+        results.m_numQueries = settings.m_numQueriesPerType * 3;
+        results.m_numIterations = settings.m_numIterations;
+
+        // Per-call path
+        //-------------------------------------------------------------------------
+        // This mirrors the common usage pattern: acquire the read lock once on the calling thread and run all queries sequentially
+
+        Milliseconds perCallTime = 0.0f;
+        {
+            BatchQuery::RayCastResult rayCastResult;
+            BatchQuery::SweepResult sweepResult;
+            BatchQuery::OverlapResult overlapResult;
+
+            ScopedTimer<PlatformClock> timer( perCallTime );
+            for ( int32_t iteration = 0; iteration < settings.m_numIterations; iteration++ )
+            {
+                pScene->AcquireReadLock();
+                for ( Vector const& position : queryPositions )
+                {
+                    pScene->RayCast( position + rayOffset, position - rayOffset, filter, rayCastResult );
+                    pScene->SphereSweep( sphereRadius, position, position + sweepOffset, filter, sweepResult );
+                    pScene->BoxOverlap( overlapHalfExtents, Quaternion::Identity, position, filter, overlapResult );
+                }
+                pScene->ReleaseReadLock();
+            }
+        }
+
+        // Batched path
+        //-------------------------------------------------------------------------
+        // The batch is rebuilt every iteration, since that cost is part of using the batched API
+
+        Milliseconds batchedTime = 0.0f;
+        {
+            BatchQuery batch;
+
+            ScopedTimer<PlatformClock> timer( batchedTime );
+            for ( int32_t iteration = 0; iteration < settings.m_numIterations; iteration++ )
+            {
+                batch.Reset();
+                for ( Vector const& position : queryPositions )
+                {
+                    batch.AddRayCast( position + rayOffset, position - rayOffset, filter );
+                    batch.AddSphereSweep( sphereRadius, position, position + sweepOffset, filter );
+                    batch.AddBoxOverlap( overlapHalfExtents, Quaternion::Identity, position, filter );
+                }
+                batch.Execute( pScene, pTaskSystem );
+            }
+        }
+
+        results.m_averagePerCallTime = perCallTime.ToFloat() / settings.m_numIterations;
+        results.m_averageBatchedTime = batchedTime.ToFloat() / settings.m_numIterations;
+
+        //-------------------------------------------------------------------------
+
+        EE_LOG_MESSAGE( "Physics", "Benchmark", "Ran %d queries against %d bodies for %d iterations: Per-Call Avg: %.3fms, Batched Avg: %.3fms, Speedup: %.2fx", results.m_numQueries, results.m_numBodies, results.m_numIterations, results.m_averagePerCallTime.ToFloat(), results.m_averageBatchedTime.ToFloat(), results.GetSpeedup() );
+
+        return results;
+    }
+}
+#endif
\ No newline at end of file
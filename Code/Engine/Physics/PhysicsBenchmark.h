@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Physics Benchmarks
+//-------------------------------------------------------------------------
+// Both benchmarks run on a standalone scene (no world, entities or rendering)
+// The scene is a ground plane with a grid of box stacks that collapse onto each other, so it exercises both the broadphase and the solver
+//
+// Simulation: runs a fixed number of simulation steps and reports the cost of each step
+// Queries: runs the same set of ray casts, sweeps and overlaps through the per-call scene API and through a batch query and compares the cost
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE::Physics
+{
+    class PhysicsSystem;
+
+    //-------------------------------------------------------------------------
+
+    struct BenchmarkSettings
+    {
+        int32_t             m_numStacks = 16;
+        int32_t             m_stackHeight = 10;
+        int32_t             m_numSteps = 300;
+        Seconds             m_timeStep = 1.0f / 60.0f;
+    };
+
+    struct BenchmarkResults
+    {
+        inline bool IsValid() const { return m_numSteps > 0; }
+
+    public:
+
+        int32_t             m_numBodies = 0;
+        int32_t             m_numSteps = 0;
+        Milliseconds        m_totalTime = 0.0f;
+        Milliseconds        m_averageStepTime = 0.0f;
+        Milliseconds        m_minStepTime = 0.0f;
+        Milliseconds        m_maxStepTime = 0.0f;
+    };
+
+    // Create a benchmark scene, simulate it and log the results - this will block until all steps have been run
+    EE_ENGINE_API BenchmarkResults RunSimulationBenchmark( PhysicsSystem& physicsSystem, BenchmarkSettings const& settings = BenchmarkSettings() );
+
+    //-------------------------------------------------------------------------
+
+    struct QueryBenchmarkSettings
+    {
+        int32_t             m_numStacks = 16;
+        int32_t             m_stackHeight = 10;
+        int32_t             m_numQueriesPerType = 2048;
+        int32_t             m_numIterations = 10;
+    };
+
+    struct QueryBenchmarkResults
+    {
+        inline bool IsValid() const { return m_numIterations > 0; }
+        inline float GetSpeedup() const { return ( m_averageBatchedTime > 0.0f ) ? m_averagePerCallTime.ToFloat() / m_averageBatchedTime.ToFloat() : 0.0f; }
+
+    public:
+
+        int32_t             m_numBodies = 0;
+        int32_t             m_numQueries = 0;               // The total number of queries run per iteration
+        int32_t             m_numIterations = 0;
+        Milliseconds        m_averagePerCallTime = 0.0f;
+        Milliseconds        m_averageBatchedTime = 0.0f;
+    };
+
+    // Create a benchmark scene, run the same queries through both the per-call and the batched paths and log the results
+    // If no task system is provided, the batched queries will run on the calling thread
+    EE_ENGINE_API QueryBenchmarkResults RunQueryBenchmark( PhysicsSystem& physicsSystem, TaskSystem* pTaskSystem, QueryBenchmarkSettings const& settings = QueryBenchmarkSettings() );
+}
+#endif
\ No newline at end of file
@@ -19,6 +19,7 @@ namespace EE::Physics
 
     Scene::~Scene()
     {
+        EE_ASSERT( !m_isSimulationRunning );
         m_pScene->release();
         m_pScene = nullptr;
     }
@@ -56,4 +57,44 @@ namespace EE::Physics
         m_pScene->unlockWrite();
         EE_DEVELOPMENT_TOOLS_ONLY( m_writeLockAcquired = false );
     }
+
+    //-------------------------------------------------------------------------
+
+    void Scene::BeginSimulation( Seconds timeStep )
+    {
+        EE_DEVELOPMENT_TOOLS_ONLY( EE_ASSERT( m_writeLockAcquired ) );
+        EE_ASSERT( !m_isSimulationRunning && timeStep > 0.0f );
+
+        EE_ASSERT( m_pendingSimulationTasks.empty() );
+
+        // Capture the tasks the step submits, so that its work is only done once RunSimulation is called
+        PhysXTaskDispatcher::SetThreadTaskQueue( &m_pendingSimulationTasks );
+        m_pScene->simulate( timeStep );
+        PhysXTaskDispatcher::SetThreadTaskQueue( nullptr );
+        m_isSimulationRunning = true;
+    }
+
+    void Scene::RunSimulation()
+    {
+        EE_ASSERT( m_isSimulationRunning );
+
+        // Any tasks submitted by these tasks are run immediately by the dispatcher, so the step is complete once this returns
+        for ( auto pTask : m_pendingSimulationTasks )
+        {
+            pTask->run();
+            pTask->release();
+        }
+
+        m_pendingSimulationTasks.clear();
+    }
+
+    void Scene::EndSimulation()
+    {
+        EE_DEVELOPMENT_TOOLS_ONLY( EE_ASSERT( m_writeLockAcquired ) );
+        EE_ASSERT( m_isSimulationRunning );
+
+        RunSimulation();
+        m_pScene->fetchResults( true );
+        m_isSimulationRunning = false;
+    }
 }
\ No newline at end of file
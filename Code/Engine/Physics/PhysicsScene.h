@@ -3,6 +3,7 @@
 #include "Engine/_Module/API.h"
 #include "Engine/Physics/PhysicsQuery.h"
 #include "Engine/Physics/PhysX.h"
+#include "System/Time/Time.h"
 #include <atomic>
 
 //-------------------------------------------------------------------------
@@ -45,6 +46,24 @@ namespace EE::Physics
         void AcquireWriteLock();
         void ReleaseWriteLock();
 
+        // Simulation
+        //-------------------------------------------------------------------------
+        // Starting a step only queues up its work, the work is then done by RunSimulation which can be called from any thread without holding any locks
+        // The write lock only needs to be held while starting the step and fetching the results, not while the work is being done
+        // While a step is running, read locks can be acquired as usual and all queries will see the state of the last completed step
+        // Any writes made while a step is running are buffered by PhysX and only applied once the results have been fetched
+
+        inline bool IsSimulationRunning() const { return m_isSimulationRunning; }
+
+        // Start a simulation step - requires the write lock
+        void BeginSimulation( Seconds timeStep );
+
+        // Do all the work for the running simulation step - no lock required, must not be called concurrently with EndSimulation
+        void RunSimulation();
+
+        // Complete the running simulation step and apply its results, any work not yet done is run first - requires the write lock
+        void EndSimulation();
+
         // Ragdoll Factory
         //-------------------------------------------------------------------------
 
@@ -366,6 +385,8 @@ namespace EE::Physics
     private:
 
         physx::PxScene*                                         m_pScene = nullptr;
+        TVector<physx::PxBaseTask*>                             m_pendingSimulationTasks;
+        std::atomic<bool>                                       m_isSimulationRunning = false;
 
         #if EE_DEVELOPMENT_TOOLS
         std::atomic<int32_t>                                    m_readLockCount = false;        // Assertion helper
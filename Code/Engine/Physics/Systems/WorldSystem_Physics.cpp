@@ -11,6 +11,7 @@
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityLog.h"
 #include "System/Math/BoundingVolumes.h"
+#include "System/Threading/TaskSystem.h"
 #include "System/Profiling.h"
 #include "System/Drawing/DebugDrawing.h"
 
@@ -45,6 +46,31 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
 
+    // Does all the work for the final simulation step of the frame in the background
+    class PhysicsWorldSystem::SimulationTask final : public ITaskSet
+    {
+    public:
+
+        SimulationTask( Scene* pScene )
+            : m_pScene( pScene )
+        {
+            EE_ASSERT( pScene != nullptr );
+            m_SetSize = 1;
+        }
+
+        virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+        {
+            EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
+            m_pScene->RunSimulation();
+        }
+
+    private:
+
+        Scene*      m_pScene = nullptr;
+    };
+
+    //-------------------------------------------------------------------------
+
     PhysicsWorldSystem::PhysicsWorldSystem( PhysicsSystem& physicsSystem )
         : m_pPhysicsSystem( &physicsSystem )
     {}
@@ -63,9 +89,14 @@ namespace EE::Physics
         m_pPhysicsSystem = systemRegistry.GetSystem<PhysicsSystem>();
         EE_ASSERT( m_pPhysicsSystem != nullptr );
 
+        m_pTaskSystem = systemRegistry.GetSystem<TaskSystem>();
+        EE_ASSERT( m_pTaskSystem != nullptr );
+
         m_pScene = m_pPhysicsSystem->CreateScene();
         EE_ASSERT( m_pScene != nullptr );
 
+        m_pSimulationTask = EE::New<SimulationTask>( m_pScene );
+
         #if EE_DEVELOPMENT_TOOLS
         SetDebugFlags( 1 << PxVisualizationParameter::eCOLLISION_SHAPES );
         #endif
@@ -73,8 +104,12 @@ namespace EE::Physics
 
     void PhysicsWorldSystem::ShutdownSystem()
     {
+        CompleteSimulation();
+
         // Destroy scene
+        EE::Delete( m_pSimulationTask );
         EE::Delete( m_pScene );
+        m_pTaskSystem = nullptr;
         m_pPhysicsSystem = nullptr;
 
         PhysicsShapeComponent::OnStaticActorTransformUpdated().Unbind( m_shapeTransformChangedBindingID );
@@ -534,44 +569,110 @@ namespace EE::Physics
 
     //-------------------------------------------------------------------------
     
-    void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    void PhysicsWorldSystem::StartSimulation( EntityWorldUpdateContext const& ctx )
     {
-        PxScene* pPxScene = m_pScene->m_pScene;
+        EE_PROFILE_SCOPE_PHYSICS( "Start Simulation" );
 
-        if ( ctx.GetUpdateStage() == UpdateStage::Physics )
+        // The previous step might not have been completed if the world was paused mid-frame
+        CompleteSimulation();
+
+        m_pScene->AcquireWriteLock();
+
+        // Handle any static component updates this should not happen in the running game
+        for ( auto pShapeComponent : m_staticActorShapeUpdateList )
+        {
+            if ( ctx.IsGameWorld() )
+            {
+                EE_LOG_ENTITY_ERROR( pShapeComponent, "Physics", "Someone moved a static physics actor: %s with entity ID %u. This should not be done!", pShapeComponent->GetNameID().c_str(), pShapeComponent->GetEntityID().m_value );
+            }
+
+            UpdateStaticActorAndShape( pShapeComponent );
+        }
+        m_staticActorShapeUpdateList.clear();
+
+        // Only run whole steps and carry the remaining time over to the next frame
+        m_timeAccumulator += ctx.GetDeltaTime();
+        int32_t const numPendingSteps = Math::FloorToInt( m_timeAccumulator / m_fixedTimeStep );
+        m_timeAccumulator -= m_fixedTimeStep * (float) numPendingSteps;
+        m_numStepsThisFrame = Math::Min( numPendingSteps, m_maxSubsteps );
+
+        // All but the final step need to be run to completion immediately
+        for ( int32_t i = 0; i < m_numStepsThisFrame; i++ )
         {
-            m_pScene->AcquireWriteLock();
+            // Record the poses from before the final step, so that we can interpolate towards the final poses
+            if ( i == m_numStepsThisFrame - 1 )
             {
-                EE_PROFILE_SCOPE_PHYSICS( "Simulate" );
-             
-                // Handle any static component updates this should not happen in the running game
-                for ( auto pShapeComponent : m_staticActorShapeUpdateList )
+                for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
                 {
-                    if ( ctx.IsGameWorld() )
+                    if ( pDynamicPhysicsComponent->m_pPhysicsActor != nullptr && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
                     {
-                        EE_LOG_ENTITY_ERROR( pShapeComponent, "Physics", "Someone moved a static physics actor: %s with entity ID %u. This should not be done!", pShapeComponent->GetNameID().c_str(), pShapeComponent->GetEntityID().m_value );
+                        pDynamicPhysicsComponent->m_previousPhysicsPose = FromPx( pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose() );
+                        pDynamicPhysicsComponent->m_hasPhysicsPose = true;
                     }
-
-                    UpdateStaticActorAndShape( pShapeComponent );
                 }
-                m_staticActorShapeUpdateList.clear();
-
-                // TODO: run at fixed time step
-                pPxScene->simulate( ctx.GetDeltaTime() );
             }
 
-            //-------------------------------------------------------------------------
+            m_pScene->BeginSimulation( m_fixedTimeStep );
 
+            if ( i < m_numStepsThisFrame - 1 )
             {
-                EE_PROFILE_SCOPE_PHYSICS( "Fetch Results" );
-                pPxScene->fetchResults( true );
+                EE_PROFILE_SCOPE_PHYSICS( "Simulate Substep" );
+                m_pScene->EndSimulation();
             }
-            m_pScene->ReleaseWriteLock();
+        }
+
+        m_pScene->ReleaseWriteLock();
+
+        // Run the final step in the background, the write lock is not needed for this
+        if ( m_pScene->IsSimulationRunning() )
+        {
+            m_pTaskSystem->ScheduleTask( m_pSimulationTask );
+        }
+    }
+
+    void PhysicsWorldSystem::CompleteSimulation()
+    {
+        if ( !m_pScene->IsSimulationRunning() )
+        {
+            return;
+        }
+
+        // Multiple post-physics consumers can request the results concurrently, only the first one completes the step
+        Threading::ScopeLock lock( m_completeSimulationMutex );
+        if ( !m_pScene->IsSimulationRunning() )
+        {
+            return;
+        }
+
+        EE_PROFILE_SCOPE_PHYSICS( "Complete Simulation" );
+        m_pTaskSystem->WaitForTask( m_pSimulationTask );
+        m_pScene->AcquireWriteLock();
+        m_pScene->EndSimulation();
+        m_pScene->ReleaseWriteLock();
+    }
+
+    void PhysicsWorldSystem::PostStageUpdate( EntityWorldUpdateContext const& ctx )
+    {
+        // Kick off the simulation once all pre-physics entity and system updates have written their physics inputs (e.g. ragdoll targets)
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
+        {
+            StartSimulation( ctx );
+        }
+    }
+
+    void PhysicsWorldSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        // Nothing to do, the simulation is started once the stage completes
+        if ( ctx.GetUpdateStage() == UpdateStage::PrePhysics )
+        {
+            return;
         }
         else if ( ctx.GetUpdateStage() == UpdateStage::PostPhysics )
         {
             EE_PROFILE_SCOPE_PHYSICS( "Update Dynamic Objects" );
 
+            CompleteSimulation();
+
             #if EE_DEVELOPMENT_TOOLS
             Drawing::DrawContext drawingContext = ctx.GetDrawingContext();
             #endif
@@ -580,13 +681,23 @@ namespace EE::Physics
 
             //-------------------------------------------------------------------------
 
+            float const interpolationAlpha = m_isPoseInterpolationEnabled ? GetInterpolationAlpha() : 1.0f;
+
             for ( auto const& pDynamicPhysicsComponent : m_dynamicShapeComponents )
             {
                 // Transfer physics pose back to component
                 if ( pDynamicPhysicsComponent->m_pPhysicsActor != nullptr && pDynamicPhysicsComponent->m_actorType == ActorType::Dynamic )
                 {
-                    auto physicsPose = pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose();
-                    pDynamicPhysicsComponent->SetWorldTransform( FromPx( physicsPose ) );
+                    pDynamicPhysicsComponent->m_currentPhysicsPose = FromPx( pDynamicPhysicsComponent->m_pPhysicsActor->getGlobalPose() );
+
+                    // Actors that havent been simulated yet have nothing to interpolate from
+                    if ( !pDynamicPhysicsComponent->m_hasPhysicsPose )
+                    {
+                        pDynamicPhysicsComponent->m_previousPhysicsPose = pDynamicPhysicsComponent->m_currentPhysicsPose;
+                        pDynamicPhysicsComponent->m_hasPhysicsPose = true;
+                    }
+
+                    pDynamicPhysicsComponent->SetWorldTransform( Transform::Lerp( pDynamicPhysicsComponent->m_previousPhysicsPose, pDynamicPhysicsComponent->m_currentPhysicsPose, interpolationAlpha ) );
                 }
 
                 // Debug
@@ -3,11 +3,14 @@
 #include "Engine/_Module/API.h"
 
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Physics/Components/Component_PhysicsShape.h"
+#include "Engine/Physics/Components/Component_PhysicsCharacter.h"
 #include "Engine/UpdateContext.h"
 #include "System/Systems.h"
 #include "System/Types/IDVector.h"
 #include "System/Types/ScopedValue.h"
 #include "System/Types/Event.h"
+#include "System/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -24,6 +27,7 @@ namespace physx
 namespace EE
 {
     struct AABB;
+    class TaskSystem;
 }
 
 //-------------------------------------------------------------------------
@@ -41,6 +45,8 @@ namespace EE::Physics
     {
         friend class PhysicsDebugView;
 
+        class SimulationTask;
+
         struct EntityPhysicsRecord
         {
             inline bool IsEmpty() const { return m_components.empty(); }
@@ -50,7 +56,7 @@ namespace EE::Physics
 
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::Physics ), RequiresUpdate( UpdateStage::PostPhysics ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( PhysicsWorldSystem, RequiresUpdate( UpdateStage::PrePhysics ), RequiresUpdate( UpdateStage::PostPhysics ), WritesData<PhysicsShapeComponent, CharacterComponent>() );
 
     public:
 
@@ -62,6 +68,34 @@ namespace EE::Physics
 
         physx::PxScene* GetPxScene();
 
+        // Simulation
+        //-------------------------------------------------------------------------
+        // The scene is always stepped at a fixed rate, any left over frame time is carried over to the next frame
+        // We will run at most "max substeps" steps per frame, any additional time is dropped so that a hitch doesnt cause a spiral of ever longer frames
+        // The final step of each frame is started once the pre-physics stage has completed (i.e. after all ragdoll and kinematic writes) and runs as a background task
+        // This lets the physics stage and any post-physics work that doesnt need the results run while the step is in flight
+        // Anything that needs the results of the step needs to call CompleteSimulation first, the results are always complete once this system's post-physics update has run
+        // Scene queries made while the step is running will see the state of the previous step
+
+        inline Seconds GetFixedTimeStep() const { return m_fixedTimeStep; }
+        inline void SetFixedTimeStep( Seconds timeStep ) { EE_ASSERT( timeStep > 0.0f ); m_fixedTimeStep = timeStep; }
+
+        inline int32_t GetMaxSubsteps() const { return m_maxSubsteps; }
+        inline void SetMaxSubsteps( int32_t maxSubsteps ) { EE_ASSERT( maxSubsteps > 0 ); m_maxSubsteps = maxSubsteps; }
+
+        // How far we currently are into the next simulation step [0, 1]
+        inline float GetInterpolationAlpha() const { return Math::Clamp( m_timeAccumulator / m_fixedTimeStep, 0.0f, 1.0f ); }
+
+        // Should the world transforms of dynamic components be interpolated between the last two simulated poses? If not, they will be set to the latest pose
+        inline bool IsPoseInterpolationEnabled() const { return m_isPoseInterpolationEnabled; }
+        inline void SetPoseInterpolationEnabled( bool isEnabled ) { m_isPoseInterpolationEnabled = isEnabled; }
+
+        // The number of simulation steps that were run this frame
+        inline int32_t GetNumStepsThisFrame() const { return m_numStepsThisFrame; }
+
+        // Wait for the running simulation step (if any) to complete and apply its results - threadsafe
+        void CompleteSimulation();
+
         // Debug
         //-------------------------------------------------------------------------
 
@@ -83,6 +117,8 @@ namespace EE::Physics
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool IsWorldLocal() const override { return true; }
+        virtual void PostStageUpdate( EntityWorldUpdateContext const& ctx ) override final;
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
 
         bool CreateActorAndShape( PhysicsShapeComponent* pComponent ) const;
@@ -96,10 +132,15 @@ namespace EE::Physics
         void UpdateStaticActorAndShape( PhysicsShapeComponent* pComponent ) const;
         void OnStaticShapeTransformUpdated( PhysicsShapeComponent* pComponent );
 
+        void StartSimulation( EntityWorldUpdateContext const& ctx );
+
     private:
 
         PhysicsSystem*                                          m_pPhysicsSystem = nullptr;
+        TaskSystem*                                             m_pTaskSystem = nullptr;
         Scene*                                                  m_pScene = nullptr;
+        SimulationTask*                                         m_pSimulationTask = nullptr;
+        Threading::Mutex                                        m_completeSimulationMutex;
 
         TIDVector<ComponentID, CharacterComponent*>             m_characterComponents;
         TIDVector<ComponentID, PhysicsShapeComponent*>          m_physicsShapeComponents;
@@ -108,6 +149,12 @@ namespace EE::Physics
         EventBindingID                                          m_shapeTransformChangedBindingID;
         TVector<PhysicsShapeComponent*>                         m_staticActorShapeUpdateList;
 
+        Seconds                                                 m_fixedTimeStep = 1.0f / 60.0f;
+        Seconds                                                 m_timeAccumulator = 0.0f;
+        int32_t                                                 m_maxSubsteps = 4;
+        int32_t                                                 m_numStepsThisFrame = 0;
+        bool                                                    m_isPoseInterpolationEnabled = true;
+
         #if EE_DEVELOPMENT_TOOLS
         bool                                                    m_drawDynamicActorBounds = false;
         bool                                                    m_drawKinematicActorBounds = false;
@@ -5,6 +5,7 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "Engine/Entity/EntitySerialization.h"
 #include "System/TypeSystem/TypeRegistry.h"
 #include "System/Threading/TaskSystem.h"
 
@@ -110,7 +111,15 @@ namespace EE
         //-------------------------------------------------------------------------
 
         // For now we only support a single spawn point
-        pPersistentMap->AddEntityCollection( pTaskSystem, *pTypeRegistry, *m_spawnPoints[0]->GetEntityCollectionDesc(), m_spawnPoints[0]->GetWorldTransform() );
+        TVector<Entity*> const createdEntities = EntityModel::Serializer::CreateEntities( pTaskSystem, *pTypeRegistry, *m_spawnPoints[0]->GetEntityCollectionDesc() );
+
+        // The player's resources (e.g. the animation graph and character mesh) are gameplay critical, so they are always loaded first
+        for ( auto pEntity : createdEntities )
+        {
+            pEntity->SetResourcePriorityOverride( Resource::ResourcePriority::Critical );
+        }
+
+        pPersistentMap->AddEntities( createdEntities, m_spawnPoints[0]->GetWorldTransform() );
         return true;
     }
 
@@ -2,6 +2,8 @@
 
 #include "Engine/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Player/Components/Component_Player.h"
+#include "Engine/Player/Components/Component_PlayerSpawn.h"
 
 //-------------------------------------------------------------------------
 
@@ -34,7 +36,7 @@ namespace EE
 
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( PlayerManager, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Highest ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( PlayerManager, RequiresUpdate( UpdateStage::FrameStart, UpdatePriority::Highest ), ReadsData<Player::PlayerSpawnComponent>(), WritesData<Player::PlayerComponent>() );
 
         // Player
         //-------------------------------------------------------------------------
@@ -50,6 +52,7 @@ namespace EE
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool IsWorldLocal() const override { return true; }
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
         bool TrySpawnPlayer( EntityWorldUpdateContext const& ctx );
@@ -68,6 +68,8 @@ namespace EE::Render
         m_boneTransforms.clear();
         m_skinningTransforms.clear();
         m_animToMeshBoneMap.clear();
+        m_skinningSourceBoneIndices.clear();
+        m_numActiveAnimBones = InvalidIndex;
         MeshComponent::Shutdown();
     }
 
@@ -134,6 +136,12 @@ namespace EE::Render
         EE_ASSERT( !m_animToMeshBoneMap.empty() );
         EE_ASSERT( pPose != nullptr && pPose->HasGlobalTransforms() );
 
+        if ( pPose->GetNumActiveBones() != m_numActiveAnimBones )
+        {
+            GenerateSkinningLODBoneMap( pPose->GetNumActiveBones() );
+        }
+
+        // Note: bones outside of the active LOD are held at their reference pose relative to their closest active ancestor, so their global transforms are valid in the pose
         int32_t const numAnimBones = pPose->GetNumBones();
         for ( auto animBoneIdx = 0; animBoneIdx < numAnimBones; animBoneIdx++ )
         {
@@ -182,10 +190,38 @@ namespace EE::Render
         EE_ASSERT( m_skinningTransforms.size() == numBones );
 
         auto const& inverseBindPose = m_mesh->GetInverseBindPose();
-        for ( auto i = 0; i < numBones; i++ )
+
+        // No skeleton LOD info, so calculate all the skinning transforms
+        if ( m_skinningSourceBoneIndices.empty() )
+        {
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
+                m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+            }
+        }
+        else
         {
-            Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
-            m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+            EE_ASSERT( m_skinningSourceBoneIndices.size() == numBones );
+
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                if ( m_skinningSourceBoneIndices[i] == i )
+                {
+                    Transform const skinningTransform = inverseBindPose[i] * m_boneTransforms[i];
+                    m_skinningTransforms[i] = ( skinningTransform ).ToMatrix();
+                }
+            }
+
+            // Bones outside of the active skeleton LOD rigidly follow their closest active ancestor, so they share its skinning transform
+            for ( auto i = 0; i < numBones; i++ )
+            {
+                int32_t const sourceBoneIdx = m_skinningSourceBoneIndices[i];
+                if ( sourceBoneIdx != i )
+                {
+                    m_skinningTransforms[i] = m_skinningTransforms[sourceBoneIdx];
+                }
+            }
         }
     }
 
@@ -205,6 +241,45 @@ namespace EE::Render
         }
     }
 
+    void SkeletalMeshComponent::GenerateSkinningLODBoneMap( int32_t numActiveAnimBones )
+    {
+        EE_ASSERT( m_mesh != nullptr && m_skeleton != nullptr );
+        EE_ASSERT( !m_animToMeshBoneMap.empty() );
+
+        // By default, every bone calculates its own skinning transform
+        int32_t const numMeshBones = (int32_t) m_boneTransforms.size();
+        m_skinningSourceBoneIndices.resize( numMeshBones );
+        for ( auto meshBoneIdx = 0; meshBoneIdx < numMeshBones; meshBoneIdx++ )
+        {
+            m_skinningSourceBoneIndices[meshBoneIdx] = meshBoneIdx;
+        }
+
+        // Inactive bones use the skinning transform of the closest active ancestor that exists in the mesh
+        // This assumes that the mesh bind pose matches the skeleton reference pose, which is what the inactive bones are held at
+        int32_t const numAnimBones = m_skeleton->GetNumBones();
+        for ( auto animBoneIdx = numActiveAnimBones; animBoneIdx < numAnimBones; animBoneIdx++ )
+        {
+            int32_t const meshBoneIdx = m_animToMeshBoneMap[animBoneIdx];
+            if ( meshBoneIdx == InvalidIndex )
+            {
+                continue;
+            }
+
+            int32_t ancestorIdx = m_skeleton->GetParentBoneIndex( animBoneIdx );
+            while ( ancestorIdx != InvalidIndex && ( ancestorIdx >= numActiveAnimBones || m_animToMeshBoneMap[ancestorIdx] == InvalidIndex ) )
+            {
+                ancestorIdx = m_skeleton->GetParentBoneIndex( ancestorIdx );
+            }
+
+            if ( ancestorIdx != InvalidIndex )
+            {
+                m_skinningSourceBoneIndices[meshBoneIdx] = m_animToMeshBoneMap[ancestorIdx];
+            }
+        }
+
+        m_numActiveAnimBones = numActiveAnimBones;
+    }
+
     //-------------------------------------------------------------------------
 
     #if EE_DEVELOPMENT_TOOLS
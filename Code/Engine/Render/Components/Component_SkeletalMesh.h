@@ -82,6 +82,7 @@ namespace EE::Render
 
         void UpdateSkinningTransforms();
         void GenerateAnimationBoneMap();
+        void GenerateSkinningLODBoneMap( int32_t numActiveAnimBones );
 
         virtual OBB CalculateLocalBounds() const override final;
 
@@ -98,6 +99,8 @@ namespace EE::Render
         TVector<int32_t>                                m_animToMeshBoneMap;
         TVector<Transform>                              m_boneTransforms;
         TVector<Matrix>                                 m_skinningTransforms;
+        TVector<int32_t>                                m_skinningSourceBoneIndices;    // For each mesh bone, the mesh bone whose skinning transform we use (bones outside of the active skeleton LOD reuse their ancestor's transform)
+        int32_t                                         m_numActiveAnimBones = InvalidIndex;
     };
 
     //-------------------------------------------------------------------------
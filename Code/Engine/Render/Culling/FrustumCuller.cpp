@@ -0,0 +1,99 @@
+#include "FrustumCuller.h"
+#include "System/Math/ViewVolume.h"
+#include "System/Math/SIMD.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    void FrustumCuller::SetViewVolume( Math::ViewVolume const& viewVolume )
+    {
+        for ( auto i = 0u; i < 6; i++ )
+        {
+            Vector const plane = viewVolume.GetViewPlane( i ).ToVector();
+            m_planes[i][0] = plane.GetSplatX();
+            m_planes[i][1] = plane.GetSplatY();
+            m_planes[i][2] = plane.GetSplatZ();
+            m_planes[i][3] = plane.GetSplatW();
+        }
+    }
+
+    uint32_t FrustumCuller::TestBounds( OBB const* const* ppBounds, int32_t numBounds ) const
+    {
+        EE_ASSERT( ppBounds != nullptr && numBounds > 0 && numBounds <= s_batchSize );
+
+        // Transpose the bounds into SoA form: center and the three extent scaled box axes
+        //-------------------------------------------------------------------------
+        // Unused lanes are filled with a degenerate box at the origin, their results are masked out below
+
+        alignas( 16 ) float centers[3][s_batchSize] = {};
+        alignas( 16 ) float axes[3][3][s_batchSize] = {};
+
+        for ( auto i = 0; i < numBounds; i++ )
+        {
+            OBB const& bounds = *ppBounds[i];
+            Vector const axisX = bounds.m_orientation.RotateVector( Vector::UnitX ) * bounds.m_extents.GetSplatX();
+            Vector const axisY = bounds.m_orientation.RotateVector( Vector::UnitY ) * bounds.m_extents.GetSplatY();
+            Vector const axisZ = bounds.m_orientation.RotateVector( Vector::UnitZ ) * bounds.m_extents.GetSplatZ();
+
+            centers[0][i] = bounds.m_center.GetX();
+            centers[1][i] = bounds.m_center.GetY();
+            centers[2][i] = bounds.m_center.GetZ();
+
+            Vector const* pAxes[3] = { &axisX, &axisY, &axisZ };
+            for ( auto axisIdx = 0; axisIdx < 3; axisIdx++ )
+            {
+                axes[axisIdx][0][i] = pAxes[axisIdx]->GetX();
+                axes[axisIdx][1][i] = pAxes[axisIdx]->GetY();
+                axes[axisIdx][2][i] = pAxes[axisIdx]->GetZ();
+            }
+        }
+
+        __m128 const centerX = _mm_load_ps( centers[0] );
+        __m128 const centerY = _mm_load_ps( centers[1] );
+        __m128 const centerZ = _mm_load_ps( centers[2] );
+
+        __m128 axisComponents[3][3];
+        for ( auto axisIdx = 0; axisIdx < 3; axisIdx++ )
+        {
+            axisComponents[axisIdx][0] = _mm_load_ps( axes[axisIdx][0] );
+            axisComponents[axisIdx][1] = _mm_load_ps( axes[axisIdx][1] );
+            axisComponents[axisIdx][2] = _mm_load_ps( axes[axisIdx][2] );
+        }
+
+        // Test all bounds against each plane
+        //-------------------------------------------------------------------------
+        // A box is outside a plane if the signed distance of its center is less than minus its projected radius onto the plane normal
+
+        __m128 const signMask = _mm_castsi128_ps( _mm_set1_epi32( 0x7FFFFFFF ) );
+        __m128 outsideMask = _mm_setzero_ps();
+
+        for ( auto planeIdx = 0; planeIdx < 6; planeIdx++ )
+        {
+            __m128 const a = m_planes[planeIdx][0];
+            __m128 const b = m_planes[planeIdx][1];
+            __m128 const c = m_planes[planeIdx][2];
+            __m128 const d = m_planes[planeIdx][3];
+
+            __m128 distance = _mm_add_ps( _mm_mul_ps( a, centerX ), d );
+            distance = _mm_add_ps( _mm_mul_ps( b, centerY ), distance );
+            distance = _mm_add_ps( _mm_mul_ps( c, centerZ ), distance );
+
+            __m128 radius = _mm_setzero_ps();
+            for ( auto axisIdx = 0; axisIdx < 3; axisIdx++ )
+            {
+                __m128 projectedAxis = _mm_mul_ps( a, axisComponents[axisIdx][0] );
+                projectedAxis = _mm_add_ps( _mm_mul_ps( b, axisComponents[axisIdx][1] ), projectedAxis );
+                projectedAxis = _mm_add_ps( _mm_mul_ps( c, axisComponents[axisIdx][2] ), projectedAxis );
+                radius = _mm_add_ps( radius, _mm_and_ps( projectedAxis, signMask ) );
+            }
+
+            outsideMask = _mm_or_ps( outsideMask, _mm_cmplt_ps( _mm_add_ps( distance, radius ), _mm_setzero_ps() ) );
+        }
+
+        //-------------------------------------------------------------------------
+
+        uint32_t const validMask = ( 1u << numBounds ) - 1;
+        return ~uint32_t( _mm_movemask_ps( outsideMask ) ) & validMask;
+    }
+}
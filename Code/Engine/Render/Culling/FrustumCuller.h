@@ -0,0 +1,84 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Math/BoundingVolumes.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Math { class ViewVolume; }
+
+//-------------------------------------------------------------------------
+// Frustum Culler
+//-------------------------------------------------------------------------
+// Tests oriented bounds against the six view planes, a batch of bounds at a time
+// The plane tests are performed across the bounds in the batch rather than across the plane components
+
+namespace EE::Render
+{
+    class EE_ENGINE_API FrustumCuller
+    {
+    public:
+
+        constexpr static int32_t const s_batchSize = 4;
+
+    public:
+
+        void SetViewVolume( Math::ViewVolume const& viewVolume );
+
+        // Test up to a batch of bounds, returns a mask with a bit set for each bound that is at least partially inside the frustum
+        uint32_t TestBounds( OBB const* const* ppBounds, int32_t numBounds ) const;
+
+        // Test a list of components (i.e. anything with 'IsVisible' and 'GetWorldBounds'), all visible components are appended to the output list
+        // Returns the number of components tested
+        template<typename ListType, typename ComponentType>
+        int32_t Cull( ListType const& components, TVector<ComponentType const*>& outVisibleComponents ) const
+        {
+            OBB const* batchBounds[s_batchSize];
+            ComponentType const* batchComponents[s_batchSize];
+            int32_t numInBatch = 0;
+            int32_t numTested = 0;
+
+            auto ProcessBatch = [&] ()
+            {
+                uint32_t const visibilityMask = TestBounds( batchBounds, numInBatch );
+                for ( auto i = 0; i < numInBatch; i++ )
+                {
+                    if ( visibilityMask & ( 1u << i ) )
+                    {
+                        outVisibleComponents.emplace_back( batchComponents[i] );
+                    }
+                }
+
+                numTested += numInBatch;
+                numInBatch = 0;
+            };
+
+            for ( ComponentType const* pComponent : components )
+            {
+                if ( !pComponent->IsVisible() )
+                {
+                    continue;
+                }
+
+                batchBounds[numInBatch] = &pComponent->GetWorldBounds();
+                batchComponents[numInBatch] = pComponent;
+                if ( ++numInBatch == s_batchSize )
+                {
+                    ProcessBatch();
+                }
+            }
+
+            if ( numInBatch > 0 )
+            {
+                ProcessBatch();
+            }
+
+            return numTested;
+        }
+
+    private:
+
+        Vector                      m_planes[6][4];             // The plane equation components (a, b, c, d) for each view plane, each splatted across all lanes
+    };
+}
@@ -0,0 +1,237 @@
+#include "OcclusionBuffer.h"
+#include "Engine/Render/Mesh/RenderMesh.h"
+#include "System/Math/ViewVolume.h"
+#include "System/Math/SIMD.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Render
+{
+    // Any vertex with a clip space W less than this is treated as crossing the near plane
+    constexpr static float const g_minClipW = 1e-4f;
+
+    // Convert a clip space position to a buffer position: (x, y, depth, w)
+    static EE_FORCE_INLINE Vector ClipToScreen( Vector const& clipPosition )
+    {
+        Float4 const clip = clipPosition.ToFloat4();
+        float const invW = 1.0f / clip.m_w;
+        float const x = ( clip.m_x * invW * 0.5f + 0.5f ) * OcclusionBuffer::s_width;
+        float const y = ( 0.5f - clip.m_y * invW * 0.5f ) * OcclusionBuffer::s_height;
+        return Vector( x, y, clip.m_z * invW, clip.m_w );
+    }
+
+    // Clamp a screen coordinate to just outside the buffer so that the integer conversion cannot overflow
+    static EE_FORCE_INLINE float ClampToBuffer( float value, int32_t dimension )
+    {
+        return Math::Clamp( value, -1.0f, float( dimension + 1 ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    OcclusionBuffer::OcclusionBuffer()
+        : m_viewProjectionMatrix( Matrix::Identity )
+    {
+        m_depth.resize( s_width * s_height, 1.0f );
+    }
+
+    void OcclusionBuffer::Reset( Math::ViewVolume const& viewVolume )
+    {
+        m_viewProjectionMatrix = viewVolume.GetViewProjectionMatrix();
+        eastl::fill( m_depth.begin(), m_depth.end(), 1.0f );
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool OcclusionBuffer::CalculateScreenRect( OBB const& bounds, ScreenRect& outRect ) const
+    {
+        Vector corners[8];
+        bounds.GetCorners( corners );
+
+        float minX = FLT_MAX, minY = FLT_MAX, maxX = -FLT_MAX, maxY = -FLT_MAX;
+        float minDepth = FLT_MAX;
+
+        for ( auto i = 0; i < 8; i++ )
+        {
+            Vector const clipPosition = m_viewProjectionMatrix.TransformVector3( corners[i] );
+            if ( clipPosition.GetW() < g_minClipW )
+            {
+                return false;
+            }
+
+            Float4 const screenPosition = ClipToScreen( clipPosition ).ToFloat4();
+            minX = Math::Min( minX, screenPosition.m_x );
+            minY = Math::Min( minY, screenPosition.m_y );
+            maxX = Math::Max( maxX, screenPosition.m_x );
+            maxY = Math::Max( maxY, screenPosition.m_y );
+            minDepth = Math::Min( minDepth, screenPosition.m_z );
+        }
+
+        // Expand the rect to all touched pixels
+        outRect.m_minX = Math::Max( 0, Math::FloorToInt( ClampToBuffer( minX, s_width ) ) );
+        outRect.m_minY = Math::Max( 0, Math::FloorToInt( ClampToBuffer( minY, s_height ) ) );
+        outRect.m_maxX = Math::Min( s_width - 1, Math::CeilingToInt( ClampToBuffer( maxX, s_width ) ) );
+        outRect.m_maxY = Math::Min( s_height - 1, Math::CeilingToInt( ClampToBuffer( maxY, s_height ) ) );
+        outRect.m_minDepth = minDepth;
+
+        return outRect.m_minX <= outRect.m_maxX && outRect.m_minY <= outRect.m_maxY;
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t OcclusionBuffer::RasterizeMesh( Mesh const* pMesh, Matrix const& worldTransform )
+    {
+        EE_ASSERT( pMesh != nullptr );
+
+        Matrix const worldViewProjectionMatrix = worldTransform * m_viewProjectionMatrix;
+
+        // Transform all vertices
+        //-------------------------------------------------------------------------
+        // Positions are the first element of all mesh vertex formats
+
+        Blob const& vertexData = pMesh->GetVertexData();
+        uint32_t const vertexStride = pMesh->GetVertexBuffer().m_byteStride;
+        int32_t const numVertices = pMesh->GetNumVertices();
+
+        m_transformedVertices.resize( numVertices );
+        for ( auto i = 0; i < numVertices; i++ )
+        {
+            Float4 const* pPosition = reinterpret_cast<Float4 const*>( vertexData.data() + ( i * vertexStride ) );
+            Vector const clipPosition = worldViewProjectionMatrix.TransformVector3( Vector( *pPosition ) );
+            m_transformedVertices[i] = ( clipPosition.GetW() < g_minClipW ) ? Vector( 0, 0, 0, -1.0f ) : ClipToScreen( clipPosition );
+        }
+
+        // Rasterize triangles
+        //-------------------------------------------------------------------------
+        // Triangles crossing the near plane are skipped, this only ever reduces the occlusion
+
+        int32_t numRasterizedTriangles = 0;
+        auto const& indices = pMesh->GetIndices();
+        for ( size_t i = 0; i + 2 < indices.size(); i += 3 )
+        {
+            Vector const& v0 = m_transformedVertices[indices[i]];
+            Vector const& v1 = m_transformedVertices[indices[i + 1]];
+            Vector const& v2 = m_transformedVertices[indices[i + 2]];
+
+            if ( v0.GetW() < 0.0f || v1.GetW() < 0.0f || v2.GetW() < 0.0f )
+            {
+                continue;
+            }
+
+            RasterizeTriangle( v0, v1, v2 );
+            numRasterizedTriangles++;
+        }
+
+        return numRasterizedTriangles;
+    }
+
+    void OcclusionBuffer::RasterizeTriangle( Vector const& v0, Vector const& v1, Vector const& v2 )
+    {
+        Float4 p0 = v0.ToFloat4();
+        Float4 p1 = v1.ToFloat4();
+        Float4 p2 = v2.ToFloat4();
+
+        // Ensure a consistent winding, both sides of occluders are rasterized
+        float area = ( p1.m_x - p0.m_x ) * ( p2.m_y - p0.m_y ) - ( p1.m_y - p0.m_y ) * ( p2.m_x - p0.m_x );
+        if ( Math::Abs( area ) < Math::Epsilon )
+        {
+            return;
+        }
+
+        if ( area < 0.0f )
+        {
+            eastl::swap( p1, p2 );
+            area = -area;
+        }
+
+        // Clip the triangle bounds to the buffer
+        //-------------------------------------------------------------------------
+
+        int32_t const minX = Math::Max( 0, Math::FloorToInt( ClampToBuffer( Math::Min( p0.m_x, Math::Min( p1.m_x, p2.m_x ) ), s_width ) ) );
+        int32_t const minY = Math::Max( 0, Math::FloorToInt( ClampToBuffer( Math::Min( p0.m_y, Math::Min( p1.m_y, p2.m_y ) ), s_height ) ) );
+        int32_t const maxX = Math::Min( s_width - 1, Math::CeilingToInt( ClampToBuffer( Math::Max( p0.m_x, Math::Max( p1.m_x, p2.m_x ) ), s_width ) ) );
+        int32_t const maxY = Math::Min( s_height - 1, Math::CeilingToInt( ClampToBuffer( Math::Max( p0.m_y, Math::Max( p1.m_y, p2.m_y ) ), s_height ) ) );
+
+        if ( minX > maxX || minY > maxY )
+        {
+            return;
+        }
+
+        // Edge functions, stepped incrementally across the bounds
+        //-------------------------------------------------------------------------
+        // Each edge function is the (scaled) barycentric weight for the vertex opposite that edge
+
+        auto EdgeFunction = [] ( Float4 const& a, Float4 const& b, float x, float y ) { return ( b.m_x - a.m_x ) * ( y - a.m_y ) - ( b.m_y - a.m_y ) * ( x - a.m_x ); };
+
+        float const stepX0 = -( p2.m_y - p1.m_y ), stepY0 = ( p2.m_x - p1.m_x );
+        float const stepX1 = -( p0.m_y - p2.m_y ), stepY1 = ( p0.m_x - p2.m_x );
+        float const stepX2 = -( p1.m_y - p0.m_y ), stepY2 = ( p1.m_x - p0.m_x );
+
+        float const invArea = 1.0f / area;
+        float const startX = minX + 0.5f;
+        float const startY = minY + 0.5f;
+        float rowW0 = EdgeFunction( p1, p2, startX, startY );
+        float rowW1 = EdgeFunction( p2, p0, startX, startY );
+        float rowW2 = EdgeFunction( p0, p1, startX, startY );
+
+        for ( int32_t y = minY; y <= maxY; y++ )
+        {
+            float w0 = rowW0, w1 = rowW1, w2 = rowW2;
+            float* pDepthRow = &m_depth[y * s_width];
+
+            for ( int32_t x = minX; x <= maxX; x++ )
+            {
+                if ( w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f )
+                {
+                    float const depth = ( w0 * p0.m_z + w1 * p1.m_z + w2 * p2.m_z ) * invArea;
+                    if ( depth >= 0.0f )
+                    {
+                        pDepthRow[x] = Math::Min( pDepthRow[x], depth );
+                    }
+                }
+
+                w0 += stepX0; w1 += stepX1; w2 += stepX2;
+            }
+
+            rowW0 += stepY0; rowW1 += stepY1; rowW2 += stepY2;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool OcclusionBuffer::IsOccluded( OBB const& bounds ) const
+    {
+        ScreenRect rect;
+        if ( !CalculateScreenRect( bounds, rect ) )
+        {
+            return false;
+        }
+
+        // The bounds are visible as soon as a single covered pixel is not nearer than the bounds, test 4 pixels at a time
+        __m128 const boundsDepth = _mm_set1_ps( rect.m_minDepth );
+
+        for ( int32_t y = rect.m_minY; y <= rect.m_maxY; y++ )
+        {
+            float const* pDepthRow = &m_depth[y * s_width];
+
+            int32_t x = rect.m_minX;
+            for ( ; x + 3 <= rect.m_maxX; x += 4 )
+            {
+                __m128 const occluderDepth = _mm_loadu_ps( pDepthRow + x );
+                if ( _mm_movemask_ps( _mm_cmpge_ps( occluderDepth, boundsDepth ) ) != 0 )
+                {
+                    return false;
+                }
+            }
+
+            for ( ; x <= rect.m_maxX; x++ )
+            {
+                if ( pDepthRow[x] >= rect.m_minDepth )
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "System/Math/BoundingVolumes.h"
+#include "System/Math/Matrix.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Math { class ViewVolume; }
+namespace EE::Render { class Mesh; }
+
+//-------------------------------------------------------------------------
+// Software Occlusion Buffer
+//-------------------------------------------------------------------------
+// A low resolution CPU depth buffer that large occluders are rasterized into
+// Depth values are the post-projection depth (0 at the near plane, 1 at the far plane) and the nearest depth is kept per pixel
+// Bounds are then tested against the buffer: if every pixel their screen rect covers is nearer than the nearest point on the bounds, the bounds are occluded
+// Note: triangles are sampled at pixel centers, so thin occluders and sub-pixel gaps make the test non-conservative (visible bounds can be reported as occluded)
+
+namespace EE::Render
+{
+    class EE_ENGINE_API OcclusionBuffer
+    {
+    public:
+
+        constexpr static int32_t const s_width = 256;
+        constexpr static int32_t const s_height = 128;
+
+        // The screen space rect that some bounds cover
+        struct ScreenRect
+        {
+            inline int32_t GetArea() const { return ( m_maxX - m_minX + 1 ) * ( m_maxY - m_minY + 1 ); }
+
+        public:
+
+            int32_t                 m_minX = 0;
+            int32_t                 m_minY = 0;
+            int32_t                 m_maxX = 0;
+            int32_t                 m_maxY = 0;
+            float                   m_minDepth = 0.0f;
+        };
+
+    public:
+
+        OcclusionBuffer();
+
+        // Clear the buffer and set the view to rasterize/test with
+        void Reset( Math::ViewVolume const& viewVolume );
+
+        // Calculate the screen rect for the supplied bounds. Returns false if the bounds are off-screen or cross the near plane
+        bool CalculateScreenRect( OBB const& bounds, ScreenRect& outRect ) const;
+
+        // Rasterize all the triangles for a mesh into the buffer, returns the number of triangles rasterized
+        int32_t RasterizeMesh( Mesh const* pMesh, Matrix const& worldTransform );
+
+        // Are the supplied bounds fully hidden by the rasterized occluders
+        bool IsOccluded( OBB const& bounds ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline TVector<float> const& GetDepthBuffer() const { return m_depth; }
+        #endif
+
+    private:
+
+        void RasterizeTriangle( Vector const& v0, Vector const& v1, Vector const& v2 );
+
+    private:
+
+        TVector<float>              m_depth;
+        TVector<Vector>             m_transformedVertices;      // Scratch buffer for screen space vertices (x, y, depth, w)
+        Matrix                      m_viewProjectionMatrix;
+    };
+}
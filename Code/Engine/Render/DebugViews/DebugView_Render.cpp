@@ -65,6 +65,21 @@ namespace EE::Render
         ImGui::Checkbox( "Show Skeletal Mesh Bounds", &m_pWorldRendererSystem->m_showSkeletalMeshBounds );
         ImGui::Checkbox( "Show Skeletal Mesh Bones", &m_pWorldRendererSystem->m_showSkeletalMeshBones );
         ImGui::Checkbox( "Show Skeletal Bind Poses", &m_pWorldRendererSystem->m_showSkeletalMeshBindPoses );
+
+        ImGuiX::TextSeparator( "Culling" );
+
+        ImGui::Checkbox( "Enable Occlusion Culling", &m_pWorldRendererSystem->m_isOcclusionCullingEnabled );
+        ImGui::Checkbox( "Show Occluders", &m_pWorldRendererSystem->m_showOccluders );
+
+        auto const& stats = m_pWorldRendererSystem->m_cullingStats;
+        ImGui::Text( "Static Broadphase Candidates: %d", stats.m_numStaticBroadphaseCandidates );
+        ImGui::Text( "Static Frustum: %d / %d visible", stats.m_numStaticFrustumVisible, stats.m_numStaticFrustumTested );
+        ImGui::Text( "Dynamic Frustum: %d / %d visible", stats.m_numDynamicFrustumVisible, stats.m_numDynamicFrustumTested );
+        ImGui::Text( "Skeletal Frustum: %d / %d visible", stats.m_numSkeletalFrustumVisible, stats.m_numSkeletalFrustumTested );
+        ImGui::Text( "Occluders: %d (%d triangles)", stats.m_numOccluders, stats.m_numOccluderTriangles );
+        ImGui::Text( "Static Occlusion Culled: %d", stats.m_numStaticOcclusionCulled );
+        ImGui::Text( "Skeletal Occlusion Culled: %d", stats.m_numSkeletalOcclusionCulled );
+        ImGui::Text( "Shadow Casters: %d static, %d skeletal", stats.m_numStaticShadowCasters, stats.m_numSkeletalShadowCasters );
     }
 
     void RenderDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
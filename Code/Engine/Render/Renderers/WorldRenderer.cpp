@@ -16,56 +16,6 @@
 
 namespace EE::Render
 {
-    static Matrix ComputeShadowMatrix( Viewport const& viewport, Transform const& lightWorldTransform, float shadowDistance )
-    {
-        Transform lightTransform = lightWorldTransform;
-        lightTransform.SetTranslation( Vector::Zero );
-        Transform const invLightTransform = lightTransform.GetInverse();
-
-        //Get a modified camera view volume that has the shadow distance as the z far.
-        // This will get us the appropriate corners to translate into light space.
-
-        // To make these cascade, you do this in a loop and move the depth range along by your
-        // cascade distance.
-        EE::Math::ViewVolume camVolume = viewport.GetViewVolume();
-        camVolume.SetDepthRange( FloatRange( 1.0f, shadowDistance ) );
-
-        Math::ViewVolume::VolumeCorners corners = camVolume.GetCorners();
-
-        // Translate into light space.
-        for ( int32_t i = 0; i < 8; i++ )
-        {
-            corners.m_points[i] = invLightTransform.TransformPoint( corners.m_points[i] );
-        }
-
-        // Note for understanding, cornersMin and cornersMax are in light space, not world space.
-        Vector cornersMin = Vector::One * FLT_MAX;
-        Vector cornersMax = Vector::One * -FLT_MAX;
-
-        for ( int32_t i = 0; i < 8; i++ )
-        {
-            cornersMin = Vector::Min( cornersMin, corners.m_points[i] );
-            cornersMax = Vector::Max( cornersMax, corners.m_points[i] );
-        }
-
-        Vector lightPosition = Vector::Lerp( cornersMin, cornersMax, 0.5f );
-        lightPosition = Vector::Select( lightPosition, cornersMax, Vector::Select0100 ); //force lightPosition to the "back" of the box.
-        lightPosition = lightTransform.TransformPoint( lightPosition );   //Light position now in world space.
-        lightTransform.SetTranslation( lightPosition );   //Assign to the lightTransform, now it's positioned above our view frustrum.
-
-        Vector delta = cornersMax - cornersMin;
-        float dim = Math::Max( delta.m_x, delta.m_z );
-        Math::ViewVolume lightViewVolume( Float2( dim ), FloatRange( 1.0, delta.m_y ), lightTransform.ToMatrix() );
-
-        Matrix viewProjMatrix = lightViewVolume.GetViewProjectionMatrix();
-        Matrix viewMatrix = lightViewVolume.GetViewMatrix();
-        Matrix projMatrix = lightViewVolume.GetProjectionMatrix();
-        Matrix viewProj = lightViewVolume.GetViewProjectionMatrix(); // TODO: inverse z???
-        return viewProj;
-    }
-
-    //-------------------------------------------------------------------------
-
     bool WorldRenderer::Initialize( RenderDevice* pRenderDevice )
     {
         EE_ASSERT( m_pRenderDevice == nullptr && pRenderDevice != nullptr );
@@ -701,7 +651,7 @@ namespace EE::Render
         renderContext.SetShaderInputBinding( m_inputBindingStatic );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( StaticMeshComponent const* pMeshComponent : data.m_staticMeshComponents )
+        for ( StaticMeshComponent const* pMeshComponent : data.m_shadowStaticMeshComponents )
         {
             auto pMesh = pMeshComponent->GetMesh();
             Matrix worldTransform = pMeshComponent->GetWorldTransform().ToMatrix();
@@ -726,7 +676,7 @@ namespace EE::Render
         renderContext.SetShaderInputBinding( m_inputBindingSkeletal );
         renderContext.SetPrimitiveTopology( Topology::TriangleList );
 
-        for ( SkeletalMeshComponent const* pMeshComponent : data.m_skeletalMeshComponents )
+        for ( SkeletalMeshComponent const* pMeshComponent : data.m_shadowSkeletalMeshComponents )
         {
             auto pMesh = pMeshComponent->GetMesh();
 
@@ -785,6 +735,8 @@ namespace EE::Render
             nullptr,
             pWorldSystem->m_visibleStaticMeshComponents,
             pWorldSystem->m_visibleSkeletalMeshComponents,
+            pWorldSystem->m_sunShadowStaticMeshComponents,
+            pWorldSystem->m_sunShadowSkeletalMeshComponents,
         };
 
         renderData.m_transforms.m_viewprojTransform = viewport.GetViewVolume().GetViewProjectionMatrix();
@@ -798,12 +750,16 @@ namespace EE::Render
         {
             pDirectionalLightComponent = pWorldSystem->m_registeredDirectionLightComponents[0];
             lightingFlags |= LIGHTING_ENABLE_SUN;
-            lightingFlags |= pDirectionalLightComponent->GetShadowed() ? LIGHTING_ENABLE_SUN_SHADOW : 0;
+            lightingFlags |= pWorldSystem->m_hasSunShadows ? LIGHTING_ENABLE_SUN_SHADOW : 0;
             renderData.m_lightData.m_SunDirIndirectIntensity = -pDirectionalLightComponent->GetLightDirection();
             Float4 colorIntensity = pDirectionalLightComponent->GetLightColor();
             renderData.m_lightData.m_SunColorRoughnessOneLevel = colorIntensity * pDirectionalLightComponent->GetLightIntensity();
-            // TODO: conditional
-            renderData.m_lightData.m_sunShadowMapMatrix = ComputeShadowMatrix( viewport, pDirectionalLightComponent->GetWorldTransform(), 50.0f/*TODO: configure*/ );
+
+            // The shadow volume is calculated by the world system, since the shadow casters are culled against it
+            if ( pWorldSystem->m_hasSunShadows )
+            {
+                renderData.m_lightData.m_sunShadowMapMatrix = pWorldSystem->m_sunShadowViewVolume.GetViewProjectionMatrix(); // TODO: inverse z???
+            }
         }
 
         renderData.m_lightData.m_SunColorRoughnessOneLevel.m_w = 0;
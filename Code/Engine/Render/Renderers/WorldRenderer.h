@@ -99,6 +99,8 @@ namespace EE::Render
             CubemapTexture const*                   m_pSkyboxTexture;
             TVector<StaticMeshComponent const*>&    m_staticMeshComponents;
             TVector<SkeletalMeshComponent const*>&  m_skeletalMeshComponents;
+            TVector<StaticMeshComponent const*>&    m_shadowStaticMeshComponents;
+            TVector<SkeletalMeshComponent const*>&  m_shadowSkeletalMeshComponents;
         };
 
     public:
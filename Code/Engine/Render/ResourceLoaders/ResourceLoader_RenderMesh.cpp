@@ -45,6 +45,30 @@ namespace EE::Render
         return true;
     }
 
+    size_t MeshLoader::CalculateMemorySize( ResourceID const& resourceID, Resource::ResourceRecord const* pResourceRecord, size_t rawDataSize ) const
+    {
+        auto pMesh = static_cast<Mesh const*>( pResourceRecord->GetResourceData() );
+
+        // The CPU copy of the geometry is kept after install
+        size_t memorySize = pMesh->m_vertices.size() + pMesh->m_indices.size() * sizeof( uint32_t ) + pMesh->m_sections.size() * sizeof( Mesh::GeometrySection ) + pMesh->m_materials.size() * sizeof( TResourcePtr<Material> );
+
+        if ( resourceID.GetResourceTypeID() == StaticMesh::GetStaticResourceTypeID() )
+        {
+            memorySize += sizeof( StaticMesh );
+        }
+        else // Skeletal Mesh
+        {
+            auto pSkeletalMesh = static_cast<SkeletalMesh const*>( pMesh );
+            memorySize += sizeof( SkeletalMesh );
+            memorySize += pSkeletalMesh->m_boneIDs.size() * sizeof( StringID ) + pSkeletalMesh->m_parentBoneIndices.size() * sizeof( int32_t );
+            memorySize += ( pSkeletalMesh->m_bindPose.size() + pSkeletalMesh->m_inverseBindPose.size() ) * sizeof( Transform );
+        }
+
+        // GPU buffers, the sizes are known ahead of install since they are part of the compiled data
+        memorySize += pMesh->m_vertexBuffer.m_byteSize + pMesh->m_indexBuffer.m_byteSize;
+        return memorySize;
+    }
+
     Resource::InstallResult MeshLoader::Install( ResourceID const& resourceID, Resource::ResourceRecord* pResourceRecord, Resource::InstallDependencyList const& installDependencies ) const
     {
         auto pMesh = pResourceRecord->GetResourceData<Mesh>();
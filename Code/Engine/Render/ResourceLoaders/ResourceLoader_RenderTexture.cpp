@@ -41,6 +41,17 @@ namespace EE::Render
         return true;
     }
 
+    size_t TextureLoader::CalculateMemorySize( ResourceID const& resourceID, Resource::ResourceRecord const* pResourceRecord, size_t rawDataSize ) const
+    {
+        auto pTextureResource = static_cast<Texture const*>( pResourceRecord->GetResourceData() );
+        size_t const objectSize = ( resourceID.GetResourceTypeID() == CubemapTexture::GetStaticResourceTypeID() ) ? sizeof( CubemapTexture ) : sizeof( Texture );
+
+        // The texture data is stored in its GPU format (DDS or raw texels) so the GPU allocation is roughly the same size as the data we keep on the CPU
+        size_t const cpuDataSize = pTextureResource->m_rawData.size();
+        size_t const gpuDataSize = pTextureResource->m_rawData.size();
+        return objectSize + cpuDataSize + gpuDataSize;
+    }
+
     Resource::InstallResult TextureLoader::Install( ResourceID const& resourceID, Resource::ResourceRecord* pResourceRecord, Resource::InstallDependencyList const& installDependencies ) const
     {
         auto pTextureResource = pResourceRecord->GetResourceData<Texture>();
@@ -33,6 +33,7 @@ namespace EE::Render
         virtual Resource::InstallResult Install( ResourceID const& resourceID, Resource::ResourceRecord* pResourceRecord, Resource::InstallDependencyList const& installDependencies ) const override;
         virtual Resource::InstallResult UpdateInstall( ResourceID const& resourceID, Resource::ResourceRecord* pResourceRecord ) const override;
         virtual void Uninstall( ResourceID const& resourceID, Resource::ResourceRecord* pResourceRecord ) const override;
+        virtual size_t CalculateMemorySize( ResourceID const& resourceID, Resource::ResourceRecord const* pResourceRecord, size_t rawDataSize ) const override;
 
     private:
 
@@ -159,6 +159,7 @@ namespace EE::Render
         // Unregistrations occur at the start of the frame
         // The world might be paused so we might leave an invalid component in this array
         m_visibleStaticMeshComponents.clear();
+        m_sunShadowStaticMeshComponents.clear();
 
         if ( pMeshComponent->HasMeshResourceSet() )
         {
@@ -217,6 +218,7 @@ namespace EE::Render
         // Unregistrations occur at the start of the frame
         // The world might be paused so we might leave an invalid component in this array
         m_visibleSkeletalMeshComponents.clear();
+        m_sunShadowSkeletalMeshComponents.clear();
 
         // Remove component from mesh group
         if ( pMeshComponent->HasMeshResourceSet() )
@@ -283,8 +285,7 @@ namespace EE::Render
                 EE_LOG_ENTITY_ERROR( pMeshComponent, "Render", "Someone moved a mesh with static mobility: %s with entity ID %u. This should not be done!", pMeshComponent->GetNameID().c_str(), pMeshComponent->GetEntityID().m_value );
             }
 
-            m_staticMobilityTree.RemoveBox( pMeshComponent );
-            m_staticMobilityTree.InsertBox( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
+            m_staticMobilityTree.Refit( pMeshComponent->GetWorldBounds().GetAABB(), pMeshComponent );
         }
 
         m_staticMobilityTransformUpdateList.clear();
@@ -293,48 +294,15 @@ namespace EE::Render
         // Culling
         //-------------------------------------------------------------------------
 
-        AABB const viewBounds = ctx.GetViewport()->GetViewVolume().GetAABB();
+        Math::ViewVolume const& viewVolume = ctx.GetViewport()->GetViewVolume();
+        CullMeshes( viewVolume );
 
-        m_visibleStaticMeshComponents.clear();
-        {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh AABB Cull" );
-            m_staticMobilityTree.FindOverlaps( viewBounds, m_visibleStaticMeshComponents );
-
-            for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0 ; i-- )
-            {
-                if ( !m_visibleStaticMeshComponents[i]->IsVisible() )
-                {
-                    m_visibleStaticMeshComponents.erase_unsorted( m_visibleStaticMeshComponents.begin() + i );
-                }
-            }
-        }
-
-        for ( auto pMeshComponent : m_dynamicStaticMeshComponents )
+        if ( m_isOcclusionCullingEnabled )
         {
-            EE_PROFILE_SCOPE_RENDER( "Static Mesh Dynamic Cull" );
-
-            if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
-            {
-                m_visibleStaticMeshComponents.emplace_back( pMeshComponent );
-            }
+            PerformOcclusionCulling( viewVolume );
         }
 
-        //-------------------------------------------------------------------------
-
-        m_visibleSkeletalMeshComponents.clear();
-
-        for ( auto const& meshGroup : m_skeletalMeshGroups )
-        {
-            EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Dynamic Cull" );
-
-            for ( auto pMeshComponent : meshGroup.m_components )
-            {
-                if ( pMeshComponent->IsVisible() && viewBounds.Overlaps( pMeshComponent->GetWorldBounds() ) )
-                {
-                    m_visibleSkeletalMeshComponents.emplace_back( pMeshComponent );
-                }
-            }
-        }
+        CullSunShadowCasters( viewVolume );
 
         //-------------------------------------------------------------------------
         // Debug
@@ -386,11 +354,237 @@ namespace EE::Render
                 pMeshComponent->GetMesh()->DrawBindPose( drawCtx, pMeshComponent->GetWorldTransform() );
             }
         }
+
+        if ( m_showOccluders )
+        {
+            for ( auto const& pMeshComponent : m_occluders )
+            {
+                drawCtx.DrawWireBox( pMeshComponent->GetWorldBounds(), Colors::Orange );
+            }
+        }
         #endif
     }
 
     //-------------------------------------------------------------------------
 
+    void RendererWorldSystem::CullMeshes( Math::ViewVolume const& viewVolume )
+    {
+        m_cullingStats = CullingStats();
+        m_frustumCuller.SetViewVolume( viewVolume );
+
+        // Static mobility meshes: broadphase against the tree using the frustum, then the full frustum test against the oriented bounds
+        //-------------------------------------------------------------------------
+
+        m_visibleStaticMeshComponents.clear();
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Frustum Cull" );
+            m_staticMobilityTree.FindOverlaps( viewVolume, m_staticMeshCullingCandidates );
+            m_cullingStats.m_numStaticBroadphaseCandidates = (int32_t) m_staticMeshCullingCandidates.size();
+
+            m_cullingStats.m_numStaticFrustumTested = m_frustumCuller.Cull( m_staticMeshCullingCandidates, m_visibleStaticMeshComponents );
+            m_cullingStats.m_numStaticFrustumVisible = (int32_t) m_visibleStaticMeshComponents.size();
+        }
+
+        // Dynamic mobility meshes
+        //-------------------------------------------------------------------------
+
+        {
+            EE_PROFILE_SCOPE_RENDER( "Static Mesh Dynamic Cull" );
+            m_cullingStats.m_numDynamicFrustumTested = m_frustumCuller.Cull( m_dynamicStaticMeshComponents, m_visibleStaticMeshComponents );
+            m_cullingStats.m_numDynamicFrustumVisible = (int32_t) m_visibleStaticMeshComponents.size() - m_cullingStats.m_numStaticFrustumVisible;
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_visibleSkeletalMeshComponents.clear();
+        {
+            EE_PROFILE_SCOPE_RENDER( "Skeletal Mesh Dynamic Cull" );
+
+            for ( auto const& meshGroup : m_skeletalMeshGroups )
+            {
+                m_cullingStats.m_numSkeletalFrustumTested += m_frustumCuller.Cull( meshGroup.m_components, m_visibleSkeletalMeshComponents );
+            }
+
+            m_cullingStats.m_numSkeletalFrustumVisible = (int32_t) m_visibleSkeletalMeshComponents.size();
+        }
+    }
+
+    void RendererWorldSystem::CullSunShadowCasters( Math::ViewVolume const& viewVolume )
+    {
+        EE_PROFILE_SCOPE_RENDER( "Sun Shadow Caster Cull" );
+
+        m_sunShadowStaticMeshComponents.clear();
+        m_sunShadowSkeletalMeshComponents.clear();
+
+        DirectionalLightComponent const* pDirectionalLightComponent = m_registeredDirectionLightComponents.empty() ? nullptr : m_registeredDirectionLightComponents[0];
+        m_hasSunShadows = pDirectionalLightComponent != nullptr && pDirectionalLightComponent->GetShadowed();
+        if ( !m_hasSunShadows )
+        {
+            return;
+        }
+
+        m_sunShadowViewVolume = CalculateSunShadowViewVolume( viewVolume, pDirectionalLightComponent->GetWorldTransform(), s_sunShadowDistance );
+        m_sunShadowFrustumCuller.SetViewVolume( m_sunShadowViewVolume );
+
+        // Static meshes
+        //-------------------------------------------------------------------------
+
+        m_staticMobilityTree.FindOverlaps( m_sunShadowViewVolume, m_sunShadowCullingCandidates );
+        m_sunShadowFrustumCuller.Cull( m_sunShadowCullingCandidates, m_sunShadowStaticMeshComponents );
+        m_sunShadowFrustumCuller.Cull( m_dynamicStaticMeshComponents, m_sunShadowStaticMeshComponents );
+        m_cullingStats.m_numStaticShadowCasters = (int32_t) m_sunShadowStaticMeshComponents.size();
+
+        // Skeletal meshes
+        //-------------------------------------------------------------------------
+
+        for ( auto const& meshGroup : m_skeletalMeshGroups )
+        {
+            m_sunShadowFrustumCuller.Cull( meshGroup.m_components, m_sunShadowSkeletalMeshComponents );
+        }
+
+        m_cullingStats.m_numSkeletalShadowCasters = (int32_t) m_sunShadowSkeletalMeshComponents.size();
+    }
+
+    Math::ViewVolume RendererWorldSystem::CalculateSunShadowViewVolume( Math::ViewVolume const& viewVolume, Transform const& lightWorldTransform, float shadowDistance )
+    {
+        Transform lightTransform = lightWorldTransform;
+        lightTransform.SetTranslation( Vector::Zero );
+        Transform const invLightTransform = lightTransform.GetInverse();
+
+        // Get a modified camera view volume that has the shadow distance as the z far.
+        // This will get us the appropriate corners to translate into light space.
+
+        // To make these cascade, you do this in a loop and move the depth range along by your
+        // cascade distance.
+        Math::ViewVolume camVolume = viewVolume;
+        camVolume.SetDepthRange( FloatRange( 1.0f, shadowDistance ) );
+
+        Math::ViewVolume::VolumeCorners corners = camVolume.GetCorners();
+
+        // Translate into light space.
+        for ( int32_t i = 0; i < 8; i++ )
+        {
+            corners.m_points[i] = invLightTransform.TransformPoint( corners.m_points[i] );
+        }
+
+        // Note for understanding, cornersMin and cornersMax are in light space, not world space.
+        Vector cornersMin = Vector::One * FLT_MAX;
+        Vector cornersMax = Vector::One * -FLT_MAX;
+
+        for ( int32_t i = 0; i < 8; i++ )
+        {
+            cornersMin = Vector::Min( cornersMin, corners.m_points[i] );
+            cornersMax = Vector::Max( cornersMax, corners.m_points[i] );
+        }
+
+        Vector lightPosition = Vector::Lerp( cornersMin, cornersMax, 0.5f );
+        lightPosition = Vector::Select( lightPosition, cornersMax, Vector::Select0100 ); //force lightPosition to the "back" of the box.
+        lightPosition = lightTransform.TransformPoint( lightPosition );   //Light position now in world space.
+        lightTransform.SetTranslation( lightPosition );   //Assign to the lightTransform, now it's positioned above our view frustrum.
+
+        Vector delta = cornersMax - cornersMin;
+        float dim = Math::Max( delta.m_x, delta.m_z );
+        return Math::ViewVolume( Float2( dim ), FloatRange( 1.0, delta.m_y ), lightTransform.ToMatrix() );
+    }
+
+    void RendererWorldSystem::PerformOcclusionCulling( Math::ViewVolume const& viewVolume )
+    {
+        EE_PROFILE_SCOPE_RENDER( "Occlusion Cull" );
+
+        m_occlusionBuffer.Reset( viewVolume );
+
+        // Select occluders: the largest on-screen visible static mobility meshes
+        //-------------------------------------------------------------------------
+
+        struct OccluderCandidate
+        {
+            StaticMeshComponent const*  m_pComponent;
+            int32_t                     m_screenArea;
+        };
+
+        TInlineVector<OccluderCandidate, s_maxOccluders> occluderCandidates;
+
+        OcclusionBuffer::ScreenRect screenRect;
+        for ( auto pMeshComponent : m_visibleStaticMeshComponents )
+        {
+            if ( pMeshComponent->GetMobility() != Mobility::Static )
+            {
+                continue;
+            }
+
+            if ( pMeshComponent->GetMesh()->GetNumIndices() / 3 > s_maxOccluderTriangles )
+            {
+                continue;
+            }
+
+            if ( !m_occlusionBuffer.CalculateScreenRect( pMeshComponent->GetWorldBounds(), screenRect ) )
+            {
+                continue;
+            }
+
+            int32_t const screenArea = screenRect.GetArea();
+            if ( screenArea >= s_minOccluderScreenArea )
+            {
+                occluderCandidates.push_back( { pMeshComponent, screenArea } );
+            }
+        }
+
+        eastl::sort( occluderCandidates.begin(), occluderCandidates.end(), [] ( OccluderCandidate const& a, OccluderCandidate const& b ) { return a.m_screenArea > b.m_screenArea; } );
+
+        // Rasterize occluders
+        //-------------------------------------------------------------------------
+
+        m_occluders.clear();
+        int32_t const numOccluders = Math::Min( (int32_t) occluderCandidates.size(), s_maxOccluders );
+        for ( auto i = 0; i < numOccluders; i++ )
+        {
+            StaticMeshComponent const* pMeshComponent = occluderCandidates[i].m_pComponent;
+            Transform const& worldTransform = pMeshComponent->GetWorldTransform();
+            Vector const finalScale = pMeshComponent->GetLocalScale() * worldTransform.GetScale();
+            Matrix meshWorldTransform = Matrix( worldTransform.GetRotation(), worldTransform.GetTranslation(), finalScale );
+            meshWorldTransform.SetTranslation( worldTransform.GetTranslation() );
+
+            m_cullingStats.m_numOccluderTriangles += m_occlusionBuffer.RasterizeMesh( pMeshComponent->GetMesh(), meshWorldTransform );
+            m_occluders.emplace_back( pMeshComponent );
+        }
+
+        m_cullingStats.m_numOccluders = numOccluders;
+
+        if ( m_occluders.empty() )
+        {
+            return;
+        }
+
+        // Test all visible meshes against the occluders, occluders themselves are always visible
+        //-------------------------------------------------------------------------
+
+        for ( int32_t i = int32_t( m_visibleStaticMeshComponents.size() ) - 1; i >= 0; i-- )
+        {
+            StaticMeshComponent const* pMeshComponent = m_visibleStaticMeshComponents[i];
+            if ( VectorContains( m_occluders, pMeshComponent ) )
+            {
+                continue;
+            }
+
+            if ( m_occlusionBuffer.IsOccluded( pMeshComponent->GetWorldBounds() ) )
+            {
+                m_visibleStaticMeshComponents.erase_unsorted( m_visibleStaticMeshComponents.begin() + i );
+                m_cullingStats.m_numStaticOcclusionCulled++;
+            }
+        }
+
+        for ( int32_t i = int32_t( m_visibleSkeletalMeshComponents.size() ) - 1; i >= 0; i-- )
+        {
+            if ( m_occlusionBuffer.IsOccluded( m_visibleSkeletalMeshComponents[i]->GetWorldBounds() ) )
+            {
+                m_visibleSkeletalMeshComponents.erase_unsorted( m_visibleSkeletalMeshComponents.begin() + i );
+                m_cullingStats.m_numSkeletalOcclusionCulled++;
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void RendererWorldSystem::OnStaticMeshMobilityUpdated( StaticMeshComponent* pComponent )
     {
         EE_ASSERT( pComponent != nullptr && pComponent->IsInitialized() );
@@ -4,8 +4,11 @@
 #include "Engine/Entity/EntityWorldSystem.h"
 #include "Engine/Render/Components/Component_StaticMesh.h"
 #include "Engine/Render/Mesh/SkeletalMesh.h"
+#include "Engine/Render/Culling/FrustumCuller.h"
+#include "Engine/Render/Culling/OcclusionBuffer.h"
 #include "System/Render/RenderDevice.h"
-#include "System/Math/AABBTree.h"
+#include "System/Math/WideAABBTree.h"
+#include "System/Math/ViewVolume.h"
 #include "System/Types/Event.h"
 #include "System/Systems.h"
 #include "System/Types/IDVector.h"
@@ -61,6 +64,32 @@ namespace EE::Render
             TVector<SkeletalMeshComponent*>                     m_components;
         };
 
+        // Per-stage culling results for the last update
+        struct CullingStats
+        {
+            int32_t                                             m_numStaticBroadphaseCandidates = 0;
+            int32_t                                             m_numStaticFrustumTested = 0;
+            int32_t                                             m_numStaticFrustumVisible = 0;
+            int32_t                                             m_numDynamicFrustumTested = 0;
+            int32_t                                             m_numDynamicFrustumVisible = 0;
+            int32_t                                             m_numSkeletalFrustumTested = 0;
+            int32_t                                             m_numSkeletalFrustumVisible = 0;
+            int32_t                                             m_numOccluders = 0;
+            int32_t                                             m_numOccluderTriangles = 0;
+            int32_t                                             m_numStaticOcclusionCulled = 0;
+            int32_t                                             m_numSkeletalOcclusionCulled = 0;
+            int32_t                                             m_numStaticShadowCasters = 0;
+            int32_t                                             m_numSkeletalShadowCasters = 0;
+        };
+
+        // Large static meshes are rasterized into the occlusion buffer, this limits the cost of doing so
+        constexpr static int32_t const s_maxOccluders = 32;
+        constexpr static int32_t const s_maxOccluderTriangles = 4096;
+        constexpr static int32_t const s_minOccluderScreenArea = ( OcclusionBuffer::s_width * OcclusionBuffer::s_height ) / 50;
+
+        // The distance from the camera that the sun shadow map covers
+        constexpr static float const s_sunShadowDistance = 50.0f;
+
     public:
 
         // Debug
@@ -78,6 +107,7 @@ namespace EE::Render
 
         virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
+        virtual bool IsWorldLocal() const override { return true; }
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
@@ -96,6 +126,18 @@ namespace EE::Render
         void RegisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
         void UnregisterSkeletalMeshComponent( Entity const* pEntity, SkeletalMeshComponent* pMeshComponent );
 
+        // Culling
+        //-------------------------------------------------------------------------
+
+        void CullMeshes( Math::ViewVolume const& viewVolume );
+        void PerformOcclusionCulling( Math::ViewVolume const& viewVolume );
+
+        // Shadow casters are culled against the light's shadow volume rather than the camera, since off-screen or occluded meshes can still cast visible shadows
+        void CullSunShadowCasters( Math::ViewVolume const& viewVolume );
+
+        // Calculate the orthographic volume covered by the sun shadow map, this fits the camera view up to the shadow distance
+        static Math::ViewVolume CalculateSunShadowViewVolume( Math::ViewVolume const& viewVolume, Transform const& lightWorldTransform, float shadowDistance );
+
     private:
 
         // Static meshes
@@ -108,13 +150,29 @@ namespace EE::Render
         Threading::Mutex                                                m_mobilityUpdateListLock;               // Mobility switches can occur on any thread so the list needs to be threadsafe. We use a simple lock for now since we dont expect too many switches
         TVector<StaticMeshComponent*>                                   m_mobilityUpdateList;                   // A list of all components that switched mobility during this frame, will results in an update of the various spatial data structures next frame
         TVector<StaticMeshComponent*>                                   m_staticMobilityTransformUpdateList;    // A list of all static mobility components that have moved during this frame, will results in an update of the various spatial data structures next frame
-        Math::AABBTree                                                  m_staticMobilityTree;
+        Math::WideAABBTree                                              m_staticMobilityTree;
 
         // Skeletal meshes
         TIDVector<ComponentID, SkeletalMeshComponent*>                  m_registeredSkeletalMeshComponents;
         TIDVector<uint32_t, SkeletalMeshGroup>                          m_skeletalMeshGroups;
         TVector<SkeletalMeshComponent const*>                           m_visibleSkeletalMeshComponents;
 
+        // Culling
+        FrustumCuller                                                   m_frustumCuller;
+        OcclusionBuffer                                                 m_occlusionBuffer;
+        TVector<StaticMeshComponent const*>                             m_staticMeshCullingCandidates;
+        TVector<StaticMeshComponent const*>                             m_occluders;
+        CullingStats                                                    m_cullingStats;
+        bool                                                            m_isOcclusionCullingEnabled = false;    // The occlusion test is not conservative (low resolution and sampled at pixel centers) so visible meshes can be culled, keep it opt-in
+
+        // Sun shadows
+        Math::ViewVolume                                                m_sunShadowViewVolume;
+        FrustumCuller                                                   m_sunShadowFrustumCuller;
+        TVector<StaticMeshComponent const*>                             m_sunShadowCullingCandidates;
+        TVector<StaticMeshComponent const*>                             m_sunShadowStaticMeshComponents;
+        TVector<SkeletalMeshComponent const*>                           m_sunShadowSkeletalMeshComponents;
+        bool                                                            m_hasSunShadows = false;
+
         // Lights
         TIDVector<ComponentID, DirectionalLightComponent*>              m_registeredDirectionLightComponents;
         TIDVector<ComponentID, PointLightComponent*>                    m_registeredPointLightComponents;
@@ -128,6 +186,7 @@ namespace EE::Render
         bool                                                            m_showSkeletalMeshBounds = false;
         bool                                                            m_showSkeletalMeshBones = false;
         bool                                                            m_showSkeletalMeshBindPoses = false;
+        bool                                                            m_showOccluders = false;
         #endif
     };
 }
\ No newline at end of file
@@ -0,0 +1,379 @@
+#include "DebugView_MapStreaming.h"
+#include "Engine/Streaming/Systems/WorldSystem_MapStreaming.h"
+#include "Engine/Camera/Systems/WorldSystem_CameraManager.h"
+#include "Engine/Camera/Components/Component_DebugCamera.h"
+#include "Engine/Entity/EntityWorld.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Imgui/ImguiX.h"
+#include "System/Log.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE
+{
+    MapStreamingDebugView::MapStreamingDebugView()
+    {
+        m_menus.emplace_back( DebugMenu( "Engine/Map Streaming", [this] ( EntityWorldUpdateContext const& context ) { DrawMenu( context ); } ) );
+    }
+
+    void MapStreamingDebugView::Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld )
+    {
+        EntityWorldDebugView::Initialize( systemRegistry, pWorld );
+        m_pStreamingSystem = pWorld->GetWorldSystem<MapStreamingSystem>();
+    }
+
+    void MapStreamingDebugView::Shutdown()
+    {
+        if ( m_isSoakTestRunning )
+        {
+            EndSoakTest( false );
+        }
+
+        m_pStreamingSystem = nullptr;
+        EntityWorldDebugView::Shutdown();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MapStreamingDebugView::DrawMenu( EntityWorldUpdateContext const& context )
+    {
+        if ( ImGui::MenuItem( "Show Map Streaming" ) )
+        {
+            m_isStreamingWindowOpen = true;
+        }
+
+        ImGui::MenuItem( "Draw Streaming Cells", nullptr, &m_drawCells );
+    }
+
+    void MapStreamingDebugView::DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass )
+    {
+        EE_ASSERT( m_pWorld != nullptr );
+
+        if ( m_isSoakTestRunning )
+        {
+            UpdateSoakTest( context );
+        }
+
+        if ( m_drawCells || m_isSoakTestRunning )
+        {
+            DrawCells( context );
+        }
+
+        if ( m_isStreamingWindowOpen )
+        {
+            if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
+            DrawStreamingWindow( context );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MapStreamingDebugView::DrawCells( EntityWorldUpdateContext const& context )
+    {
+        auto drawingCtx = context.GetDrawingContext();
+
+        for ( auto const& cell : m_pStreamingSystem->m_cells )
+        {
+            Color cellColor = Colors::Gray;
+            if ( m_pWorld->IsMapLoaded( cell.m_mapResourceID ) )
+            {
+                cellColor = Colors::LimeGreen;
+            }
+            else if ( cell.m_loadRetryDelay > 0.0f )
+            {
+                cellColor = Colors::Red;
+            }
+            else if ( cell.m_isLoadRequested )
+            {
+                cellColor = Colors::Yellow;
+            }
+
+            drawingCtx.DrawWireBox( cell.m_bounds, cellColor );
+        }
+
+        if ( m_isSoakTestRunning )
+        {
+            drawingCtx.DrawPoint( m_soakTestPosition, Colors::Red, 15.0f );
+        }
+    }
+
+    void MapStreamingDebugView::DrawStreamingWindow( EntityWorldUpdateContext const& context )
+    {
+        ImGui::SetNextWindowBgAlpha( 0.75f );
+        if ( ImGui::Begin( "Map Streaming", &m_isStreamingWindowOpen ) )
+        {
+            // Settings
+            //-------------------------------------------------------------------------
+
+            bool useCamerasAsSources = m_pStreamingSystem->AreCamerasUsedAsSources();
+            ImGui::BeginDisabled( m_isSoakTestRunning );
+            if ( ImGui::Checkbox( "Use Cameras As Sources", &useCamerasAsSources ) )
+            {
+                m_pStreamingSystem->SetCamerasUsedAsSources( useCamerasAsSources );
+            }
+            ImGui::EndDisabled();
+
+            float radii[2] = { m_pStreamingSystem->GetLoadRadius(), m_pStreamingSystem->GetUnloadRadius() };
+            if ( ImGui::DragFloat2( "Load/Unload Radius", radii, 1.0f, 0.0f, 10000.0f, "%.1f" ) )
+            {
+                m_pStreamingSystem->SetStreamingRadii( radii[0], Math::Max( radii[0], radii[1] ) );
+            }
+
+            int32_t maxLoadRequests = m_pStreamingSystem->GetMaxLoadRequestsPerUpdate();
+            if ( ImGui::SliderInt( "Max Load Requests Per Update", &maxLoadRequests, 1, 16 ) )
+            {
+                m_pStreamingSystem->SetMaxLoadRequestsPerUpdate( maxLoadRequests );
+            }
+
+            float initializationBudget = m_pWorld->GetEntityInitializationBudget().ToFloat();
+            if ( ImGui::SliderFloat( "Entity Initialization Budget (ms)", &initializationBudget, 0.0f, 16.0f, "%.2f" ) )
+            {
+                const_cast<EntityWorld*>( m_pWorld )->SetEntityInitializationBudget( initializationBudget );
+            }
+
+            // Stats
+            //-------------------------------------------------------------------------
+
+            ImGui::Separator();
+
+            int32_t numRequestedCells = 0;
+            int32_t numLoadedCells = 0;
+            for ( auto const& cell : m_pStreamingSystem->m_cells )
+            {
+                numRequestedCells += cell.m_isLoadRequested ? 1 : 0;
+                numLoadedCells += m_pWorld->IsMapLoaded( cell.m_mapResourceID ) ? 1 : 0;
+            }
+
+            ImGui::Text( "Cells: %d (Requested: %d, Loaded: %d)", m_pStreamingSystem->GetNumCells(), numRequestedCells, numLoadedCells );
+            ImGui::Text( "Total Load Requests: %u, Total Unload Requests: %u", m_pStreamingSystem->m_numLoadRequests, m_pStreamingSystem->m_numUnloadRequests );
+            ImGui::Text( "Last Loading Update: %.2fms", m_pWorld->GetLastLoadingUpdateTime().ToFloat() );
+            ImGui::Checkbox( "Draw Cells", &m_drawCells );
+
+            // Cell Grid
+            //-------------------------------------------------------------------------
+
+            ImGui::Separator();
+            ImGui::Text( "Cell Grid" );
+
+            ImGui::BeginDisabled( m_isSoakTestRunning );
+            ImGui::InputText( "Map Path Format", m_gridPathFormat, 256 );
+            ImGui::DragFloat( "Cell Size", &m_gridCellSize, 1.0f, 1.0f, 10000.0f, "%.1f" );
+            ImGui::InputInt2( "Num Cells", m_gridNumCells );
+            m_gridNumCells[0] = Math::Max( m_gridNumCells[0], 1 );
+            m_gridNumCells[1] = Math::Max( m_gridNumCells[1], 1 );
+
+            if ( ImGui::Button( "Add Cell Grid" ) )
+            {
+                m_pStreamingSystem->AddCellGrid( m_gridPathFormat, Vector::Zero, m_gridCellSize, m_gridCellSize, m_gridNumCells[0], m_gridNumCells[1] );
+            }
+
+            ImGui::SameLine();
+
+            if ( ImGui::Button( "Remove All Cells" ) )
+            {
+                m_pStreamingSystem->RemoveAllCells();
+            }
+            ImGui::EndDisabled();
+
+            // Soak Test
+            //-------------------------------------------------------------------------
+
+            ImGui::Separator();
+            ImGui::Text( "Soak Test" );
+
+            ImGui::DragFloat( "Speed (m/s)", &m_soakTestSpeed, 1.0f, 1.0f, 1000.0f, "%.1f" );
+            ImGui::DragFloat( "Hitch Threshold (ms)", &m_hitchThreshold, 0.1f, 1.0f, 1000.0f, "%.1f" );
+
+            if ( m_isSoakTestRunning )
+            {
+                ImGui::Text( "Running: %d/%d waypoints, %d frames", m_soakTestTargetIdx, (int32_t) m_soakTestPath.size(), (int32_t) m_soakTestFrameTimes.size() );
+                if ( ImGui::Button( "Stop Soak Test" ) )
+                {
+                    EndSoakTest( false );
+                }
+            }
+            else
+            {
+                ImGui::BeginDisabled( m_pStreamingSystem->GetNumCells() == 0 );
+                if ( ImGui::Button( "Start Soak Test" ) )
+                {
+                    StartSoakTest();
+                }
+                ImGui::EndDisabled();
+            }
+
+            if ( m_lastSoakTestResults.m_numFrames > 0 )
+            {
+                ImGui::Text( "Last Run: %s, %d frames in %.2fs", m_lastSoakTestResults.m_wasCompleted ? "Completed" : "Stopped", m_lastSoakTestResults.m_numFrames, m_lastSoakTestResults.m_duration.ToFloat() );
+                ImGui::Text( "Frame Time - Avg: %.2fms, P99: %.2fms, Max: %.2fms", m_lastSoakTestResults.m_averageFrameTime.ToFloat(), m_lastSoakTestResults.m_p99FrameTime.ToFloat(), m_lastSoakTestResults.m_maxFrameTime.ToFloat() );
+                ImGui::Text( "Max Loading Update: %.2fms", m_lastSoakTestResults.m_maxLoadingUpdateTime.ToFloat() );
+                ImGui::Text( "Hitches: %d, Loads: %u, Unloads: %u", m_lastSoakTestResults.m_numHitches, m_lastSoakTestResults.m_numLoadRequests, m_lastSoakTestResults.m_numUnloadRequests );
+            }
+        }
+        ImGui::End();
+    }
+
+    //-------------------------------------------------------------------------
+    // Soak Test
+    //-------------------------------------------------------------------------
+
+    void MapStreamingDebugView::RunSoakTest( char const* pMapPathFormat, float cellSize, int32_t numCellsX, int32_t numCellsY )
+    {
+        EE_ASSERT( m_pStreamingSystem != nullptr && !m_isSoakTestRunning );
+        EE_ASSERT( pMapPathFormat != nullptr && cellSize > 0.0f && numCellsX > 0 && numCellsY > 0 );
+
+        m_pStreamingSystem->RemoveAllCells();
+        m_pStreamingSystem->AddCellGrid( pMapPathFormat, Vector::Zero, cellSize, cellSize, numCellsX, numCellsY );
+        EE_LOG_MESSAGE( "Entity", "Map Streaming", "Soak test generated a %d x %d cell grid (%.1fm cells) using '%s'", numCellsX, numCellsY, cellSize, pMapPathFormat );
+
+        StartSoakTest();
+    }
+
+    void MapStreamingDebugView::StartSoakTest()
+    {
+        EE_ASSERT( !m_isSoakTestRunning && m_pStreamingSystem->GetNumCells() > 0 );
+
+        // Build a serpentine path across all cells, the row spacing ensures that every cell comes within the load radius
+        //-------------------------------------------------------------------------
+
+        AABB bounds = m_pStreamingSystem->m_cells[0].m_bounds;
+        for ( auto const& cell : m_pStreamingSystem->m_cells )
+        {
+            bounds.AddPoint( cell.m_bounds.GetMin() );
+            bounds.AddPoint( cell.m_bounds.GetMax() );
+        }
+
+        Vector const boundsMin = bounds.GetMin();
+        Vector const boundsMax = bounds.GetMax();
+        float const pathHeight = bounds.GetCenter().GetZ();
+        float const rowSpacing = Math::Max( m_pStreamingSystem->GetLoadRadius(), 1.0f );
+
+        m_soakTestPath.clear();
+        bool isLeftToRight = true;
+        for ( float y = boundsMin.GetY(); ; y += rowSpacing )
+        {
+            y = Math::Min( y, boundsMax.GetY() );
+
+            Vector const rowStart( boundsMin.GetX(), y, pathHeight );
+            Vector const rowEnd( boundsMax.GetX(), y, pathHeight );
+            m_soakTestPath.emplace_back( isLeftToRight ? rowStart : rowEnd );
+            m_soakTestPath.emplace_back( isLeftToRight ? rowEnd : rowStart );
+            isLeftToRight = !isLeftToRight;
+
+            if ( y >= boundsMax.GetY() )
+            {
+                break;
+            }
+        }
+
+        // Replace the cameras with our own streaming source
+        //-------------------------------------------------------------------------
+
+        m_soakTestPosition = m_soakTestPath[0];
+        m_soakTestTargetIdx = 1;
+        m_soakTestSourceID = m_pStreamingSystem->AddSource( m_soakTestPosition );
+        m_wereCamerasUsedAsSources = m_pStreamingSystem->AreCamerasUsedAsSources();
+        m_pStreamingSystem->SetCamerasUsedAsSources( false );
+
+        m_soakTestStartLoadRequests = m_pStreamingSystem->m_numLoadRequests;
+        m_soakTestStartUnloadRequests = m_pStreamingSystem->m_numUnloadRequests;
+        m_soakTestFrameTimes.clear();
+        m_soakTestMaxLoadingUpdateTime = 0.0f;
+        m_isSoakTestRunning = true;
+    }
+
+    void MapStreamingDebugView::UpdateSoakTest( EntityWorldUpdateContext const& context )
+    {
+        EE_ASSERT( m_isSoakTestRunning );
+
+        m_soakTestFrameTimes.emplace_back( Milliseconds( context.GetRawDeltaTime() ).ToFloat() );
+        m_soakTestMaxLoadingUpdateTime = Math::Max( m_soakTestMaxLoadingUpdateTime, m_pWorld->GetLastLoadingUpdateTime() );
+
+        // Move the source along the path
+        //-------------------------------------------------------------------------
+
+        float remainingDistance = m_soakTestSpeed * context.GetRawDeltaTime().ToFloat();
+        while ( remainingDistance > 0.0f && m_soakTestTargetIdx < (int32_t) m_soakTestPath.size() )
+        {
+            Vector const toTarget = m_soakTestPath[m_soakTestTargetIdx] - m_soakTestPosition;
+            float const distanceToTarget = toTarget.GetLength3();
+            if ( distanceToTarget <= remainingDistance )
+            {
+                m_soakTestPosition = m_soakTestPath[m_soakTestTargetIdx];
+                remainingDistance -= distanceToTarget;
+                m_soakTestTargetIdx++;
+            }
+            else
+            {
+                m_soakTestPosition += toTarget * ( remainingDistance / distanceToTarget );
+                remainingDistance = 0.0f;
+            }
+        }
+
+        m_pStreamingSystem->SetSourcePosition( m_soakTestSourceID, m_soakTestPosition );
+
+        // Fly the debug camera along with the source so the streaming can be observed
+        auto pCameraManager = m_pWorld->GetWorldSystem<CameraManager>();
+        if ( pCameraManager->IsDebugCameraEnabled() && pCameraManager->GetDebugCamera() != nullptr )
+        {
+            DebugCameraComponent* pDebugCamera = pCameraManager->GetDebugCamera();
+            Transform cameraTransform = pDebugCamera->GetWorldTransform();
+            cameraTransform.SetTranslation( m_soakTestPosition );
+            pDebugCamera->SetWorldTransform( cameraTransform );
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( m_soakTestTargetIdx >= (int32_t) m_soakTestPath.size() )
+        {
+            EndSoakTest( true );
+        }
+    }
+
+    void MapStreamingDebugView::EndSoakTest( bool wasCompleted )
+    {
+        EE_ASSERT( m_isSoakTestRunning );
+
+        m_pStreamingSystem->RemoveSource( m_soakTestSourceID );
+        m_pStreamingSystem->SetCamerasUsedAsSources( m_wereCamerasUsedAsSources );
+        m_isSoakTestRunning = false;
+
+        // Calculate results
+        //-------------------------------------------------------------------------
+
+        SoakTestResults results;
+        results.m_wasCompleted = wasCompleted;
+        results.m_numFrames = (int32_t) m_soakTestFrameTimes.size();
+        results.m_maxLoadingUpdateTime = m_soakTestMaxLoadingUpdateTime;
+        results.m_numLoadRequests = m_pStreamingSystem->m_numLoadRequests - m_soakTestStartLoadRequests;
+        results.m_numUnloadRequests = m_pStreamingSystem->m_numUnloadRequests - m_soakTestStartUnloadRequests;
+
+        if ( results.m_numFrames > 0 )
+        {
+            eastl::sort( m_soakTestFrameTimes.begin(), m_soakTestFrameTimes.end() );
+
+            float totalFrameTime = 0.0f;
+            for ( float frameTime : m_soakTestFrameTimes )
+            {
+                totalFrameTime += frameTime;
+                results.m_numHitches += ( frameTime > m_hitchThreshold ) ? 1 : 0;
+            }
+
+            results.m_duration = Milliseconds( totalFrameTime ).ToSeconds();
+            results.m_averageFrameTime = totalFrameTime / results.m_numFrames;
+            results.m_p99FrameTime = m_soakTestFrameTimes[(int32_t) ( ( results.m_numFrames - 1 ) * 0.99f )];
+            results.m_maxFrameTime = m_soakTestFrameTimes.back();
+        }
+
+        m_lastSoakTestResults = results;
+        m_soakTestFrameTimes.clear();
+        m_soakTestPath.clear();
+
+        EE_LOG_MESSAGE( "Entity", "Map Streaming", "Soak test %s: %d frames in %.2fs, Avg: %.2fms, P99: %.2fms, Max: %.2fms, Max Loading Update: %.2fms, Hitches (>%.1fms): %d, Loads: %u, Unloads: %u",
+            wasCompleted ? "completed" : "stopped", results.m_numFrames, results.m_duration.ToFloat(), results.m_averageFrameTime.ToFloat(), results.m_p99FrameTime.ToFloat(), results.m_maxFrameTime.ToFloat(),
+            results.m_maxLoadingUpdateTime.ToFloat(), m_hitchThreshold, results.m_numHitches, results.m_numLoadRequests, results.m_numUnloadRequests );
+    }
+}
+#endif
\ No newline at end of file
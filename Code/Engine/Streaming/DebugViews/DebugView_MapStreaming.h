@@ -0,0 +1,90 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Entity/EntityWorldDebugView.h"
+#include "System/Math/Vector.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+
+#if EE_DEVELOPMENT_TOOLS
+namespace EE
+{
+    class MapStreamingSystem;
+
+    //-------------------------------------------------------------------------
+
+    class EE_ENGINE_API MapStreamingDebugView : public EntityWorldDebugView
+    {
+        EE_REGISTER_TYPE( MapStreamingDebugView );
+
+        struct SoakTestResults
+        {
+            int32_t                 m_numFrames = 0;
+            Seconds                 m_duration = 0.0f;
+            Milliseconds            m_averageFrameTime = 0.0f;
+            Milliseconds            m_p99FrameTime = 0.0f;
+            Milliseconds            m_maxFrameTime = 0.0f;
+            Milliseconds            m_maxLoadingUpdateTime = 0.0f;
+            int32_t                 m_numHitches = 0;
+            uint32_t                m_numLoadRequests = 0;
+            uint32_t                m_numUnloadRequests = 0;
+            bool                    m_wasCompleted = false;
+        };
+
+    public:
+
+        MapStreamingDebugView();
+
+        // Replace all cells with a generated grid of cells and run a soak test over it, the results are logged once the test ends
+        // The cell maps are named using the supplied format (with the x and y cell indices), cells whose maps fail to load will keep being retried
+        void RunSoakTest( char const* pMapPathFormat, float cellSize, int32_t numCellsX, int32_t numCellsY );
+        inline bool IsSoakTestRunning() const { return m_isSoakTestRunning; }
+        inline bool WasLastSoakTestCompleted() const { return m_lastSoakTestResults.m_wasCompleted; }
+
+        // The default map path format used for generated cell grids
+        inline char const* GetDefaultCellGridPathFormat() const { return m_gridPathFormat; }
+
+    private:
+
+        virtual void Initialize( SystemRegistry const& systemRegistry, EntityWorld const* pWorld ) override;
+        virtual void Shutdown() override;
+        virtual void DrawWindows( EntityWorldUpdateContext const& context, ImGuiWindowClass* pWindowClass ) override;
+
+        void DrawMenu( EntityWorldUpdateContext const& context );
+        void DrawStreamingWindow( EntityWorldUpdateContext const& context );
+        void DrawCells( EntityWorldUpdateContext const& context );
+
+        // Soak Test - flies a streaming source (and the debug camera if enabled) across all cells and records frame times to find streaming hitches
+        void StartSoakTest();
+        void UpdateSoakTest( EntityWorldUpdateContext const& context );
+        void EndSoakTest( bool wasCompleted );
+
+    private:
+
+        MapStreamingSystem*         m_pStreamingSystem = nullptr;
+        bool                        m_isStreamingWindowOpen = false;
+        bool                        m_drawCells = false;
+
+        // Cell Grid
+        char                        m_gridPathFormat[256] = "data://maps/world/cell_%d_%d.map";
+        float                       m_gridCellSize = 128.0f;
+        int32_t                     m_gridNumCells[2] = { 8, 8 };
+
+        // Soak Test
+        bool                        m_isSoakTestRunning = false;
+        float                       m_soakTestSpeed = 50.0f;
+        float                       m_hitchThreshold = 33.3f;
+        TVector<Vector>             m_soakTestPath;
+        int32_t                     m_soakTestTargetIdx = 0;
+        Vector                      m_soakTestPosition;
+        uint32_t                    m_soakTestSourceID = 0;
+        bool                        m_wereCamerasUsedAsSources = true;
+        uint32_t                    m_soakTestStartLoadRequests = 0;
+        uint32_t                    m_soakTestStartUnloadRequests = 0;
+        TVector<float>              m_soakTestFrameTimes;
+        Milliseconds                m_soakTestMaxLoadingUpdateTime = 0.0f;
+        SoakTestResults             m_lastSoakTestResults;
+    };
+}
+#endif
\ No newline at end of file
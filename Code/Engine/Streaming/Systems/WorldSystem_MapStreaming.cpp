@@ -0,0 +1,294 @@
+#include "WorldSystem_MapStreaming.h"
+#include "Engine/Camera/Systems/WorldSystem_CameraManager.h"
+#include "Engine/Player/Systems/WorldSystem_PlayerManager.h"
+#include "Engine/Entity/EntityWorldUpdateContext.h"
+#include "System/Log.h"
+#include "EASTL/sort.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    // Distance from a point to the closest point on the box, zero if the point is inside the box
+    static float GetDistanceToBounds( Vector const& point, AABB const& bounds )
+    {
+        Vector const delta = Vector::Max( ( point - bounds.GetCenter() ).GetAbs() - bounds.GetExtents(), Vector::Zero );
+        return delta.GetLength3();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MapStreamingSystem::ShutdownSystem()
+    {
+        // The world unloads all its maps on shutdown, so there is nothing to unload here
+        m_cells.clear();
+        m_cellsToUnload.clear();
+        m_sources.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MapStreamingSystem::AddCell( ResourceID const& mapResourceID, AABB const& bounds )
+    {
+        EE_ASSERT( mapResourceID.IsValid() && bounds.IsValid() );
+
+        // Existing cells keep their streaming state, only their bounds are updated
+        auto const foundCellIter = VectorFind( m_cells, mapResourceID, [] ( StreamingCell const& cell, ResourceID const& mapResourceID ) { return cell.m_mapResourceID == mapResourceID; } );
+        if ( foundCellIter != m_cells.end() )
+        {
+            foundCellIter->m_bounds = bounds;
+            return;
+        }
+
+        // If the cell was just removed, cancel the pending unload and keep the loaded map
+        auto const foundUnloadIter = VectorFind( m_cellsToUnload, mapResourceID );
+        bool const isAlreadyLoaded = ( foundUnloadIter != m_cellsToUnload.end() );
+        if ( isAlreadyLoaded )
+        {
+            m_cellsToUnload.erase_unsorted( foundUnloadIter );
+        }
+
+        auto& cell = m_cells.emplace_back( mapResourceID, bounds );
+        cell.m_isLoadRequested = isAlreadyLoaded;
+    }
+
+    void MapStreamingSystem::RemoveCell( ResourceID const& mapResourceID )
+    {
+        auto const foundCellIter = VectorFind( m_cells, mapResourceID, [] ( StreamingCell const& cell, ResourceID const& mapResourceID ) { return cell.m_mapResourceID == mapResourceID; } );
+        EE_ASSERT( foundCellIter != m_cells.end() );
+
+        if ( foundCellIter->m_isLoadRequested )
+        {
+            m_cellsToUnload.emplace_back( mapResourceID );
+        }
+
+        m_cells.erase_unsorted( foundCellIter );
+    }
+
+    void MapStreamingSystem::RemoveAllCells()
+    {
+        for ( auto const& cell : m_cells )
+        {
+            if ( cell.m_isLoadRequested )
+            {
+                m_cellsToUnload.emplace_back( cell.m_mapResourceID );
+            }
+        }
+
+        m_cells.clear();
+    }
+
+    void MapStreamingSystem::AddCellGrid( char const* pMapPathFormat, Vector const& origin, float cellSize, float cellHeight, int32_t numCellsX, int32_t numCellsY )
+    {
+        EE_ASSERT( pMapPathFormat != nullptr );
+        EE_ASSERT( cellSize > 0.0f && cellHeight > 0.0f && numCellsX > 0 && numCellsY > 0 );
+
+        Vector const cellExtents( cellSize / 2, cellSize / 2, cellHeight / 2 );
+        for ( int32_t y = 0; y < numCellsY; y++ )
+        {
+            for ( int32_t x = 0; x < numCellsX; x++ )
+            {
+                ResourceID const mapResourceID( String( String::CtorSprintf(), pMapPathFormat, x, y ) );
+                if ( !mapResourceID.IsValid() )
+                {
+                    EE_LOG_ERROR( "Entity", "Map Streaming", "Invalid cell map path: %s", mapResourceID.c_str() );
+                    continue;
+                }
+
+                Vector const cellCenter = origin + Vector( ( x + 0.5f ) * cellSize, ( y + 0.5f ) * cellSize, cellHeight / 2 );
+                AddCell( mapResourceID, AABB( cellCenter, cellExtents ) );
+            }
+        }
+    }
+
+    bool MapStreamingSystem::IsCellLoadRequested( ResourceID const& mapResourceID ) const
+    {
+        auto const foundCellIter = VectorFind( m_cells, mapResourceID, [] ( StreamingCell const& cell, ResourceID const& mapResourceID ) { return cell.m_mapResourceID == mapResourceID; } );
+        return ( foundCellIter != m_cells.end() ) ? foundCellIter->m_isLoadRequested : false;
+    }
+
+    //-------------------------------------------------------------------------
+
+    uint32_t MapStreamingSystem::AddSource( Vector const& position )
+    {
+        auto const& source = m_sources.emplace_back( m_nextSourceID++, position );
+        return source.m_ID;
+    }
+
+    void MapStreamingSystem::SetSourcePosition( uint32_t sourceID, Vector const& position )
+    {
+        auto const foundSourceIter = VectorFind( m_sources, sourceID, [] ( StreamingSource const& source, uint32_t sourceID ) { return source.m_ID == sourceID; } );
+        EE_ASSERT( foundSourceIter != m_sources.end() );
+        foundSourceIter->m_position = position;
+    }
+
+    void MapStreamingSystem::RemoveSource( uint32_t sourceID )
+    {
+        auto const foundSourceIter = VectorFind( m_sources, sourceID, [] ( StreamingSource const& source, uint32_t sourceID ) { return source.m_ID == sourceID; } );
+        EE_ASSERT( foundSourceIter != m_sources.end() );
+        m_sources.erase_unsorted( foundSourceIter );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MapStreamingSystem::SetStreamingRadii( float loadRadius, float unloadRadius )
+    {
+        EE_ASSERT( loadRadius >= 0.0f && unloadRadius >= loadRadius );
+        m_loadRadius = loadRadius;
+        m_unloadRadius = unloadRadius;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void MapStreamingSystem::GatherSourcePositions( EntityWorldUpdateContext const& ctx )
+    {
+        m_sourcePositions.clear();
+
+        if ( m_useCamerasAsSources )
+        {
+            auto pCameraManager = ctx.GetWorldSystem<CameraManager>();
+            CameraComponent const* pActiveCamera = pCameraManager->GetActiveCamera();
+            if ( pActiveCamera != nullptr && pActiveCamera->IsInitialized() )
+            {
+                m_sourcePositions.emplace_back( pActiveCamera->GetPosition() );
+            }
+
+            // The player camera keeps the player's surroundings streamed in, even while a different camera is active
+            auto pPlayerManager = ctx.GetWorldSystem<PlayerManager>();
+            CameraComponent const* pPlayerCamera = pPlayerManager->GetPlayerCamera();
+            if ( pPlayerCamera != nullptr && pPlayerCamera != pActiveCamera && pPlayerCamera->IsInitialized() )
+            {
+                m_sourcePositions.emplace_back( pPlayerCamera->GetPosition() );
+            }
+        }
+
+        for ( auto const& source : m_sources )
+        {
+            m_sourcePositions.emplace_back( source.m_position );
+        }
+    }
+
+    Resource::ResourcePriority MapStreamingSystem::GetCellPriority( float distance ) const
+    {
+        if ( distance <= 0.0f )
+        {
+            return Resource::ResourcePriority::High;
+        }
+
+        if ( distance <= m_loadRadius / 2 )
+        {
+            return Resource::ResourcePriority::Normal;
+        }
+
+        return Resource::ResourcePriority::Low;
+    }
+
+    void MapStreamingSystem::UpdateSystem( EntityWorldUpdateContext const& ctx )
+    {
+        // Unload removed cells
+        //-------------------------------------------------------------------------
+
+        for ( auto const& mapResourceID : m_cellsToUnload )
+        {
+            ctx.RequestMapUnload( mapResourceID );
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_numUnloadRequests++;
+            #endif
+        }
+        m_cellsToUnload.clear();
+
+        // Without any sources, we dont know what is needed so we leave the current state as is
+        //-------------------------------------------------------------------------
+
+        GatherSourcePositions( ctx );
+
+        if ( m_sourcePositions.empty() )
+        {
+            return;
+        }
+
+        // Update cell distances and unload any cells outside the unload radius
+        //-------------------------------------------------------------------------
+
+        m_cellsToLoad.clear();
+
+        for ( int32_t i = 0; i < (int32_t) m_cells.size(); i++ )
+        {
+            auto& cell = m_cells[i];
+
+            cell.m_distance = FLT_MAX;
+            for ( auto const& sourcePosition : m_sourcePositions )
+            {
+                cell.m_distance = Math::Min( cell.m_distance, GetDistanceToBounds( sourcePosition, cell.m_bounds ) );
+            }
+
+            Resource::ResourcePriority const priority = GetCellPriority( cell.m_distance );
+
+            // Unload failed maps so that the cell can be re-requested once the retry delay has elapsed
+            if ( cell.m_isLoadRequested && ctx.HasMapLoadingFailed( cell.m_mapResourceID ) )
+            {
+                EE_LOG_WARNING( "Entity", "Map Streaming", "Failed to load cell map: %s, retrying in %.0fs", cell.m_mapResourceID.c_str(), s_failedLoadRetryDelay );
+                ctx.RequestMapUnload( cell.m_mapResourceID );
+                cell.m_isLoadRequested = false;
+                cell.m_loadRetryDelay = s_failedLoadRetryDelay;
+
+                #if EE_DEVELOPMENT_TOOLS
+                m_numUnloadRequests++;
+                #endif
+            }
+
+            if ( cell.m_loadRetryDelay > 0.0f )
+            {
+                cell.m_loadRetryDelay = Math::Max( cell.m_loadRetryDelay.ToFloat() - ctx.GetDeltaTime().ToFloat(), 0.0f );
+                continue;
+            }
+
+            if ( cell.m_isLoadRequested )
+            {
+                if ( cell.m_distance > m_unloadRadius )
+                {
+                    ctx.RequestMapUnload( cell.m_mapResourceID );
+                    cell.m_isLoadRequested = false;
+
+                    #if EE_DEVELOPMENT_TOOLS
+                    m_numUnloadRequests++;
+                    #endif
+                }
+                // Re-requesting the load of a loaded map only updates its priority for any future entity loads
+                else if ( priority != cell.m_priority )
+                {
+                    ctx.RequestMapLoad( cell.m_mapResourceID, priority );
+                    cell.m_priority = priority;
+                }
+            }
+            else if ( cell.m_distance <= m_loadRadius )
+            {
+                m_cellsToLoad.emplace_back( i );
+            }
+        }
+
+        // Request the nearest cells first
+        //-------------------------------------------------------------------------
+
+        auto SortPredicate = [this] ( int32_t const& a, int32_t const& b )
+        {
+            return m_cells[a].m_distance < m_cells[b].m_distance;
+        };
+
+        eastl::sort( m_cellsToLoad.begin(), m_cellsToLoad.end(), SortPredicate );
+
+        int32_t const numCellsToLoad = Math::Min( (int32_t) m_cellsToLoad.size(), m_maxLoadRequestsPerUpdate );
+        for ( int32_t i = 0; i < numCellsToLoad; i++ )
+        {
+            auto& cell = m_cells[m_cellsToLoad[i]];
+            cell.m_priority = GetCellPriority( cell.m_distance );
+            ctx.RequestMapLoad( cell.m_mapResourceID, cell.m_priority );
+            cell.m_isLoadRequested = true;
+
+            #if EE_DEVELOPMENT_TOOLS
+            m_numLoadRequests++;
+            #endif
+        }
+    }
+}
\ No newline at end of file
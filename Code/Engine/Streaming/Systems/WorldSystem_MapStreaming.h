@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Engine/_Module/API.h"
+#include "Engine/Entity/EntityWorldSystem.h"
+#include "Engine/Camera/Components/Component_Camera.h"
+#include "System/Resource/ResourceID.h"
+#include "System/Resource/ResourcePriority.h"
+#include "System/Math/BoundingVolumes.h"
+#include "System/Time/Time.h"
+
+//-------------------------------------------------------------------------
+// Map Streaming World System
+//-------------------------------------------------------------------------
+// Streams a set of map cells in and out of the world based on their distance to a set of streaming sources
+// The active camera and the player camera are always used as sources (when enabled), additional sources can be added manually
+// Cells are loaded once within the load radius and only unloaded once outside the (larger) unload radius, to prevent thrashing at cell boundaries
+// Cells whose map fails to load are unloaded and their load is retried after a delay
+// Cell resources are requested with a priority based on their distance: cells containing a source are high priority and distant cells are low priority
+// All map requests are deferred to the world's loading update, use the world entity initialization budget to spread the entity work across frames
+// Note: the budget only covers entity loading and initialization, creating a cell's entities and unloading a cell are always done within a single frame
+
+namespace EE
+{
+    class EE_ENGINE_API MapStreamingSystem : public IEntityWorldSystem
+    {
+        friend class MapStreamingDebugView;
+
+        struct StreamingCell
+        {
+            StreamingCell( ResourceID const& mapResourceID, AABB const& bounds ) : m_mapResourceID( mapResourceID ), m_bounds( bounds ) {}
+
+            ResourceID                                  m_mapResourceID;
+            AABB                                        m_bounds;
+            float                                       m_distance = FLT_MAX;
+            Resource::ResourcePriority                  m_priority = Resource::ResourcePriority::Normal;
+            Seconds                                     m_loadRetryDelay = 0.0f;
+            bool                                        m_isLoadRequested = false;
+        };
+
+        struct StreamingSource
+        {
+            StreamingSource( uint32_t ID, Vector const& position ) : m_ID( ID ), m_position( position ) {}
+
+            uint32_t                                    m_ID;
+            Vector                                      m_position;
+        };
+
+        // How long to wait before re-requesting a cell whose map failed to load
+        constexpr static float const s_failedLoadRetryDelay = 5.0f;
+
+    public:
+
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( MapStreamingSystem, RequiresUpdate( UpdateStage::FrameEnd ), ReadsData<CameraComponent>() );
+
+    public:
+
+        // Cells
+        //-------------------------------------------------------------------------
+        // Not threadsafe, only modify the cells from the main thread or from this world's updates
+
+        // Adding a cell that already exists only updates its bounds
+        void AddCell( ResourceID const& mapResourceID, AABB const& bounds );
+
+        // Removing a cell will unload its map if it was streamed in
+        void RemoveCell( ResourceID const& mapResourceID );
+        void RemoveAllCells();
+
+        // Adds a grid of cells starting at the origin, the map path format is expected to take the x and y cell indices (e.g. "data://maps/world/cell_%d_%d.map")
+        // Any cells of the grid that already exist are kept and moved to their new grid bounds
+        void AddCellGrid( char const* pMapPathFormat, Vector const& origin, float cellSize, float cellHeight, int32_t numCellsX, int32_t numCellsY );
+
+        inline int32_t GetNumCells() const { return (int32_t) m_cells.size(); }
+        bool IsCellLoadRequested( ResourceID const& mapResourceID ) const;
+
+        // Sources
+        //-------------------------------------------------------------------------
+
+        inline bool AreCamerasUsedAsSources() const { return m_useCamerasAsSources; }
+        inline void SetCamerasUsedAsSources( bool useCameras ) { m_useCamerasAsSources = useCameras; }
+
+        // Returns the ID of the newly added source
+        uint32_t AddSource( Vector const& position );
+        void SetSourcePosition( uint32_t sourceID, Vector const& position );
+        void RemoveSource( uint32_t sourceID );
+
+        // Settings
+        //-------------------------------------------------------------------------
+
+        inline float GetLoadRadius() const { return m_loadRadius; }
+        inline float GetUnloadRadius() const { return m_unloadRadius; }
+
+        // The unload radius needs to be at least as large as the load radius
+        void SetStreamingRadii( float loadRadius, float unloadRadius );
+
+        // How many new cells can be requested per update, the nearest cells are always requested first
+        inline int32_t GetMaxLoadRequestsPerUpdate() const { return m_maxLoadRequestsPerUpdate; }
+        inline void SetMaxLoadRequestsPerUpdate( int32_t maxRequests ) { EE_ASSERT( maxRequests > 0 ); m_maxLoadRequestsPerUpdate = maxRequests; }
+
+    private:
+
+        virtual void ShutdownSystem() override final;
+        virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final {}
+        virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final {}
+        virtual bool IsWorldLocal() const override { return true; }
+        virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
+
+        void GatherSourcePositions( EntityWorldUpdateContext const& ctx );
+
+        Resource::ResourcePriority GetCellPriority( float distance ) const;
+
+    private:
+
+        TVector<StreamingCell>                          m_cells;
+        TVector<ResourceID>                             m_cellsToUnload;
+        TVector<StreamingSource>                        m_sources;
+        uint32_t                                        m_nextSourceID = 0;
+        float                                           m_loadRadius = 150.0f;
+        float                                           m_unloadRadius = 200.0f;
+        int32_t                                         m_maxLoadRequestsPerUpdate = 2;
+        bool                                            m_useCamerasAsSources = true;
+
+        // Transient update data
+        TInlineVector<Vector, 4>                        m_sourcePositions;
+        TVector<int32_t>                                m_cellsToLoad;
+
+        #if EE_DEVELOPMENT_TOOLS
+        uint32_t                                        m_numLoadRequests = 0;
+        uint32_t                                        m_numUnloadRequests = 0;
+        #endif
+    };
+}
\ No newline at end of file
@@ -10,7 +10,7 @@ namespace EE::Animation
     class BoneMaskCompiler : public Resource::Compiler
     {
         EE_REGISTER_TYPE( BoneMaskCompiler );
-        static const int32_t s_version = 1;
+        static const int32_t s_version = 2;
 
     public:
 
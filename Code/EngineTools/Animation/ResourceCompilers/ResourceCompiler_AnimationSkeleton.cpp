@@ -54,6 +54,29 @@ namespace EE::Animation
             skeleton.m_localReferencePose.push_back( Transform( boneData.m_localTransform.GetRotation(), boneData.m_localTransform.GetTranslation(), boneData.m_localTransform.GetScale() ) );
         }
 
+        // LODs
+        //-------------------------------------------------------------------------
+
+        skeleton.m_LODs.emplace_back( Skeleton::LOD{ numBones, 0.0f } );
+
+        for ( auto const& lodSettings : resourceDescriptor.m_LODs )
+        {
+            Skeleton::LOD const& previousLOD = skeleton.m_LODs.back();
+            int32_t const lodIdx = (int32_t) skeleton.m_LODs.size();
+
+            if ( lodSettings.m_numBones <= 0 || lodSettings.m_numBones > previousLOD.m_numBones )
+            {
+                return Error( "Invalid bone count (%d) for LOD %d, LODs need at least one bone and cannot have more bones than the previous LOD (%d)", lodSettings.m_numBones, lodIdx, previousLOD.m_numBones );
+            }
+
+            if ( lodSettings.m_minDistance <= previousLOD.m_minDistance )
+            {
+                return Error( "Invalid distance (%.2f) for LOD %d, LOD distances need to be larger than the previous LOD (%.2f)", lodSettings.m_minDistance, lodIdx, previousLOD.m_minDistance );
+            }
+
+            skeleton.m_LODs.emplace_back( Skeleton::LOD{ lodSettings.m_numBones, lodSettings.m_minDistance } );
+        }
+
         // Serialize skeleton
         //-------------------------------------------------------------------------
 
@@ -9,6 +9,16 @@
 
 namespace EE::Animation
 {
+    struct EE_ENGINETOOLS_API SkeletonLODSettings : public IRegisteredType
+    {
+        EE_REGISTER_TYPE( SkeletonLODSettings );
+
+        EE_EXPOSE int32_t                                  m_numBones = 0; // The number of bones (in depth sorted order) to update for this LOD
+        EE_EXPOSE float                                    m_minDistance = 10.0f; // The distance from the viewer at which this LOD becomes active
+    };
+
+    //-------------------------------------------------------------------------
+
     struct EE_ENGINETOOLS_API SkeletonResourceDescriptor final : public Resource::ResourceDescriptor
     {
         EE_REGISTER_TYPE( SkeletonResourceDescriptor );
@@ -32,6 +42,10 @@ namespace EE::Animation
         // Optional value that specifies the name of the skeleton hierarchy to use, if it is unset, we use the first skeleton we find
         EE_EXPOSE String                                   m_skeletonRootBoneName;
 
+        // Optional LODs, LOD 0 always contains all bones so these are the additional lower detail LODs (ordered by increasing distance and decreasing bone count)
+        // Bones are sorted by their hierarchy depth, so a bone count selects all bones up to a given depth level
+        EE_EXPOSE TVector<SkeletonLODSettings>             m_LODs;
+
         // Editor-only preview mesh
         EE_EXPOSE TResourcePtr<Render::SkeletalMesh>       m_previewMesh;
     };
@@ -9,6 +9,8 @@
 #include "Engine/UpdateContext.h"
 #include "Engine/Animation/AnimationPose.h"
 #include "System/Math/MathStringHelpers.h"
+#include "System/Time/Timers.h"
+#include "System/Log.h"
 #include "EngineTools/ThirdParty/pfd/portable-file-dialogs.h"
 
 //-------------------------------------------------------------------------
@@ -341,6 +343,21 @@ namespace EE::Animation
             ImGui::Checkbox( "Root Motion Enabled", &m_isRootMotionEnabled );
             ImGui::Checkbox( "Draw Bone Pose", &m_isPoseDrawingEnabled );
 
+            ImGui::Separator();
+
+            ImGui::BeginDisabled( !IsResourceLoaded() );
+            if ( ImGui::MenuItem( "Benchmark Pose Sampling" ) )
+            {
+                RunPoseSamplingBenchmark();
+            }
+            ImGui::EndDisabled();
+
+            if ( m_hasBenchmarkResults )
+            {
+                ImGui::Text( "Batched: %.3fms, Per-Track: %.3fms (%.2fx)", m_benchmarkBatchedTime.ToFloat(), m_benchmarkUnbatchedTime.ToFloat(), m_benchmarkUnbatchedTime.ToFloat() / m_benchmarkBatchedTime.ToFloat() );
+                ImGui::Text( "Max Error: %f", m_benchmarkMaxError );
+            }
+
             ImGui::EndMenu();
         }
 
@@ -367,6 +384,76 @@ namespace EE::Animation
         }
     }
 
+    void AnimationClipWorkspace::RunPoseSamplingBenchmark()
+    {
+        EE_ASSERT( IsResourceLoaded() );
+
+        constexpr static int32_t const numSamples = 256;
+        constexpr static int32_t const numIterations = 64;
+
+        AnimationClip const* pClip = m_workspaceResource.GetPtr();
+        Pose batchedPose( pClip->GetSkeleton() );
+        Pose unbatchedPose( pClip->GetSkeleton() );
+
+        // Use a fixed set of sample times that includes both exact and interpolated key-frames
+        TVector<FrameTime> sampleTimes;
+        sampleTimes.reserve( numSamples );
+        for ( int32_t i = 0; i < numSamples; i++ )
+        {
+            sampleTimes.emplace_back( pClip->GetFrameTime( Percentage( float( i ) / ( numSamples - 1 ) ) ) );
+        }
+
+        // Time both paths
+        //-------------------------------------------------------------------------
+
+        {
+            ScopedTimer<PlatformClock> timer( m_benchmarkUnbatchedTime );
+            for ( int32_t iteration = 0; iteration < numIterations; iteration++ )
+            {
+                for ( FrameTime const& frameTime : sampleTimes )
+                {
+                    pClip->GetPoseUnbatched( frameTime, &unbatchedPose );
+                }
+            }
+        }
+
+        {
+            ScopedTimer<PlatformClock> timer( m_benchmarkBatchedTime );
+            for ( int32_t iteration = 0; iteration < numIterations; iteration++ )
+            {
+                for ( FrameTime const& frameTime : sampleTimes )
+                {
+                    pClip->GetPose( frameTime, &batchedPose );
+                }
+            }
+        }
+
+        // Validate that both paths produce the same results
+        //-------------------------------------------------------------------------
+
+        m_benchmarkMaxError = 0.0f;
+        for ( FrameTime const& frameTime : sampleTimes )
+        {
+            pClip->GetPoseUnbatched( frameTime, &unbatchedPose );
+            pClip->GetPose( frameTime, &batchedPose );
+
+            for ( int32_t boneIdx = 0; boneIdx < pClip->GetNumBones(); boneIdx++ )
+            {
+                Transform const& expected = unbatchedPose.GetTransform( boneIdx );
+                Transform const& actual = batchedPose.GetTransform( boneIdx );
+
+                float const rotationError = ( Vector( expected.GetRotation().m_data ) - Vector( actual.GetRotation().m_data ) ).GetLength4();
+                float const translationError = ( expected.GetTranslation() - actual.GetTranslation() ).GetLength3();
+                float const scaleError = Math::Abs( expected.GetScale() - actual.GetScale() );
+                m_benchmarkMaxError = Math::Max( m_benchmarkMaxError, Math::Max( rotationError, Math::Max( translationError, scaleError ) ) );
+            }
+        }
+
+        m_hasBenchmarkResults = true;
+
+        EE_LOG_MESSAGE( "Animation", "Pose Sampling Benchmark", "%s - %d poses, %d bones. Batched: %.3fms, Per-Track: %.3fms, Max Error: %f", m_workspaceResource.GetResourceID().c_str(), numSamples * numIterations, pClip->GetNumBones(), m_benchmarkBatchedTime.ToFloat(), m_benchmarkUnbatchedTime.ToFloat(), m_benchmarkMaxError );
+    }
+
     void AnimationClipWorkspace::DrawTimelineWindow( UpdateContext const& context, ImGuiWindowClass* pWindowClass )
     {
         // Draw timeline window
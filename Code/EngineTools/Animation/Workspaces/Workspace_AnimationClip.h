@@ -57,6 +57,9 @@ namespace EE::Animation
         void CreatePreviewMeshComponent();
         void DestroyPreviewMeshComponent();
 
+        // Compare the batched pose sampling against the per-track reference path
+        void RunPoseSamplingBenchmark();
+
     private:
 
         String                          m_timelineWindowName;
@@ -80,5 +83,10 @@ namespace EE::Animation
         bool                            m_isRootMotionEnabled = true;
         bool                            m_isPoseDrawingEnabled = true;
         bool                            m_characterPoseUpdateRequested = false;
+
+        Milliseconds                    m_benchmarkBatchedTime = 0.0f;
+        Milliseconds                    m_benchmarkUnbatchedTime = 0.0f;
+        float                           m_benchmarkMaxError = 0.0f;
+        bool                            m_hasBenchmarkResults = false;
     };
 }
\ No newline at end of file
@@ -128,6 +128,11 @@ namespace EE::RawAssets
         {
             pRawSkeleton = nullptr;
         }
+        else
+        {
+            // All animation resources read their skeleton through here, so this guarantees a consistent depth sorted bone order (needed for skeleton LODs)
+            pRawSkeleton->SortBonesByHierarchyDepth();
+        }
 
         //-------------------------------------------------------------------------
 
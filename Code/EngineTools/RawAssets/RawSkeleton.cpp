@@ -1,4 +1,5 @@
 #include "RawSkeleton.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
@@ -53,4 +54,56 @@ namespace EE::RawAssets
             m_bones[i].m_globalTransform = m_bones[i].m_localTransform * m_bones[parentIdx].m_globalTransform;
         }
     }
+
+    //-------------------------------------------------------------------------
+
+    void RawSkeleton::SortBonesByHierarchyDepth()
+    {
+        EE_ASSERT( !m_bones.empty() );
+
+        // Calculate bone depths - parents are always listed before their children
+        //-------------------------------------------------------------------------
+
+        int32_t const numBones = (int32_t) m_bones.size();
+        TVector<int32_t> boneDepths( numBones, 0 );
+        for ( auto i = 1; i < numBones; i++ )
+        {
+            int32_t const parentIdx = m_bones[i].m_parentBoneIdx;
+            EE_ASSERT( parentIdx != InvalidIndex && parentIdx < i );
+            boneDepths[i] = boneDepths[parentIdx] + 1;
+        }
+
+        // Sort bones - a stable sort ensures that the order within each level is unchanged
+        //-------------------------------------------------------------------------
+
+        TVector<int32_t> sortedIndices( numBones );
+        for ( auto i = 0; i < numBones; i++ )
+        {
+            sortedIndices[i] = i;
+        }
+
+        eastl::stable_sort( sortedIndices.begin(), sortedIndices.end(), [&boneDepths] ( int32_t a, int32_t b ) { return boneDepths[a] < boneDepths[b]; } );
+
+        TVector<int32_t> remappedIndices( numBones );
+        for ( auto i = 0; i < numBones; i++ )
+        {
+            remappedIndices[sortedIndices[i]] = i;
+        }
+
+        // Rebuild the bone list and update the parent indices
+        //-------------------------------------------------------------------------
+
+        TVector<BoneData> sortedBones;
+        sortedBones.reserve( numBones );
+        for ( auto i = 0; i < numBones; i++ )
+        {
+            BoneData& bone = sortedBones.emplace_back( m_bones[sortedIndices[i]] );
+            if ( bone.m_parentBoneIdx != InvalidIndex )
+            {
+                bone.m_parentBoneIdx = remappedIndices[bone.m_parentBoneIdx];
+            }
+        }
+
+        m_bones.swap( sortedBones );
+    }
 }
\ No newline at end of file
@@ -47,6 +47,10 @@ namespace EE::RawAssets
         inline Transform const& GetLocalTransform( int32_t boneIdx ) const { EE_ASSERT( boneIdx >= 0 && boneIdx < m_bones.size() ); return m_bones[boneIdx].m_localTransform; }
         inline Transform const& GetGlobalTransform( int32_t boneIdx ) const { EE_ASSERT( boneIdx >= 0 && boneIdx < m_bones.size() ); return m_bones[boneIdx].m_globalTransform; }
 
+        // Reorder the bones so that they are sorted by their depth in the hierarchy (i.e. all bones of a given depth are listed before any bones of a greater depth)
+        // The relative order of the bones within each level is preserved. Any prefix of the sorted bone list is a valid sub-hierarchy which is what allows for bone-count based LODs.
+        void SortBonesByHierarchyDepth();
+
     protected:
 
         void CalculateLocalTransforms();
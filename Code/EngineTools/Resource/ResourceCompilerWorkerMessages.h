@@ -0,0 +1,63 @@
+#pragma once
+#include "System/Resource/ResourceID.h"
+#include "System/Serialization/BinarySerialization.h"
+
+//-------------------------------------------------------------------------
+// Resource compiler worker messages
+//-------------------------------------------------------------------------
+// Messages exchanged between the resource server and its persistent resource compiler worker processes
+
+namespace EE::Resource
+{
+    enum class CompilerWorkerMessageID
+    {
+        WorkerReady = 100,
+        CompileRequest = 101,
+        CompileResult = 102,
+        Shutdown = 103,
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Sent by a worker once it has connected and is ready to compile
+    struct CompilerWorkerReady
+    {
+        EE_SERIALIZE( m_workerIdx );
+
+        CompilerWorkerReady() = default;
+
+        CompilerWorkerReady( int32_t workerIdx )
+            : m_workerIdx( workerIdx )
+        {}
+
+        int32_t                 m_workerIdx = InvalidIndex;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct CompilerWorkerRequest
+    {
+        EE_SERIALIZE( m_resourceID, m_isForPackagedBuild );
+
+        CompilerWorkerRequest() = default;
+
+        CompilerWorkerRequest( ResourceID const& resourceID, bool isForPackagedBuild )
+            : m_resourceID( resourceID )
+            , m_isForPackagedBuild( isForPackagedBuild )
+        {}
+
+        ResourceID              m_resourceID;
+        bool                    m_isForPackagedBuild = false;
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct CompilerWorkerResult
+    {
+        EE_SERIALIZE( m_resourceID, m_result, m_log );
+
+        ResourceID              m_resourceID;
+        int32_t                 m_result = -1;      // Same values as the compiler process exit code
+        String                  m_log;
+    };
+}
\ No newline at end of file
@@ -143,6 +143,8 @@ namespace EE::AI
         }
         else if ( updateStage == UpdateStage::PostPhysics )
         {
+            // The post-physics pose tasks read the simulation results (e.g. ragdoll poses)
+            ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->CompleteSimulation();
             m_pAnimGraphComponent->ExecutePostPhysicsTasks();
         }
         else
@@ -5,6 +5,20 @@
 
 namespace EE
 {
+    TEvent<CoverVolumeComponent*> CoverVolumeComponent::s_transformUpdatedEvent;
+
+    //-------------------------------------------------------------------------
+
+    void CoverVolumeComponent::OnWorldTransformUpdated()
+    {
+        if ( IsInitialized() )
+        {
+            s_transformUpdatedEvent.Execute( this );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     #if EE_DEVELOPMENT_TOOLS
     void CoverVolumeComponent::Draw( Drawing::DrawContext& drawingCtx ) const
     {
@@ -2,6 +2,7 @@
 
 #include "Game/_Module/API.h"
 #include "Engine/Volumes/Components/Component_Volumes.h"
+#include "System/Types/Event.h"
 
 //-------------------------------------------------------------------------
 
@@ -27,16 +28,28 @@ namespace EE
     {
         EE_REGISTER_ENTITY_COMPONENT( CoverVolumeComponent );
 
+        static TEvent<CoverVolumeComponent*> s_transformUpdatedEvent; // Fired whenever an initialized volume is moved
+
+    public:
+
+        inline static TEventHandle<CoverVolumeComponent*> OnTransformUpdated() { return s_transformUpdatedEvent; }
+
     public:
 
         inline CoverVolumeComponent() = default;
         inline CoverVolumeComponent( StringID name ) : BoxVolumeComponent( name ) {}
 
+        inline CoverType GetCoverType() const { return m_coverType; }
+
         #if EE_DEVELOPMENT_TOOLS
         virtual Color GetVolumeColor() const override { return Colors::GreenYellow; }
         virtual void Draw( Drawing::DrawContext& drawingCtx ) const override;
         #endif
 
+    private:
+
+        virtual void OnWorldTransformUpdated() override final;
+
     private:
 
         EE_EXPOSE CoverType    m_coverType = CoverType::HighHidden;
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Game/Cover/Components/Component_CoverVolume.h"
+#include "System/Math/Vector.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    //-------------------------------------------------------------------------
+    // A single position an agent can take cover at
+    //-------------------------------------------------------------------------
+    // Cover points are sampled along the width of each cover volume when the volume is registered with the cover manager
+    // The cover direction is the (planar) direction the cover protects against, i.e. threats should be in front of it
+
+    struct CoverPoint
+    {
+        Vector                  m_position;
+        Vector                  m_coverDirection;
+        ComponentID             m_volumeID;
+        CoverType               m_coverType = CoverType::HighHidden;
+    };
+
+    //-------------------------------------------------------------------------
+    // Cover Query
+    //-------------------------------------------------------------------------
+    // Finds all the cover points within a radius, sorted by distance (nearest first)
+    // Set the max number of results to only get the k-nearest points
+    // Set a threat position to only get points that provide cover from that threat
+
+    struct CoverQuery
+    {
+        CoverQuery() = default;
+        CoverQuery( Vector const& position, float radius, int32_t maxResults = 0 ) : m_position( position ), m_radius( radius ), m_maxResults( maxResults ) {}
+
+        inline bool HasThreat() const { return m_hasThreat; }
+
+        // The min alignment is the min dot product between the cover direction and the direction to the threat, i.e. 0.7 ~= at most 45 degrees off
+        inline void SetThreat( Vector const& threatPosition, float minAlignment = 0.7f )
+        {
+            EE_ASSERT( minAlignment >= -1.0f && minAlignment <= 1.0f );
+            m_threatPosition = threatPosition;
+            m_minThreatAlignment = minAlignment;
+            m_hasThreat = true;
+        }
+
+        inline void ClearThreat() { m_hasThreat = false; }
+
+    public:
+
+        Vector                  m_position;
+        Vector                  m_threatPosition;
+        float                   m_radius = 10.0f;
+        float                   m_minThreatAlignment = 0.7f;
+        int32_t                 m_maxResults = 0;                   // Zero means no limit
+        bool                    m_hasThreat = false;
+    };
+}
\ No newline at end of file
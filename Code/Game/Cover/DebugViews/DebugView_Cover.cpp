@@ -4,6 +4,8 @@
 #include "Engine/Entity/EntitySystem.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/UpdateContext.h"
+#include "System/Render/RenderViewport.h"
+#include "System/Drawing/DebugDrawing.h"
 #include "System/Imgui/ImguiX.h"
 
 //-------------------------------------------------------------------------
@@ -37,16 +39,106 @@ namespace EE
             if ( pWindowClass != nullptr ) ImGui::SetNextWindowClass( pWindowClass );
             DrawOverviewWindow( context );
         }
+
+        if ( m_drawCoverPoints )
+        {
+            DrawCoverPoints( context );
+        }
+
+        if ( m_isTestQueryEnabled )
+        {
+            DrawTestQuery( context );
+        }
     }
 
     void CoverDebugView::DrawMenu( EntityWorldUpdateContext const& context )
     {
-       
+        ImGui::Text( "Num Volumes: %d, Num Points: %d", m_pCoverManager->m_coverVolumes.size(), m_pCoverManager->GetNumCoverPoints() );
+
+        if ( ImGui::MenuItem( "Overview" ) )
+        {
+            m_isOverviewWindowOpen = true;
+        }
+
+        ImGui::Checkbox( "Draw Cover Points", &m_drawCoverPoints );
+        ImGui::Checkbox( "Run Test Query", &m_isTestQueryEnabled );
     }
 
     void CoverDebugView::DrawOverviewWindow( EntityWorldUpdateContext const& context )
     {
-       
+        if ( ImGui::Begin( "Cover Overview", &m_isOverviewWindowOpen ) )
+        {
+            ImGui::Text( "Num Volumes: %d", m_pCoverManager->m_coverVolumes.size() );
+            ImGui::Text( "Num Points: %d", m_pCoverManager->GetNumCoverPoints() );
+            ImGui::Text( "Num Free Point Slots: %d", (int32_t) m_pCoverManager->m_freeCoverPointIndices.size() );
+
+            ImGui::Separator();
+
+            ImGui::Checkbox( "Run Test Query", &m_isTestQueryEnabled );
+            ImGui::SliderFloat( "Radius", &m_testQueryRadius, 1.0f, 100.0f );
+            ImGui::SliderInt( "Max Results (0 = All)", &m_testQueryMaxResults, 0, 50 );
+            ImGui::Checkbox( "Use Threat In Front Of Camera", &m_testQueryUseThreat );
+            ImGui::SliderFloat( "Threat Distance", &m_testQueryThreatDistance, 1.0f, 100.0f );
+
+            if ( m_isTestQueryEnabled )
+            {
+                ImGui::Text( "Num Results: %d", (int32_t) m_testQueryResults.size() );
+            }
+        }
+        ImGui::End();
+    }
+
+    void CoverDebugView::DrawCoverPoints( EntityWorldUpdateContext const& context ) const
+    {
+        auto drawingContext = context.GetDrawingContext();
+
+        for ( auto const& volumePoints : m_pCoverManager->m_volumeCoverPoints )
+        {
+            for ( int32_t pointIdx : volumePoints.second )
+            {
+                CoverPoint const& point = m_pCoverManager->m_coverPoints[pointIdx];
+                drawingContext.DrawPoint( point.m_position, Colors::Yellow, 10.0f );
+                drawingContext.DrawArrow( point.m_position, point.m_position + point.m_coverDirection * 0.5f, Colors::Yellow, 2.0f );
+            }
+        }
+    }
+
+    void CoverDebugView::DrawTestQuery( EntityWorldUpdateContext const& context )
+    {
+        Render::Viewport const* pViewport = context.GetViewport();
+        if ( pViewport == nullptr )
+        {
+            return;
+        }
+
+        Vector const viewPosition = pViewport->GetViewPosition();
+        CoverQuery query( viewPosition, m_testQueryRadius, m_testQueryMaxResults );
+
+        Vector threatPosition;
+        if ( m_testQueryUseThreat )
+        {
+            threatPosition = viewPosition + pViewport->GetViewForwardDirection().Get2D().GetNormalized2() * m_testQueryThreatDistance;
+            query.SetThreat( threatPosition );
+        }
+
+        m_pCoverManager->FindCover( query, m_testQueryResults );
+
+        //-------------------------------------------------------------------------
+
+        auto drawingContext = context.GetDrawingContext();
+
+        if ( m_testQueryUseThreat )
+        {
+            drawingContext.DrawSphere( threatPosition, 0.5f, Colors::Red, 2.0f );
+        }
+
+        for ( int32_t i = 0; i < (int32_t) m_testQueryResults.size(); i++ )
+        {
+            CoverPoint const& point = m_testQueryResults[i];
+            Color const color = ( i == 0 ) ? Colors::Lime : Colors::Green;
+            drawingContext.DrawPoint( point.m_position, color, 15.0f );
+            drawingContext.DrawArrow( point.m_position, point.m_position + point.m_coverDirection, color, 3.0f );
+        }
     }
 }
 #endif
\ No newline at end of file
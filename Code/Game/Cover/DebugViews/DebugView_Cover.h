@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Entity/EntityWorldDebugView.h"
+#include "Game/Cover/CoverPoint.h"
 
 //-------------------------------------------------------------------------
 
@@ -27,12 +28,23 @@ namespace EE
 
         void DrawMenu( EntityWorldUpdateContext const& context );
         void DrawOverviewWindow( EntityWorldUpdateContext const& context );
+        void DrawCoverPoints( EntityWorldUpdateContext const& context ) const;
+        void DrawTestQuery( EntityWorldUpdateContext const& context );
 
     private:
 
         EntityWorld const*              m_pWorld = nullptr;
         CoverManager*                   m_pCoverManager = nullptr;
         bool                            m_isOverviewWindowOpen = false;
+        bool                            m_drawCoverPoints = false;
+
+        // Test query - performed from the camera position with an optional threat in front of the camera
+        TVector<CoverPoint>             m_testQueryResults;
+        float                           m_testQueryRadius = 15.0f;
+        float                           m_testQueryThreatDistance = 20.0f;
+        int32_t                         m_testQueryMaxResults = 5;
+        bool                            m_isTestQueryEnabled = false;
+        bool                            m_testQueryUseThreat = true;
     };
 }
 #endif
\ No newline at end of file
@@ -3,14 +3,24 @@
 #include "Engine/Entity/Entity.h"
 #include "Engine/Entity/EntityWorldUpdateContext.h"
 #include "Engine/Entity/EntityMap.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE
 {
+    void CoverManager::InitializeSystem( SystemRegistry const& systemRegistry )
+    {
+        m_volumeTransformUpdatedEventBinding = CoverVolumeComponent::OnTransformUpdated().Bind( [this] ( CoverVolumeComponent* pVolume ) { OnVolumeTransformUpdated( pVolume ); } );
+    }
+
     void CoverManager::ShutdownSystem()
     {
+        CoverVolumeComponent::OnTransformUpdated().Unbind( m_volumeTransformUpdatedEventBinding );
+        m_movedVolumes.clear();
+
         EE_ASSERT( m_coverVolumes.empty() );
+        EE_ASSERT( m_volumeCoverPoints.empty() && m_coverPointTree.IsEmpty() );
     }
 
     void CoverManager::RegisterComponent( Entity const* pEntity, EntityComponent* pComponent )
@@ -18,6 +28,7 @@ namespace EE
         if ( auto pCoverComponent = TryCast<CoverVolumeComponent>( pComponent ) )
         {
             m_coverVolumes.Add( pCoverComponent );
+            CreateCoverPoints( pCoverComponent );
         }
     }
 
@@ -25,13 +36,205 @@ namespace EE
     {
         if ( auto pCoverComponent = TryCast<CoverVolumeComponent>( pComponent ) )
         {
+            DestroyCoverPoints( pCoverComponent->GetID() );
             m_coverVolumes.Remove( pCoverComponent->GetID() );
         }
     }
 
     //-------------------------------------------------------------------------
 
+    void CoverManager::CreateCoverPoints( CoverVolumeComponent const* pVolume )
+    {
+        EE_ASSERT( pVolume != nullptr );
+
+        Transform const& worldTransform = pVolume->GetWorldTransform();
+        Float3 const volumeExtents = pVolume->GetVolumeLocalExtents();
+        Vector const forward = worldTransform.GetForwardVector();
+        Vector const right = worldTransform.GetRightVector();
+        Vector const coverDirection = forward.Get2D().GetNormalized2();
+
+        // The points are placed along the front face of the volume
+        Vector const origin = worldTransform.GetTranslation() + ( forward * volumeExtents.m_y );
+
+        auto& volumePoints = m_volumeCoverPoints[pVolume->GetID()];
+        EE_ASSERT( volumePoints.empty() );
+
+        auto CreatePoint = [&] ( Vector const& position )
+        {
+            int32_t pointIdx = InvalidIndex;
+            if ( !m_freeCoverPointIndices.empty() )
+            {
+                pointIdx = m_freeCoverPointIndices.back();
+                m_freeCoverPointIndices.pop_back();
+            }
+            else
+            {
+                pointIdx = (int32_t) m_coverPoints.size();
+                m_coverPoints.emplace_back();
+            }
+
+            CoverPoint& point = m_coverPoints[pointIdx];
+            point.m_position = position;
+            point.m_coverDirection = coverDirection;
+            point.m_volumeID = pVolume->GetID();
+            point.m_coverType = pVolume->GetCoverType();
+
+            m_coverPointTree.InsertBox( AABB( position ), uint64_t( pointIdx + 1 ) );
+            volumePoints.emplace_back( pointIdx );
+        };
+
+        // Sample points along the width of the volume, this matches the spacing of the arrows drawn by the volume
+        CreatePoint( origin );
+        for ( float horizontalOffset = s_coverPointSpacing; horizontalOffset <= volumeExtents.m_x; horizontalOffset += s_coverPointSpacing )
+        {
+            Vector const rightOffset = right * horizontalOffset;
+            CreatePoint( origin + rightOffset );
+            CreatePoint( origin - rightOffset );
+        }
+    }
+
+    void CoverManager::OnVolumeTransformUpdated( CoverVolumeComponent* pVolume )
+    {
+        EE_ASSERT( pVolume != nullptr && pVolume->IsInitialized() );
+
+        if ( m_coverVolumes.HasItemForID( pVolume->GetID() ) )
+        {
+            Threading::ScopeLock lock( m_movedVolumesLock );
+            if ( !VectorContains( m_movedVolumes, pVolume->GetID() ) )
+            {
+                m_movedVolumes.emplace_back( pVolume->GetID() );
+            }
+        }
+    }
+
+    void CoverManager::DestroyCoverPoints( ComponentID const& volumeID )
+    {
+        auto iter = m_volumeCoverPoints.find( volumeID );
+        EE_ASSERT( iter != m_volumeCoverPoints.end() );
+
+        for ( int32_t pointIdx : iter->second )
+        {
+            m_coverPointTree.RemoveBox( uint64_t( pointIdx + 1 ) );
+            m_coverPoints[pointIdx].m_volumeID.Clear();
+            m_freeCoverPointIndices.emplace_back( pointIdx );
+        }
+
+        m_volumeCoverPoints.erase( iter );
+
+        // Release all memory once all volumes have been removed
+        if ( m_volumeCoverPoints.empty() )
+        {
+            m_coverPoints.clear();
+            m_freeCoverPointIndices.clear();
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    void CoverManager::FindCover( CoverQuery const& query, TVector<CoverPoint>& outResults ) const
+    {
+        EE_ASSERT( query.m_radius > 0.0f && query.m_maxResults >= 0 );
+
+        outResults.clear();
+
+        TVector<uint64_t> candidates;
+        if ( m_coverPointTree.FindOverlaps( AABB( query.m_position, query.m_radius ), candidates ) )
+        {
+            FilterAndSortResults( query, candidates, outResults );
+        }
+    }
+
+    void CoverManager::FindCover( CoverQuery const* pQueries, int32_t numQueries, TVector<TVector<CoverPoint>>& outResults ) const
+    {
+        EE_ASSERT( pQueries != nullptr && numQueries > 0 );
+
+        TInlineVector<AABB, 16> queryBoxes;
+        queryBoxes.reserve( numQueries );
+        for ( int32_t i = 0; i < numQueries; i++ )
+        {
+            EE_ASSERT( pQueries[i].m_radius > 0.0f && pQueries[i].m_maxResults >= 0 );
+            queryBoxes.emplace_back( pQueries[i].m_position, pQueries[i].m_radius );
+        }
+
+        TVector<TVector<uint64_t>> candidates;
+        m_coverPointTree.FindOverlaps( queryBoxes.data(), numQueries, candidates );
+
+        outResults.resize( numQueries );
+        for ( int32_t i = 0; i < numQueries; i++ )
+        {
+            outResults[i].clear();
+            FilterAndSortResults( pQueries[i], candidates[i], outResults[i] );
+        }
+    }
+
+    void CoverManager::FilterAndSortResults( CoverQuery const& query, TVector<uint64_t> const& candidates, TVector<CoverPoint>& outResults ) const
+    {
+        struct Candidate
+        {
+            float       m_distanceSq;
+            int32_t     m_pointIdx;
+        };
+
+        TInlineVector<Candidate, 32> validCandidates;
+
+        // The tree returns everything in the query box, so we need to remove all the points outside the radius
+        float const radiusSq = query.m_radius * query.m_radius;
+        for ( uint64_t userData : candidates )
+        {
+            int32_t const pointIdx = int32_t( userData - 1 );
+            CoverPoint const& point = m_coverPoints[pointIdx];
+
+            float const distanceSq = point.m_position.GetDistanceSquared3( query.m_position );
+            if ( distanceSq > radiusSq )
+            {
+                continue;
+            }
+
+            // Only keep points that are facing the threat
+            if ( query.HasThreat() )
+            {
+                Vector const directionToThreat = ( query.m_threatPosition - point.m_position ).Get2D();
+                if ( directionToThreat.IsNearZero2() || point.m_coverDirection.GetDot2( directionToThreat.GetNormalized2() ) < query.m_minThreatAlignment )
+                {
+                    continue;
+                }
+            }
+
+            validCandidates.push_back( { distanceSq, pointIdx } );
+        }
+
+        //-------------------------------------------------------------------------
+
+        auto SortPredicate = [] ( Candidate const& a, Candidate const& b )
+        {
+            return a.m_distanceSq < b.m_distanceSq;
+        };
+
+        eastl::sort( validCandidates.begin(), validCandidates.end(), SortPredicate );
+
+        int32_t const numResults = ( query.m_maxResults > 0 ) ? Math::Min( query.m_maxResults, (int32_t) validCandidates.size() ) : (int32_t) validCandidates.size();
+        outResults.reserve( numResults );
+        for ( int32_t i = 0; i < numResults; i++ )
+        {
+            outResults.emplace_back( m_coverPoints[validCandidates[i].m_pointIdx] );
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
     void CoverManager::UpdateSystem( EntityWorldUpdateContext const& ctx )
     {
+        // Resample all moved volumes, volumes might have been unregistered since they were moved
+        Threading::ScopeLock lock( m_movedVolumesLock );
+        for ( ComponentID const& volumeID : m_movedVolumes )
+        {
+            if ( m_coverVolumes.HasItemForID( volumeID ) )
+            {
+                DestroyCoverPoints( volumeID );
+                CreateCoverPoints( *m_coverVolumes.Get( volumeID ) );
+            }
+        }
+
+        m_movedVolumes.clear();
     }
 }
\ No newline at end of file
@@ -2,7 +2,11 @@
 
 #include "Game/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Game/Cover/Components/Component_CoverVolume.h"
+#include "Game/Cover/CoverPoint.h"
+#include "System/Math/WideAABBTree.h"
 #include "System/Types/IDVector.h"
+#include "System/Threading/Threading.h"
 
 //-------------------------------------------------------------------------
 
@@ -18,17 +22,53 @@ namespace EE
 
     public:
 
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( CoverManager, RequiresUpdate( UpdateStage::PrePhysics ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( CoverManager, RequiresUpdate( UpdateStage::PrePhysics ), ReadsData<CoverVolumeComponent>() );
+
+        // The spacing between the cover points sampled along a cover volume
+        constexpr static float const s_coverPointSpacing = 1.0f;
+
+    public:
+
+        inline int32_t GetNumCoverPoints() const { return (int32_t) m_coverPoints.size() - (int32_t) m_freeCoverPointIndices.size(); }
+
+        // Queries
+        //-------------------------------------------------------------------------
+        // Cover points are only ever added or removed while loading or when a moved volume is resampled in the pre-physics update
+        // Queries are read-only and can safely be run concurrently by any number of agents, as long as they are not run during the cover manager's update
+
+        void FindCover( CoverQuery const& query, TVector<CoverPoint>& outResults ) const;
+
+        // Run a batch of queries with a single traversal of the cover point tree - there will be one result list per query
+        void FindCover( CoverQuery const* pQueries, int32_t numQueries, TVector<TVector<CoverPoint>>& outResults ) const;
 
     private:
 
+        virtual void InitializeSystem( SystemRegistry const& systemRegistry ) override final;
         virtual void ShutdownSystem() override final;
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override final;
+        virtual bool IsWorldLocal() const override { return true; }
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
+    private:
+
+        void CreateCoverPoints( CoverVolumeComponent const* pVolume );
+        void DestroyCoverPoints( ComponentID const& volumeID );
+        void OnVolumeTransformUpdated( CoverVolumeComponent* pVolume );
+
+        // Filter the raw tree results (encoded point indices) and sort them by distance
+        void FilterAndSortResults( CoverQuery const& query, TVector<uint64_t> const& candidates, TVector<CoverPoint>& outResults ) const;
+
     private:
 
         TIDVector<ComponentID, CoverVolumeComponent*>      m_coverVolumes;
+        TVector<CoverPoint>                                 m_coverPoints;
+        TVector<int32_t>                                    m_freeCoverPointIndices;
+        THashMap<ComponentID, TInlineVector<int32_t, 8>>    m_volumeCoverPoints;        // The cover points created for each volume
+        Math::WideAABBTree                                  m_coverPointTree;           // User data is the cover point index + 1
+
+        EventBindingID                                      m_volumeTransformUpdatedEventBinding;
+        TVector<ComponentID>                                m_movedVolumes;             // Volumes that need to be resampled, transforms can be updated on any thread so this is protected by a lock
+        Threading::Mutex                                    m_movedVolumesLock;
     };
 }
\ No newline at end of file
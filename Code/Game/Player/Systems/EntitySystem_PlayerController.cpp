@@ -203,6 +203,8 @@ namespace EE::Player
         }
         else if ( updateStage == UpdateStage::PostPhysics )
         {
+            // The post-physics pose tasks read the simulation results (e.g. ragdoll poses)
+            ctx.GetWorldSystem<Physics::PhysicsWorldSystem>()->CompleteSimulation();
             m_pAnimGraphComponent->ExecutePostPhysicsTasks();
         }
         else
@@ -2,6 +2,8 @@
 
 #include "Game/_Module/API.h"
 #include "Engine/Entity/EntityWorldSystem.h"
+#include "Game/Player/Components/Component_MainPlayer.h"
+#include "Game/Player/Components/Component_PlayerInteractible.h"
 
 //-------------------------------------------------------------------------
 
@@ -14,7 +16,7 @@ namespace EE::Player
 
     class EE_GAME_API PlayerInteractionSystem final : public IEntityWorldSystem
     {
-        EE_REGISTER_ENTITY_WORLD_SYSTEM( PlayerInteractionSystem, RequiresUpdate( UpdateStage::PrePhysics ) );
+        EE_REGISTER_ENTITY_WORLD_SYSTEM( PlayerInteractionSystem, RequiresUpdate( UpdateStage::PrePhysics ), ReadsData<SpatialEntityComponent, PlayerInteractibleComponent>(), WritesData<MainPlayerComponent>() );
 
         struct RegisteredPlayer
         {
@@ -34,6 +36,7 @@ namespace EE::Player
 
         virtual void RegisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
         virtual void UnregisterComponent( Entity const* pEntity, EntityComponent* pComponent ) override;
+        virtual bool IsWorldLocal() const override { return true; }
         virtual void UpdateSystem( EntityWorldUpdateContext const& ctx ) override;
 
     private:
@@ -0,0 +1,257 @@
+#include "Compression.h"
+#include "System/Math/Math.h"
+#include "System/Types/Arrays.h"
+#include <string.h>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Compression::LZ4
+{
+    constexpr static size_t const g_minMatchLength = 4;
+    constexpr static size_t const g_lastLiteralsLength = 5;     // The last 5 bytes of a block are always literals
+    constexpr static size_t const g_matchFindLimit = 12;        // A match can not start within the last 12 bytes of a block
+    constexpr static size_t const g_maxOffset = 65535;
+    constexpr static uint32_t const g_hashLog = 16;
+
+    //-------------------------------------------------------------------------
+
+    EE_FORCE_INLINE static uint32_t Read32( uint8_t const* pData )
+    {
+        uint32_t value;
+        memcpy( &value, pData, sizeof( uint32_t ) );
+        return value;
+    }
+
+    EE_FORCE_INLINE static uint32_t Hash( uint32_t sequence )
+    {
+        return ( sequence * 2654435761U ) >> ( 32 - g_hashLog );
+    }
+
+    // Writes the remainder of a length that didnt fit in the token nibble
+    EE_FORCE_INLINE static uint8_t* WriteLength( uint8_t* pOutput, size_t length )
+    {
+        while ( length >= 255 )
+        {
+            *pOutput++ = 255;
+            length -= 255;
+        }
+
+        *pOutput++ = (uint8_t) length;
+        return pOutput;
+    }
+
+    // Reads the remainder of a length that didnt fit in the token nibble
+    EE_FORCE_INLINE static bool ReadLength( uint8_t const*& pInput, uint8_t const* pInputEnd, size_t& length )
+    {
+        uint8_t value;
+        do
+        {
+            if ( pInput >= pInputEnd )
+            {
+                return false;
+            }
+
+            value = *pInput++;
+            length += value;
+        } while ( value == 255 );
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+
+    size_t Compress( uint8_t const* pData, size_t dataSize, uint8_t* pCompressedData, size_t compressedDataCapacity )
+    {
+        EE_ASSERT( pData != nullptr && pCompressedData != nullptr );
+
+        uint8_t const* const pInputEnd = pData + dataSize;
+        uint8_t const* pInput = pData;
+        uint8_t const* pAnchor = pData;
+
+        uint8_t* pOutput = pCompressedData;
+        uint8_t* const pOutputEnd = pCompressedData + compressedDataCapacity;
+
+        // Find and emit matches
+        //-------------------------------------------------------------------------
+
+        if ( dataSize > g_matchFindLimit )
+        {
+            TVector<uint32_t> hashTable;
+            hashTable.resize( size_t( 1 ) << g_hashLog, 0 );
+
+            uint8_t const* const pMatchFindLimit = pInputEnd - g_matchFindLimit;
+            uint8_t const* const pMatchLimit = pInputEnd - g_lastLiteralsLength;
+
+            while ( pInput < pMatchFindLimit )
+            {
+                uint32_t const sequence = Read32( pInput );
+                uint32_t const hash = Hash( sequence );
+                uint8_t const* pMatch = pData + hashTable[hash];
+                hashTable[hash] = uint32_t( pInput - pData );
+
+                size_t const offset = size_t( pInput - pMatch );
+                if ( offset == 0 || offset > g_maxOffset || Read32( pMatch ) != sequence )
+                {
+                    pInput++;
+                    continue;
+                }
+
+                // Extend the match backwards into the pending literals
+                while ( pInput > pAnchor && pMatch > pData && pInput[-1] == pMatch[-1] )
+                {
+                    pInput--;
+                    pMatch--;
+                }
+
+                // Extend the match forwards
+                size_t matchLength = g_minMatchLength;
+                while ( pInput + matchLength < pMatchLimit && pInput[matchLength] == pMatch[matchLength] )
+                {
+                    matchLength++;
+                }
+
+                // Emit sequence: token, literals, offset, match length
+                size_t const literalLength = size_t( pInput - pAnchor );
+                size_t const maxSequenceSize = 1 + ( literalLength / 255 + 1 ) + literalLength + 2 + ( matchLength / 255 + 1 );
+                if ( size_t( pOutputEnd - pOutput ) < maxSequenceSize )
+                {
+                    return 0;
+                }
+
+                uint8_t* pToken = pOutput++;
+                size_t const encodedMatchLength = matchLength - g_minMatchLength;
+                *pToken = uint8_t( ( Math::Min( literalLength, size_t( 15 ) ) << 4 ) | Math::Min( encodedMatchLength, size_t( 15 ) ) );
+
+                if ( literalLength >= 15 )
+                {
+                    pOutput = WriteLength( pOutput, literalLength - 15 );
+                }
+
+                memcpy( pOutput, pAnchor, literalLength );
+                pOutput += literalLength;
+
+                *pOutput++ = uint8_t( offset & 0xFF );
+                *pOutput++ = uint8_t( offset >> 8 );
+
+                if ( encodedMatchLength >= 15 )
+                {
+                    pOutput = WriteLength( pOutput, encodedMatchLength - 15 );
+                }
+
+                pInput += matchLength;
+                pAnchor = pInput;
+            }
+        }
+
+        // Emit the trailing literals
+        //-------------------------------------------------------------------------
+
+        size_t const literalLength = size_t( pInputEnd - pAnchor );
+        size_t const maxSequenceSize = 1 + ( literalLength / 255 + 1 ) + literalLength;
+        if ( size_t( pOutputEnd - pOutput ) < maxSequenceSize )
+        {
+            return 0;
+        }
+
+        uint8_t* pToken = pOutput++;
+        *pToken = uint8_t( Math::Min( literalLength, size_t( 15 ) ) << 4 );
+
+        if ( literalLength >= 15 )
+        {
+            pOutput = WriteLength( pOutput, literalLength - 15 );
+        }
+
+        memcpy( pOutput, pAnchor, literalLength );
+        pOutput += literalLength;
+
+        return size_t( pOutput - pCompressedData );
+    }
+
+    bool Decompress( uint8_t const* pCompressedData, size_t compressedDataSize, uint8_t* pData, size_t dataSize )
+    {
+        EE_ASSERT( pCompressedData != nullptr && pData != nullptr );
+
+        uint8_t const* pInput = pCompressedData;
+        uint8_t const* const pInputEnd = pCompressedData + compressedDataSize;
+
+        uint8_t* pOutput = pData;
+        uint8_t* const pOutputEnd = pData + dataSize;
+
+        while ( true )
+        {
+            if ( pInput >= pInputEnd )
+            {
+                return false;
+            }
+
+            uint8_t const token = *pInput++;
+
+            // Literals
+            //-------------------------------------------------------------------------
+
+            size_t literalLength = token >> 4;
+            if ( literalLength == 15 && !ReadLength( pInput, pInputEnd, literalLength ) )
+            {
+                return false;
+            }
+
+            if ( literalLength > size_t( pInputEnd - pInput ) || literalLength > size_t( pOutputEnd - pOutput ) )
+            {
+                return false;
+            }
+
+            memcpy( pOutput, pInput, literalLength );
+            pInput += literalLength;
+            pOutput += literalLength;
+
+            // The last sequence only contains literals
+            if ( pInput == pInputEnd )
+            {
+                return pOutput == pOutputEnd;
+            }
+
+            // Match
+            //-------------------------------------------------------------------------
+
+            if ( pInputEnd - pInput < 2 )
+            {
+                return false;
+            }
+
+            size_t const offset = size_t( pInput[0] ) | ( size_t( pInput[1] ) << 8 );
+            pInput += 2;
+
+            if ( offset == 0 || offset > size_t( pOutput - pData ) )
+            {
+                return false;
+            }
+
+            size_t matchLength = token & 0x0F;
+            if ( matchLength == 15 && !ReadLength( pInput, pInputEnd, matchLength ) )
+            {
+                return false;
+            }
+
+            matchLength += g_minMatchLength;
+            if ( matchLength > size_t( pOutputEnd - pOutput ) )
+            {
+                return false;
+            }
+
+            uint8_t const* pMatch = pOutput - offset;
+            if ( offset >= matchLength )
+            {
+                memcpy( pOutput, pMatch, matchLength );
+                pOutput += matchLength;
+            }
+            else // Overlapping match i.e. a repeating pattern, needs to be copied byte by byte
+            {
+                uint8_t* const pMatchEnd = pOutput + matchLength;
+                while ( pOutput < pMatchEnd )
+                {
+                    *pOutput++ = *pMatch++;
+                }
+            }
+        }
+    }
+}
\ No newline at end of file
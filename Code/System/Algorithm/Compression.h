@@ -0,0 +1,26 @@
+#pragma once
+#include "System/_Module/API.h"
+#include "System/Esoterica.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Compression
+{
+    //-------------------------------------------------------------------------
+    // LZ4 Block Compression
+    //-------------------------------------------------------------------------
+    // A fast LZ77 style compressor producing standard LZ4 block format data (no frame headers)
+    // Compression is a single greedy pass, decompression is bounds checked so it is safe to use on untrusted data
+
+    namespace LZ4
+    {
+        // The worst case compressed size for incompressible data
+        EE_FORCE_INLINE size_t GetMaxCompressedSize( size_t dataSize ) { return dataSize + ( dataSize / 255 ) + 16; }
+
+        // Returns the compressed size or 0 if the destination buffer was too small
+        EE_SYSTEM_API size_t Compress( uint8_t const* pData, size_t dataSize, uint8_t* pCompressedData, size_t compressedDataCapacity );
+
+        // The uncompressed size needs to be known in advance, returns false if the data is corrupt or doesnt decompress to exactly the expected size
+        EE_SYSTEM_API bool Decompress( uint8_t const* pCompressedData, size_t compressedDataSize, uint8_t* pData, size_t dataSize );
+    }
+}
\ No newline at end of file
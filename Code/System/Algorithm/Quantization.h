@@ -84,6 +84,14 @@ namespace EE::Quantization
         return decodedValue;
     }
 
+    // Decode 4 floats at once, each lane can have its own quantization range
+    inline __m128 DecodeFloat4( __m128i encodedValues, __m128 quantizationRangeStartValues, __m128 quantizationRangeLengths )
+    {
+        static __m128 const maxEncodedValue = { 65535.0f, 65535.0f, 65535.0f, 65535.0f };
+        __m128 const normalizedValues = _mm_div_ps( _mm_cvtepi32_ps( encodedValues ), maxEncodedValue );
+        return _mm_add_ps( _mm_mul_ps( normalizedValues, quantizationRangeLengths ), quantizationRangeStartValues );
+    }
+
     //-------------------------------------------------------------------------
     // Quaternion Encoding
     //-------------------------------------------------------------------------
@@ -237,6 +245,37 @@ namespace EE::Quantization
             }
         }
 
+        // Decode 4 quaternions at once, the encoded data is supplied as one uint16 per 32bit lane and the result is returned as separate component streams
+        inline static void ToQuaternion4( __m128i data0, __m128i data1, __m128i data2, __m128& outX, __m128& outY, __m128& outZ, __m128& outW )
+        {
+            static __m128 const rangeMultiplier15Bit = { s_valueRangeLength / float( 0x7FFF ), s_valueRangeLength / float( 0x7FFF ), s_valueRangeLength / float( 0x7FFF ), s_valueRangeLength / float( 0x7FFF ) };
+            static __m128 const rangeMin = { s_valueRangeMin, s_valueRangeMin, s_valueRangeMin, s_valueRangeMin };
+            static __m128 const one = { 1.0f, 1.0f, 1.0f, 1.0f };
+
+            __m128i const lowBitsMask = _mm_set1_epi32( 0x7FFF );
+            __m128i const largestValueIndex = _mm_or_si128( _mm_and_si128( _mm_srli_epi32( data0, 14 ), _mm_set1_epi32( 0x0002 ) ), _mm_srli_epi32( data1, 15 ) );
+
+            __m128 const a = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( data0, lowBitsMask ) ), rangeMultiplier15Bit ), rangeMin );
+            __m128 const b = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( data1, lowBitsMask ) ), rangeMultiplier15Bit ), rangeMin );
+            __m128 const c = _mm_add_ps( _mm_mul_ps( _mm_cvtepi32_ps( data2 ), rangeMultiplier15Bit ), rangeMin );
+
+            // Rebuild the largest component
+            __m128 const sum = _mm_add_ps( _mm_add_ps( _mm_mul_ps( a, a ), _mm_mul_ps( b, b ) ), _mm_mul_ps( c, c ) );
+            __m128 const d = _mm_sqrt_ps( _mm_max_ps( _mm_sub_ps( one, sum ), _mm_setzero_ps() ) );
+
+            // Insert the largest component into the correct position
+            __m128 const isIndex0 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_setzero_si128() ) );
+            __m128 const isIndex1 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 1 ) ) );
+            __m128 const isIndex2 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 2 ) ) );
+            __m128 const isIndex3 = _mm_castsi128_ps( _mm_cmpeq_epi32( largestValueIndex, _mm_set1_epi32( 3 ) ) );
+
+            auto Select = [] ( __m128 a, __m128 b, __m128 mask ) { return _mm_or_ps( _mm_andnot_ps( mask, a ), _mm_and_ps( mask, b ) ); };
+            outX = Select( a, d, isIndex0 );
+            outY = Select( Select( b, d, isIndex1 ), a, isIndex0 );
+            outZ = Select( Select( c, d, isIndex2 ), b, _mm_or_ps( isIndex0, isIndex1 ) );
+            outW = Select( c, d, isIndex3 );
+        }
+
         inline uint16_t GetData0() const { return m_data0; }
         inline uint16_t GetData1() const { return m_data1; }
         inline uint16_t GetData2() const { return m_data2; }
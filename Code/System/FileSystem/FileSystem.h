@@ -61,6 +61,107 @@ namespace EE::FileSystem
 
     EE_SYSTEM_API bool LoadFile( char const* filePath, Blob& fileData );
     EE_FORCE_INLINE bool LoadFile( String const& filePath, Blob& fileData ) { return LoadFile( filePath.c_str(), fileData ); }
+
+    // Memory mapped files
+    //-------------------------------------------------------------------------
+    // Maps an entire file into the address space of the process as read-only memory
+    // The file contents are paged in by the OS on access so no copies or explicit reads are needed
+
+    class EE_SYSTEM_API MemoryMappedFile
+    {
+    public:
+
+        MemoryMappedFile() = default;
+        MemoryMappedFile( MemoryMappedFile const& ) = delete;
+        ~MemoryMappedFile() { Close(); }
+
+        MemoryMappedFile& operator=( MemoryMappedFile const& ) = delete;
+
+        bool Open( char const* pPath );
+        EE_FORCE_INLINE bool Open( String const& filePath ) { return Open( filePath.c_str() ); }
+        void Close();
+
+        inline bool IsOpen() const { return m_pData != nullptr; }
+        inline uint8_t const* GetData() const { return m_pData; }
+        inline size_t GetSize() const { return m_size; }
+
+    private:
+
+        void*                   m_pFileHandle = nullptr;
+        void*                   m_pMappingHandle = nullptr;
+        uint8_t const*          m_pData = nullptr;
+        size_t                  m_size = 0;
+    };
+
+    // Asynchronous file reads
+    //-------------------------------------------------------------------------
+    // Reads an entire file using the OS's asynchronous I/O, no thread is blocked while the read is in flight
+    // The read is issued with Begin and the caller polls for completion, so any number of reads can be kept in flight at once
+    // Opening the file in Begin is a blocking call, so callers issuing many reads should call Begin from multiple threads
+    // The read bypasses the OS file cache so the buffer is sector aligned and padded, the buffer must not be accessed until the read has succeeded
+    //
+    // Win32: unbuffered overlapped reads
+    // Other platforms: a synchronous fallback that completes the read in Begin, no asynchronous backend is implemented yet
+
+    class EE_SYSTEM_API AsyncFileRead
+    {
+    public:
+
+        // The alignment of the read buffer and read size, this is a multiple of the sector size of all common drives
+        constexpr static size_t const s_readAlignment = 4096;
+
+        enum class Status : uint8_t
+        {
+            None,
+            Pending,
+            Succeeded,
+            Failed,
+        };
+
+    public:
+
+        AsyncFileRead() = default;
+        AsyncFileRead( AsyncFileRead const& ) = delete;
+        ~AsyncFileRead() { Cancel(); }
+
+        AsyncFileRead& operator=( AsyncFileRead const& ) = delete;
+
+        // Issue the read, returns false if the read could not be issued (e.g. the file doesnt exist)
+        bool Begin( char const* pPath );
+        EE_FORCE_INLINE bool Begin( String const& filePath ) { return Begin( filePath.c_str() ); }
+
+        // Check whether the read has completed, this never blocks
+        Status Poll();
+
+        // Cancel an in-flight read and release the read buffer, this will block until the OS has released the buffer
+        void Cancel();
+
+        inline Status GetStatus() const { return m_status; }
+        inline bool IsPending() const { return m_status == Status::Pending; }
+
+        // Get the size of the file, this is valid as soon as the read has been issued
+        inline size_t GetSize() const { return m_size; }
+
+        // Get the size of the allocated read buffer, this is the file size rounded up to the read alignment
+        inline size_t GetBufferSize() const { return m_bufferSize; }
+
+        // Get the read data, only valid once the read has succeeded and until the read is cancelled
+        inline uint8_t const* GetData() const { EE_ASSERT( m_status == Status::Succeeded ); return m_pBuffer; }
+
+    private:
+
+        void Close();
+        void ReleaseBuffer();
+
+    private:
+
+        uint8_t*                m_pBuffer = nullptr;
+        size_t                  m_size = 0;
+        size_t                  m_bufferSize = 0;
+        void*                   m_pFileHandle = nullptr;
+        void*                   m_pOverlapped = nullptr;
+        Status                  m_status = Status::None;
+    };
     
     // Directory Functions
     //-------------------------------------------------------------------------
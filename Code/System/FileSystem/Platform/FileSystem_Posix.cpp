@@ -0,0 +1,102 @@
+#ifndef _WIN32
+#include "../FileSystem.h"
+#include "System/Math/Math.h"
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+//-------------------------------------------------------------------------
+// Only the async file read is implemented for POSIX platforms
+// There is no asynchronous backend yet (io_uring or a pread thread pool), so the whole file is read in Begin and the read is always complete once issued
+//-------------------------------------------------------------------------
+
+namespace EE::FileSystem
+{
+    bool AsyncFileRead::Begin( char const* pPath )
+    {
+        EE_ASSERT( pPath != nullptr );
+        EE_ASSERT( m_status != Status::Pending );
+
+        ReleaseBuffer();
+        m_status = Status::Failed;
+
+        int const fileDescriptor = open( pPath, O_RDONLY );
+        if ( fileDescriptor < 0 )
+        {
+            return false;
+        }
+
+        struct stat fileStats;
+        if ( fstat( fileDescriptor, &fileStats ) != 0 || fileStats.st_size < 0 )
+        {
+            close( fileDescriptor );
+            return false;
+        }
+
+        if ( fileStats.st_size == 0 )
+        {
+            close( fileDescriptor );
+            m_status = Status::Succeeded;
+            return true;
+        }
+
+        // Keep the same buffer layout as the asynchronous backends
+        m_size = (size_t) fileStats.st_size;
+        m_bufferSize = (size_t) Math::RoundUpToNearestMultiple64( m_size, s_readAlignment );
+        m_pBuffer = (uint8_t*) EE::Alloc( m_bufferSize, s_readAlignment );
+
+        //-------------------------------------------------------------------------
+
+        size_t numBytesRead = 0;
+        while ( numBytesRead < m_size )
+        {
+            ssize_t const result = pread( fileDescriptor, m_pBuffer + numBytesRead, m_size - numBytesRead, (off_t) numBytesRead );
+            if ( result <= 0 )
+            {
+                break;
+            }
+
+            numBytesRead += (size_t) result;
+        }
+
+        close( fileDescriptor );
+
+        if ( numBytesRead != m_size )
+        {
+            ReleaseBuffer();
+            return false;
+        }
+
+        m_status = Status::Succeeded;
+        return true;
+    }
+
+    AsyncFileRead::Status AsyncFileRead::Poll()
+    {
+        EE_ASSERT( m_status != Status::Pending );
+        return m_status;
+    }
+
+    void AsyncFileRead::Cancel()
+    {
+        ReleaseBuffer();
+        m_status = Status::None;
+    }
+
+    void AsyncFileRead::Close()
+    {
+        EE_ASSERT( m_pFileHandle == nullptr && m_pOverlapped == nullptr );
+    }
+
+    void AsyncFileRead::ReleaseBuffer()
+    {
+        if ( m_pBuffer != nullptr )
+        {
+            EE::Free( (void*&) m_pBuffer );
+        }
+
+        m_size = 0;
+        m_bufferSize = 0;
+    }
+}
+#endif
@@ -192,6 +192,208 @@ namespace EE::FileSystem
         CloseHandle( hFile );
         return true;
     }
+
+    //-------------------------------------------------------------------------
+
+    bool MemoryMappedFile::Open( char const* pPath )
+    {
+        EE_ASSERT( pPath != nullptr );
+        EE_ASSERT( !IsOpen() );
+
+        HANDLE hFile = CreateFile( pPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSizeLI;
+        if ( !GetFileSizeEx( hFile, &fileSizeLI ) || fileSizeLI.QuadPart == 0 )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        HANDLE hMapping = CreateFileMapping( hFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+        if ( hMapping == nullptr )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        void* pView = MapViewOfFile( hMapping, FILE_MAP_READ, 0, 0, 0 );
+        if ( pView == nullptr )
+        {
+            CloseHandle( hMapping );
+            CloseHandle( hFile );
+            return false;
+        }
+
+        m_pFileHandle = hFile;
+        m_pMappingHandle = hMapping;
+        m_pData = (uint8_t const*) pView;
+        m_size = (size_t) fileSizeLI.QuadPart;
+        return true;
+    }
+
+    void MemoryMappedFile::Close()
+    {
+        if ( m_pData != nullptr )
+        {
+            UnmapViewOfFile( m_pData );
+            m_pData = nullptr;
+            m_size = 0;
+        }
+
+        if ( m_pMappingHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pMappingHandle );
+            m_pMappingHandle = nullptr;
+        }
+
+        if ( m_pFileHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pFileHandle );
+            m_pFileHandle = nullptr;
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool AsyncFileRead::Begin( char const* pPath )
+    {
+        EE_ASSERT( pPath != nullptr );
+        EE_ASSERT( m_status != Status::Pending );
+
+        ReleaseBuffer();
+        m_status = Status::Failed;
+
+        // Buffered overlapped reads of cached data complete synchronously in ReadFile, so we bypass the file cache to ensure the read is actually asynchronous
+        HANDLE hFile = CreateFile( pPath, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_OVERLAPPED | FILE_FLAG_NO_BUFFERING, nullptr );
+        if ( hFile == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        // A single read is limited to 4GB
+        LARGE_INTEGER fileSizeLI;
+        if ( !GetFileSizeEx( hFile, &fileSizeLI ) || fileSizeLI.QuadPart > UINT32_MAX )
+        {
+            CloseHandle( hFile );
+            return false;
+        }
+
+        if ( fileSizeLI.QuadPart == 0 )
+        {
+            CloseHandle( hFile );
+            m_status = Status::Succeeded;
+            return true;
+        }
+
+        // Unbuffered reads require the buffer address and the read size to be sector aligned, reading past the end of the file only returns the file's data
+        m_size = (size_t) fileSizeLI.QuadPart;
+        m_bufferSize = (size_t) Math::RoundUpToNearestMultiple64( m_size, s_readAlignment );
+        if ( m_bufferSize > UINT32_MAX )
+        {
+            CloseHandle( hFile );
+            ReleaseBuffer();
+            return false;
+        }
+
+        m_pBuffer = (uint8_t*) EE::Alloc( m_bufferSize, s_readAlignment );
+
+        //-------------------------------------------------------------------------
+
+        OVERLAPPED* pOverlapped = EE::New<OVERLAPPED>();
+        Memory::MemsetZero( pOverlapped );
+
+        // The read may complete immediately, in which case the result is still retrieved when polling
+        if ( !ReadFile( hFile, m_pBuffer, (DWORD) m_bufferSize, nullptr, pOverlapped ) && GetLastError() != ERROR_IO_PENDING )
+        {
+            EE::Delete( pOverlapped );
+            CloseHandle( hFile );
+            ReleaseBuffer();
+            return false;
+        }
+
+        m_pFileHandle = hFile;
+        m_pOverlapped = pOverlapped;
+        m_status = Status::Pending;
+        return true;
+    }
+
+    AsyncFileRead::Status AsyncFileRead::Poll()
+    {
+        if ( m_status != Status::Pending )
+        {
+            return m_status;
+        }
+
+        DWORD numBytesRead = 0;
+        if ( GetOverlappedResult( (HANDLE) m_pFileHandle, (OVERLAPPED*) m_pOverlapped, &numBytesRead, FALSE ) )
+        {
+            m_status = ( numBytesRead == m_size ) ? Status::Succeeded : Status::Failed;
+        }
+        else if ( GetLastError() != ERROR_IO_INCOMPLETE )
+        {
+            m_status = Status::Failed;
+        }
+
+        //-------------------------------------------------------------------------
+
+        if ( m_status != Status::Pending )
+        {
+            Close();
+
+            if ( m_status == Status::Failed )
+            {
+                ReleaseBuffer();
+            }
+        }
+
+        return m_status;
+    }
+
+    void AsyncFileRead::Cancel()
+    {
+        if ( m_status == Status::Pending )
+        {
+            // We need to wait for the cancellation to complete, since the OS may still write into the buffer until then
+            DWORD numBytesRead = 0;
+            CancelIoEx( (HANDLE) m_pFileHandle, (OVERLAPPED*) m_pOverlapped );
+            GetOverlappedResult( (HANDLE) m_pFileHandle, (OVERLAPPED*) m_pOverlapped, &numBytesRead, TRUE );
+            Close();
+        }
+
+        ReleaseBuffer();
+        m_status = Status::None;
+    }
+
+    void AsyncFileRead::Close()
+    {
+        if ( m_pOverlapped != nullptr )
+        {
+            OVERLAPPED* pOverlapped = (OVERLAPPED*) m_pOverlapped;
+            EE::Delete( pOverlapped );
+            m_pOverlapped = nullptr;
+        }
+
+        if ( m_pFileHandle != nullptr )
+        {
+            CloseHandle( (HANDLE) m_pFileHandle );
+            m_pFileHandle = nullptr;
+        }
+    }
+
+    void AsyncFileRead::ReleaseBuffer()
+    {
+        if ( m_pBuffer != nullptr )
+        {
+            EE::Free( (void*&) m_pBuffer );
+        }
+
+        m_size = 0;
+        m_bufferSize = 0;
+    }
 }
 
 #endif
\ No newline at end of file
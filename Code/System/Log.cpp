@@ -53,6 +53,24 @@ namespace EE::Log
         return g_pLog->m_logEntries;
     }
 
+    void ClearLogEntries()
+    {
+        EE_ASSERT( IsInitialized() );
+        std::lock_guard<std::mutex> lock( g_pLog->m_mutex );
+
+        if ( g_pLog->m_fatalErrorIndex != InvalidIndex )
+        {
+            LogEntry fatalError = g_pLog->m_logEntries[g_pLog->m_fatalErrorIndex];
+            g_pLog->m_logEntries.clear();
+            g_pLog->m_logEntries.emplace_back( eastl::move( fatalError ) );
+            g_pLog->m_fatalErrorIndex = 0;
+        }
+        else
+        {
+            g_pLog->m_logEntries.clear();
+        }
+    }
+
     void AddEntry( Severity severity, char const* pCategory, char const* pSourceInfo, char const* pFilename, int pLineNumber, char const* pMessageFormat, ... )
     {
         EE_ASSERT( IsInitialized() );
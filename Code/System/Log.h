@@ -47,6 +47,9 @@ namespace EE::Log
     EE_SYSTEM_API int32_t GetNumWarnings();
     EE_SYSTEM_API int32_t GetNumErrors();
 
+    // Clears all stored log entries (the warning and error counts are not reset), the fatal error entry is always kept
+    EE_SYSTEM_API void ClearLogEntries();
+
     // Output
     //-------------------------------------------------------------------------
 
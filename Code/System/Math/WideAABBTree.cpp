@@ -0,0 +1,751 @@
+#include "WideAABBTree.h"
+#include "System/Math/ViewVolume.h"
+#include "System/Math/SIMD.h"
+#include "System/Types/Color.h"
+#include "System/Drawing/DebugDrawing.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Math
+{
+    // The maximum number of queries that are traversed together in a batch
+    constexpr static int32_t const g_maxQueriesPerPacket = 32;
+
+    // Rotations need to reduce the surface area by at least this factor to be applied, this prevents rotating back and forth between equivalent configurations
+    constexpr static float const g_minRotationImprovement = 0.01f;
+
+    //-------------------------------------------------------------------------
+
+    static EE_FORCE_INLINE float GetSurfaceArea( Vector const& min, Vector const& max )
+    {
+        Float3 const d = ( max - min ).ToFloat3();
+        return 2.0f * ( d.m_x * d.m_y + d.m_y * d.m_z + d.m_z * d.m_x );
+    }
+
+    //-------------------------------------------------------------------------
+
+    WideAABBTree::Node::Node()
+    {
+        for ( auto i = 0; i < s_branchingFactor; i++ )
+        {
+            ClearChild( i );
+        }
+    }
+
+    AABB WideAABBTree::Node::GetChildBounds( int32_t slotIdx ) const
+    {
+        EE_ASSERT( slotIdx >= 0 && slotIdx < m_numChildren );
+        return AABB::FromMinMax( Vector( m_minX[slotIdx], m_minY[slotIdx], m_minZ[slotIdx] ), Vector( m_maxX[slotIdx], m_maxY[slotIdx], m_maxZ[slotIdx] ) );
+    }
+
+    void WideAABBTree::Node::SetChildBounds( int32_t slotIdx, Vector const& min, Vector const& max )
+    {
+        Float3 const fMin = min.ToFloat3();
+        Float3 const fMax = max.ToFloat3();
+        m_minX[slotIdx] = fMin.m_x;
+        m_minY[slotIdx] = fMin.m_y;
+        m_minZ[slotIdx] = fMin.m_z;
+        m_maxX[slotIdx] = fMax.m_x;
+        m_maxY[slotIdx] = fMax.m_y;
+        m_maxZ[slotIdx] = fMax.m_z;
+    }
+
+    void WideAABBTree::Node::ClearChild( int32_t slotIdx )
+    {
+        // Empty slots have inverted bounds so that they fail all overlap tests
+        m_minX[slotIdx] = m_minY[slotIdx] = m_minZ[slotIdx] = FLT_MAX;
+        m_maxX[slotIdx] = m_maxY[slotIdx] = m_maxZ[slotIdx] = -FLT_MAX;
+        m_children[slotIdx] = InvalidIndex;
+    }
+
+    //-------------------------------------------------------------------------
+
+    WideAABBTree::WideAABBTree()
+    {
+        m_nodes.reserve( 32 );
+        m_leaves.reserve( 100 );
+    }
+
+    int32_t WideAABBTree::RequestNode()
+    {
+        int32_t nodeIdx = InvalidIndex;
+        if ( m_freeNodes.empty() )
+        {
+            nodeIdx = (int32_t) m_nodes.size();
+            m_nodes.emplace_back();
+        }
+        else
+        {
+            nodeIdx = m_freeNodes.back();
+            m_freeNodes.pop_back();
+            new ( &m_nodes[nodeIdx] ) Node();
+        }
+
+        return nodeIdx;
+    }
+
+    void WideAABBTree::ReleaseNode( int32_t nodeIdx )
+    {
+        EE_ASSERT( nodeIdx >= 0 && nodeIdx < (int32_t) m_nodes.size() );
+        m_nodes[nodeIdx].m_numChildren = 0;
+        m_freeNodes.emplace_back( nodeIdx );
+    }
+
+    int32_t WideAABBTree::RequestLeaf()
+    {
+        int32_t leafIdx = InvalidIndex;
+        if ( m_freeLeaves.empty() )
+        {
+            leafIdx = (int32_t) m_leaves.size();
+            m_leaves.emplace_back();
+        }
+        else
+        {
+            leafIdx = m_freeLeaves.back();
+            m_freeLeaves.pop_back();
+        }
+
+        return leafIdx;
+    }
+
+    void WideAABBTree::ReleaseLeaf( int32_t leafIdx )
+    {
+        EE_ASSERT( leafIdx >= 0 && leafIdx < (int32_t) m_leaves.size() );
+        m_leaves[leafIdx] = Leaf();
+        m_freeLeaves.emplace_back( leafIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void WideAABBTree::SetChild( int32_t nodeIdx, int32_t slotIdx, int32_t child, Vector const& min, Vector const& max )
+    {
+        EE_ASSERT( child != InvalidIndex );
+        Node& node = m_nodes[nodeIdx];
+        node.m_children[slotIdx] = child;
+        node.SetChildBounds( slotIdx, min, max );
+
+        if ( IsLeafChild( child ) )
+        {
+            Leaf& leaf = m_leaves[DecodeLeafChild( child )];
+            leaf.m_nodeIdx = nodeIdx;
+            leaf.m_slotIdx = (int8_t) slotIdx;
+        }
+        else
+        {
+            m_nodes[child].m_parentNodeIdx = nodeIdx;
+            m_nodes[child].m_parentSlotIdx = (int8_t) slotIdx;
+        }
+    }
+
+    void WideAABBTree::GetNodeBounds( int32_t nodeIdx, Vector& outMin, Vector& outMax ) const
+    {
+        Node const& node = m_nodes[nodeIdx];
+        EE_ASSERT( node.m_numChildren > 0 );
+
+        // Empty slots have inverted bounds so we can always reduce across all slots
+        auto HorizontalMin = [] ( float const* pValues ) { __m128 v = _mm_load_ps( pValues ); v = _mm_min_ps( v, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ); v = _mm_min_ps( v, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 3, 0, 1 ) ) ); return _mm_cvtss_f32( v ); };
+        auto HorizontalMax = [] ( float const* pValues ) { __m128 v = _mm_load_ps( pValues ); v = _mm_max_ps( v, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 1, 0, 3, 2 ) ) ); v = _mm_max_ps( v, _mm_shuffle_ps( v, v, _MM_SHUFFLE( 2, 3, 0, 1 ) ) ); return _mm_cvtss_f32( v ); };
+
+        outMin = Vector( HorizontalMin( node.m_minX ), HorizontalMin( node.m_minY ), HorizontalMin( node.m_minZ ) );
+        outMax = Vector( HorizontalMax( node.m_maxX ), HorizontalMax( node.m_maxY ), HorizontalMax( node.m_maxZ ) );
+    }
+
+    //-------------------------------------------------------------------------
+
+    int32_t WideAABBTree::FindBestNodeToInsertInto( Vector const& min, Vector const& max ) const
+    {
+        int32_t currentNodeIdx = m_rootNodeIdx;
+        while ( true )
+        {
+            Node const& currentNode = m_nodes[currentNodeIdx];
+            if ( currentNode.HasFreeSlot() )
+            {
+                return currentNodeIdx;
+            }
+
+            // Pick the child whose surface area grows the least, leaf children get split into a new branch node
+            int32_t bestSlotIdx = InvalidIndex;
+            float bestCost = FLT_MAX;
+            for ( auto i = 0; i < currentNode.m_numChildren; i++ )
+            {
+                Vector const childMin( currentNode.m_minX[i], currentNode.m_minY[i], currentNode.m_minZ[i] );
+                Vector const childMax( currentNode.m_maxX[i], currentNode.m_maxY[i], currentNode.m_maxZ[i] );
+                float const cost = GetSurfaceArea( Vector::Min( childMin, min ), Vector::Max( childMax, max ) ) - GetSurfaceArea( childMin, childMax );
+                if ( cost < bestCost )
+                {
+                    bestCost = cost;
+                    bestSlotIdx = i;
+                }
+            }
+
+            EE_ASSERT( bestSlotIdx != InvalidIndex );
+            int32_t const bestChild = currentNode.m_children[bestSlotIdx];
+            if ( IsLeafChild( bestChild ) )
+            {
+                return currentNodeIdx;
+            }
+
+            currentNodeIdx = bestChild;
+        }
+
+        EE_UNREACHABLE_CODE();
+        return InvalidIndex;
+    }
+
+    void WideAABBTree::InsertBox( AABB const& newBox, uint64_t userData )
+    {
+        EE_ASSERT( newBox.IsValid() );
+
+        // All boxes must have a non-zero unique userdata value as that is also used as the ID
+        EE_ASSERT( userData != 0 && !Contains( userData ) );
+
+        int32_t const leafIdx = RequestLeaf();
+        Leaf& leaf = m_leaves[leafIdx];
+        leaf.m_min = newBox.GetMin();
+        leaf.m_max = newBox.GetMax();
+        leaf.m_userData = userData;
+        m_userDataToLeafMap.insert( eastl::make_pair( userData, leafIdx ) );
+
+        Vector const newMin = leaf.m_min;
+        Vector const newMax = leaf.m_max;
+
+        // First box
+        //-------------------------------------------------------------------------
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            m_rootNodeIdx = RequestNode();
+            m_nodes[m_rootNodeIdx].m_numChildren = 1;
+            SetChild( m_rootNodeIdx, 0, EncodeLeafChild( leafIdx ), newMin, newMax );
+            return;
+        }
+
+        // Insert into the best node, splitting a leaf if that node is full
+        //-------------------------------------------------------------------------
+
+        int32_t const targetNodeIdx = FindBestNodeToInsertInto( newMin, newMax );
+        if ( m_nodes[targetNodeIdx].HasFreeSlot() )
+        {
+            int32_t const slotIdx = m_nodes[targetNodeIdx].m_numChildren++;
+            SetChild( targetNodeIdx, slotIdx, EncodeLeafChild( leafIdx ), newMin, newMax );
+        }
+        else
+        {
+            // Find the leaf to pair the new box with
+            int32_t bestSlotIdx = InvalidIndex;
+            float bestCost = FLT_MAX;
+            for ( auto i = 0; i < s_branchingFactor; i++ )
+            {
+                int32_t const child = m_nodes[targetNodeIdx].m_children[i];
+                if ( IsLeafChild( child ) )
+                {
+                    Leaf const& siblingLeaf = m_leaves[DecodeLeafChild( child )];
+                    float const cost = GetSurfaceArea( Vector::Min( siblingLeaf.m_min, newMin ), Vector::Max( siblingLeaf.m_max, newMax ) );
+                    if ( cost < bestCost )
+                    {
+                        bestCost = cost;
+                        bestSlotIdx = i;
+                    }
+                }
+            }
+
+            EE_ASSERT( bestSlotIdx != InvalidIndex );
+            int32_t const siblingChild = m_nodes[targetNodeIdx].m_children[bestSlotIdx];
+            Leaf const& siblingLeaf = m_leaves[DecodeLeafChild( siblingChild )];
+            Vector const siblingMin = siblingLeaf.m_min;
+            Vector const siblingMax = siblingLeaf.m_max;
+
+            // Create the new branch and replace the sibling leaf with it
+            int32_t const newBranchNodeIdx = RequestNode();
+            m_nodes[newBranchNodeIdx].m_numChildren = 2;
+            SetChild( newBranchNodeIdx, 0, siblingChild, siblingMin, siblingMax );
+            SetChild( newBranchNodeIdx, 1, EncodeLeafChild( leafIdx ), newMin, newMax );
+            SetChild( targetNodeIdx, bestSlotIdx, newBranchNodeIdx, Vector::Min( siblingMin, newMin ), Vector::Max( siblingMax, newMax ) );
+        }
+
+        RefitAndOptimizeAncestors( targetNodeIdx );
+    }
+
+    void WideAABBTree::RemoveBox( uint64_t userData )
+    {
+        auto iter = m_userDataToLeafMap.find( userData );
+        EE_ASSERT( iter != m_userDataToLeafMap.end() );
+
+        int32_t const leafIdx = iter->second;
+        int32_t const nodeIdx = m_leaves[leafIdx].m_nodeIdx;
+        int32_t const slotIdx = m_leaves[leafIdx].m_slotIdx;
+        m_userDataToLeafMap.erase( iter );
+        ReleaseLeaf( leafIdx );
+
+        // Remove the leaf from its node, keeping all children contiguous
+        //-------------------------------------------------------------------------
+
+        Node& node = m_nodes[nodeIdx];
+        int32_t const lastSlotIdx = node.m_numChildren - 1;
+        if ( slotIdx != lastSlotIdx )
+        {
+            Vector const lastMin( node.m_minX[lastSlotIdx], node.m_minY[lastSlotIdx], node.m_minZ[lastSlotIdx] );
+            Vector const lastMax( node.m_maxX[lastSlotIdx], node.m_maxY[lastSlotIdx], node.m_maxZ[lastSlotIdx] );
+            SetChild( nodeIdx, slotIdx, node.m_children[lastSlotIdx], lastMin, lastMax );
+        }
+
+        node.ClearChild( lastSlotIdx );
+        node.m_numChildren--;
+
+        // Collapse degenerate nodes
+        //-------------------------------------------------------------------------
+
+        if ( nodeIdx == m_rootNodeIdx )
+        {
+            if ( node.m_numChildren == 0 )
+            {
+                ReleaseNode( nodeIdx );
+                m_rootNodeIdx = InvalidIndex;
+            }
+            else if ( node.m_numChildren == 1 && !IsLeafChild( node.m_children[0] ) )
+            {
+                // Promote the only branch to be the new root
+                int32_t const newRootNodeIdx = node.m_children[0];
+                ReleaseNode( nodeIdx );
+                m_rootNodeIdx = newRootNodeIdx;
+                m_nodes[newRootNodeIdx].m_parentNodeIdx = InvalidIndex;
+                m_nodes[newRootNodeIdx].m_parentSlotIdx = InvalidIndex;
+            }
+
+            return;
+        }
+
+        if ( node.m_numChildren == 1 )
+        {
+            // Replace this node with its only child in the parent
+            int32_t const parentNodeIdx = node.m_parentNodeIdx;
+            int32_t const parentSlotIdx = node.m_parentSlotIdx;
+            Vector const childMin( node.m_minX[0], node.m_minY[0], node.m_minZ[0] );
+            Vector const childMax( node.m_maxX[0], node.m_maxY[0], node.m_maxZ[0] );
+            SetChild( parentNodeIdx, parentSlotIdx, node.m_children[0], childMin, childMax );
+            ReleaseNode( nodeIdx );
+            RefitAndOptimizeAncestors( parentNodeIdx );
+        }
+        else
+        {
+            RefitAndOptimizeAncestors( nodeIdx );
+        }
+    }
+
+    void WideAABBTree::Refit( AABB const& aabb, uint64_t userData )
+    {
+        EE_ASSERT( aabb.IsValid() );
+
+        auto iter = m_userDataToLeafMap.find( userData );
+        EE_ASSERT( iter != m_userDataToLeafMap.end() );
+
+        Leaf& leaf = m_leaves[iter->second];
+        leaf.m_min = aabb.GetMin();
+        leaf.m_max = aabb.GetMax();
+        m_nodes[leaf.m_nodeIdx].SetChildBounds( leaf.m_slotIdx, leaf.m_min, leaf.m_max );
+        RefitAndOptimizeAncestors( leaf.m_nodeIdx );
+    }
+
+    //-------------------------------------------------------------------------
+
+    void WideAABBTree::RefitAndOptimizeAncestors( int32_t nodeIdx )
+    {
+        int32_t currentNodeIdx = nodeIdx;
+        while ( currentNodeIdx != InvalidIndex )
+        {
+            TryRotate( currentNodeIdx );
+
+            Node const& currentNode = m_nodes[currentNodeIdx];
+            if ( currentNode.m_parentNodeIdx != InvalidIndex )
+            {
+                Vector min, max;
+                GetNodeBounds( currentNodeIdx, min, max );
+                m_nodes[currentNode.m_parentNodeIdx].SetChildBounds( currentNode.m_parentSlotIdx, min, max );
+            }
+
+            currentNodeIdx = currentNode.m_parentNodeIdx;
+        }
+    }
+
+    bool WideAABBTree::TryRotate( int32_t nodeIdx )
+    {
+        // Try to swap a child of this node with a grandchild (a child of one of its branch children)
+        // The bounds of this node are unaffected, so the only surface area that changes is that of the branch child
+
+        Node const& node = m_nodes[nodeIdx];
+
+        float bestImprovement = 0.0f;
+        int32_t bestChildSlotIdx = InvalidIndex;
+        int32_t bestBranchSlotIdx = InvalidIndex;
+        int32_t bestGrandchildSlotIdx = InvalidIndex;
+
+        for ( auto branchSlotIdx = 0; branchSlotIdx < node.m_numChildren; branchSlotIdx++ )
+        {
+            int32_t const branchNodeIdx = node.m_children[branchSlotIdx];
+            if ( IsLeafChild( branchNodeIdx ) )
+            {
+                continue;
+            }
+
+            Node const& branchNode = m_nodes[branchNodeIdx];
+            Vector const branchMin( node.m_minX[branchSlotIdx], node.m_minY[branchSlotIdx], node.m_minZ[branchSlotIdx] );
+            Vector const branchMax( node.m_maxX[branchSlotIdx], node.m_maxY[branchSlotIdx], node.m_maxZ[branchSlotIdx] );
+            float const branchArea = GetSurfaceArea( branchMin, branchMax );
+
+            for ( auto grandchildSlotIdx = 0; grandchildSlotIdx < branchNode.m_numChildren; grandchildSlotIdx++ )
+            {
+                // The bounds of the branch without this grandchild
+                Vector remainingMin( FLT_MAX ), remainingMax( -FLT_MAX );
+                for ( auto i = 0; i < branchNode.m_numChildren; i++ )
+                {
+                    if ( i != grandchildSlotIdx )
+                    {
+                        remainingMin = Vector::Min( remainingMin, Vector( branchNode.m_minX[i], branchNode.m_minY[i], branchNode.m_minZ[i] ) );
+                        remainingMax = Vector::Max( remainingMax, Vector( branchNode.m_maxX[i], branchNode.m_maxY[i], branchNode.m_maxZ[i] ) );
+                    }
+                }
+
+                for ( auto childSlotIdx = 0; childSlotIdx < node.m_numChildren; childSlotIdx++ )
+                {
+                    if ( childSlotIdx == branchSlotIdx )
+                    {
+                        continue;
+                    }
+
+                    Vector const childMin( node.m_minX[childSlotIdx], node.m_minY[childSlotIdx], node.m_minZ[childSlotIdx] );
+                    Vector const childMax( node.m_maxX[childSlotIdx], node.m_maxY[childSlotIdx], node.m_maxZ[childSlotIdx] );
+                    float const newBranchArea = GetSurfaceArea( Vector::Min( remainingMin, childMin ), Vector::Max( remainingMax, childMax ) );
+                    float const improvement = branchArea - newBranchArea;
+                    if ( improvement > bestImprovement && improvement > branchArea * g_minRotationImprovement )
+                    {
+                        bestImprovement = improvement;
+                        bestChildSlotIdx = childSlotIdx;
+                        bestBranchSlotIdx = branchSlotIdx;
+                        bestGrandchildSlotIdx = grandchildSlotIdx;
+                    }
+                }
+            }
+        }
+
+        if ( bestChildSlotIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        // Perform the swap
+        //-------------------------------------------------------------------------
+
+        int32_t const branchNodeIdx = node.m_children[bestBranchSlotIdx];
+        int32_t const child = node.m_children[bestChildSlotIdx];
+        int32_t const grandchild = m_nodes[branchNodeIdx].m_children[bestGrandchildSlotIdx];
+
+        Vector const childMin( node.m_minX[bestChildSlotIdx], node.m_minY[bestChildSlotIdx], node.m_minZ[bestChildSlotIdx] );
+        Vector const childMax( node.m_maxX[bestChildSlotIdx], node.m_maxY[bestChildSlotIdx], node.m_maxZ[bestChildSlotIdx] );
+        Node const& branchNode = m_nodes[branchNodeIdx];
+        Vector const grandchildMin( branchNode.m_minX[bestGrandchildSlotIdx], branchNode.m_minY[bestGrandchildSlotIdx], branchNode.m_minZ[bestGrandchildSlotIdx] );
+        Vector const grandchildMax( branchNode.m_maxX[bestGrandchildSlotIdx], branchNode.m_maxY[bestGrandchildSlotIdx], branchNode.m_maxZ[bestGrandchildSlotIdx] );
+
+        SetChild( branchNodeIdx, bestGrandchildSlotIdx, child, childMin, childMax );
+        SetChild( nodeIdx, bestChildSlotIdx, grandchild, grandchildMin, grandchildMax );
+
+        Vector branchMin, branchMax;
+        GetNodeBounds( branchNodeIdx, branchMin, branchMax );
+        m_nodes[nodeIdx].SetChildBounds( bestBranchSlotIdx, branchMin, branchMax );
+
+        return true;
+    }
+
+    //-------------------------------------------------------------------------
+    // Queries
+    //-------------------------------------------------------------------------
+
+    template<typename ChildTestFunction>
+    void WideAABBTree::Traverse( ChildTestFunction const& testFunction, TVector<uint64_t>& outResults ) const
+    {
+        TInlineVector<int32_t, 64> stack;
+        stack.emplace_back( m_rootNodeIdx );
+
+        while ( !stack.empty() )
+        {
+            Node const& node = m_nodes[stack.back()];
+            stack.pop_back();
+
+            uint32_t const overlapMask = testFunction( node );
+            for ( auto slotIdx = 0; slotIdx < node.m_numChildren; slotIdx++ )
+            {
+                if ( ( overlapMask & ( 1u << slotIdx ) ) == 0 )
+                {
+                    continue;
+                }
+
+                int32_t const child = node.m_children[slotIdx];
+                if ( IsLeafChild( child ) )
+                {
+                    outResults.emplace_back( m_leaves[DecodeLeafChild( child )].m_userData );
+                }
+                else
+                {
+                    stack.emplace_back( child );
+                }
+            }
+        }
+    }
+
+    template<typename ChildTestFunction>
+    void WideAABBTree::TraverseBatch( int32_t numQueries, ChildTestFunction const& testFunction, TVector<TVector<uint64_t>>& outResults ) const
+    {
+        struct StackEntry
+        {
+            int32_t     m_nodeIdx;
+            uint32_t    m_queryMask;
+        };
+
+        TInlineVector<StackEntry, 64> stack;
+
+        for ( int32_t packetStart = 0; packetStart < numQueries; packetStart += g_maxQueriesPerPacket )
+        {
+            int32_t const numPacketQueries = Math::Min( numQueries - packetStart, g_maxQueriesPerPacket );
+            uint32_t const packetMask = ( numPacketQueries == 32 ) ? 0xFFFFFFFF : ( ( 1u << numPacketQueries ) - 1 );
+
+            stack.clear();
+            stack.push_back( { m_rootNodeIdx, packetMask } );
+
+            while ( !stack.empty() )
+            {
+                StackEntry const entry = stack.back();
+                stack.pop_back();
+
+                Node const& node = m_nodes[entry.m_nodeIdx];
+                uint32_t const validChildMask = ( 1u << node.m_numChildren ) - 1;
+
+                // Test all active queries in the packet, recording which queries overlap each child
+                uint32_t childQueryMasks[s_branchingFactor] = { 0, 0, 0, 0 };
+                for ( auto queryIdx = 0; queryIdx < numPacketQueries; queryIdx++ )
+                {
+                    if ( ( entry.m_queryMask & ( 1u << queryIdx ) ) == 0 )
+                    {
+                        continue;
+                    }
+
+                    uint32_t const overlapMask = testFunction( packetStart + queryIdx, node ) & validChildMask;
+                    for ( auto i = 0; i < s_branchingFactor; i++ )
+                    {
+                        childQueryMasks[i] |= ( ( overlapMask >> i ) & 1u ) << queryIdx;
+                    }
+                }
+
+                //-------------------------------------------------------------------------
+
+                for ( auto i = 0; i < node.m_numChildren; i++ )
+                {
+                    if ( childQueryMasks[i] == 0 )
+                    {
+                        continue;
+                    }
+
+                    int32_t const child = node.m_children[i];
+                    if ( IsLeafChild( child ) )
+                    {
+                        uint64_t const userData = m_leaves[DecodeLeafChild( child )].m_userData;
+                        for ( auto queryIdx = 0; queryIdx < numPacketQueries; queryIdx++ )
+                        {
+                            if ( childQueryMasks[i] & ( 1u << queryIdx ) )
+                            {
+                                outResults[packetStart + queryIdx].emplace_back( userData );
+                            }
+                        }
+                    }
+                    else
+                    {
+                        stack.push_back( { child, childQueryMasks[i] } );
+                    }
+                }
+            }
+        }
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct BoxQuery
+        {
+            BoxQuery( AABB const& box )
+            {
+                Float3 const min = box.GetMin().ToFloat3();
+                Float3 const max = box.GetMax().ToFloat3();
+                m_minX = _mm_set1_ps( min.m_x );
+                m_minY = _mm_set1_ps( min.m_y );
+                m_minZ = _mm_set1_ps( min.m_z );
+                m_maxX = _mm_set1_ps( max.m_x );
+                m_maxY = _mm_set1_ps( max.m_y );
+                m_maxZ = _mm_set1_ps( max.m_z );
+            }
+
+            __m128 m_minX, m_minY, m_minZ, m_maxX, m_maxY, m_maxZ;
+        };
+
+        struct FrustumQuery
+        {
+            FrustumQuery( ViewVolume const& viewVolume )
+            {
+                for ( auto i = 0u; i < 6; i++ )
+                {
+                    Float4 const plane = viewVolume.GetViewPlane( i ).ToFloat4();
+                    m_planes[i][0] = _mm_set1_ps( plane.m_x );
+                    m_planes[i][1] = _mm_set1_ps( plane.m_y );
+                    m_planes[i][2] = _mm_set1_ps( plane.m_z );
+                    m_planes[i][3] = _mm_set1_ps( plane.m_w );
+                    m_usePositiveX[i] = plane.m_x >= 0.0f;
+                    m_usePositiveY[i] = plane.m_y >= 0.0f;
+                    m_usePositiveZ[i] = plane.m_z >= 0.0f;
+                }
+            }
+
+            __m128 m_planes[6][4];
+            bool m_usePositiveX[6];
+            bool m_usePositiveY[6];
+            bool m_usePositiveZ[6];
+        };
+    }
+
+    // Test all four children of a node against a box
+    static EE_FORCE_INLINE uint32_t TestChildrenAgainstBox( BoxQuery const& query, float const* pMinX, float const* pMinY, float const* pMinZ, float const* pMaxX, float const* pMaxY, float const* pMaxZ )
+    {
+        __m128 const overlapX = _mm_and_ps( _mm_cmple_ps( _mm_load_ps( pMinX ), query.m_maxX ), _mm_cmpge_ps( _mm_load_ps( pMaxX ), query.m_minX ) );
+        __m128 const overlapY = _mm_and_ps( _mm_cmple_ps( _mm_load_ps( pMinY ), query.m_maxY ), _mm_cmpge_ps( _mm_load_ps( pMaxY ), query.m_minY ) );
+        __m128 const overlapZ = _mm_and_ps( _mm_cmple_ps( _mm_load_ps( pMinZ ), query.m_maxZ ), _mm_cmpge_ps( _mm_load_ps( pMaxZ ), query.m_minZ ) );
+        return (uint32_t) _mm_movemask_ps( _mm_and_ps( _mm_and_ps( overlapX, overlapY ), overlapZ ) );
+    }
+
+    bool WideAABBTree::FindOverlaps( AABB const& queryBox, TVector<uint64_t>& outResults ) const
+    {
+        outResults.clear();
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        BoxQuery const query( queryBox );
+        Traverse( [&query] ( Node const& node ) { return TestChildrenAgainstBox( query, node.m_minX, node.m_minY, node.m_minZ, node.m_maxX, node.m_maxY, node.m_maxZ ); }, outResults );
+        return outResults.size() > 0;
+    }
+
+    void WideAABBTree::FindOverlaps( AABB const* pQueryBoxes, int32_t numQueries, TVector<TVector<uint64_t>>& outResults ) const
+    {
+        EE_ASSERT( pQueryBoxes != nullptr || numQueries == 0 );
+
+        outResults.resize( numQueries );
+        for ( auto& results : outResults )
+        {
+            results.clear();
+        }
+
+        if ( m_rootNodeIdx == InvalidIndex || numQueries == 0 )
+        {
+            return;
+        }
+
+        TInlineVector<BoxQuery, g_maxQueriesPerPacket> queries;
+        for ( auto i = 0; i < numQueries; i++ )
+        {
+            queries.emplace_back( pQueryBoxes[i] );
+        }
+
+        TraverseBatch( numQueries, [&queries] ( int32_t queryIdx, Node const& node ) { return TestChildrenAgainstBox( queries[queryIdx], node.m_minX, node.m_minY, node.m_minZ, node.m_maxX, node.m_maxY, node.m_maxZ ); }, outResults );
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Test all four children of a node against a frustum, a child is culled if its most positive vertex is outside any plane
+    static EE_FORCE_INLINE uint32_t TestChildrenAgainstFrustum( FrustumQuery const& query, float const* pMinX, float const* pMinY, float const* pMinZ, float const* pMaxX, float const* pMaxY, float const* pMaxZ )
+    {
+        __m128 const minX = _mm_load_ps( pMinX ), minY = _mm_load_ps( pMinY ), minZ = _mm_load_ps( pMinZ );
+        __m128 const maxX = _mm_load_ps( pMaxX ), maxY = _mm_load_ps( pMaxY ), maxZ = _mm_load_ps( pMaxZ );
+
+        __m128 outsideMask = _mm_setzero_ps();
+        for ( auto i = 0; i < 6; i++ )
+        {
+            __m128 const x = query.m_usePositiveX[i] ? maxX : minX;
+            __m128 const y = query.m_usePositiveY[i] ? maxY : minY;
+            __m128 const z = query.m_usePositiveZ[i] ? maxZ : minZ;
+
+            __m128 distance = _mm_add_ps( _mm_mul_ps( query.m_planes[i][0], x ), query.m_planes[i][3] );
+            distance = _mm_add_ps( _mm_mul_ps( query.m_planes[i][1], y ), distance );
+            distance = _mm_add_ps( _mm_mul_ps( query.m_planes[i][2], z ), distance );
+            outsideMask = _mm_or_ps( outsideMask, _mm_cmplt_ps( distance, _mm_setzero_ps() ) );
+        }
+
+        return ~uint32_t( _mm_movemask_ps( outsideMask ) ) & 0xF;
+    }
+
+    bool WideAABBTree::FindOverlaps( ViewVolume const& viewVolume, TVector<uint64_t>& outResults ) const
+    {
+        outResults.clear();
+
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        FrustumQuery const query( viewVolume );
+        Traverse( [&query] ( Node const& node ) { return TestChildrenAgainstFrustum( query, node.m_minX, node.m_minY, node.m_minZ, node.m_maxX, node.m_maxY, node.m_maxZ ); }, outResults );
+        return outResults.size() > 0;
+    }
+
+    void WideAABBTree::FindOverlaps( ViewVolume const* const* ppViewVolumes, int32_t numQueries, TVector<TVector<uint64_t>>& outResults ) const
+    {
+        EE_ASSERT( ppViewVolumes != nullptr || numQueries == 0 );
+
+        outResults.resize( numQueries );
+        for ( auto& results : outResults )
+        {
+            results.clear();
+        }
+
+        if ( m_rootNodeIdx == InvalidIndex || numQueries == 0 )
+        {
+            return;
+        }
+
+        TInlineVector<FrustumQuery, 4> queries;
+        for ( auto i = 0; i < numQueries; i++ )
+        {
+            queries.emplace_back( *ppViewVolumes[i] );
+        }
+
+        TraverseBatch( numQueries, [&queries] ( int32_t queryIdx, Node const& node ) { return TestChildrenAgainstFrustum( queries[queryIdx], node.m_minX, node.m_minY, node.m_minZ, node.m_maxX, node.m_maxY, node.m_maxZ ); }, outResults );
+    }
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    void WideAABBTree::DrawDebug( Drawing::DrawContext& drawingContext ) const
+    {
+        if ( m_rootNodeIdx == InvalidIndex )
+        {
+            return;
+        }
+
+        DrawNode( drawingContext, m_rootNodeIdx );
+    }
+
+    void WideAABBTree::DrawNode( Drawing::DrawContext& drawingContext, int32_t nodeIdx ) const
+    {
+        Node const& node = m_nodes[nodeIdx];
+        for ( auto i = 0; i < node.m_numChildren; i++ )
+        {
+            if ( IsLeafChild( node.m_children[i] ) )
+            {
+                drawingContext.DrawWireBox( node.GetChildBounds( i ), Colors::Lime, 2.0f, Drawing::DepthTestState::EnableDepthTest );
+            }
+            else
+            {
+                drawingContext.DrawWireBox( node.GetChildBounds( i ), Colors::Cyan, 1.0f, Drawing::DepthTestState::EnableDepthTest );
+                DrawNode( drawingContext, node.m_children[i] );
+            }
+        }
+    }
+    #endif
+}
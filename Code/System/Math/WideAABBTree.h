@@ -0,0 +1,150 @@
+#pragma once
+
+#include "System/Math/BoundingVolumes.h"
+#include "System/Types/Arrays.h"
+#include "System/Types/HashMap.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Drawing { class DrawContext; }
+
+//-------------------------------------------------------------------------
+// Wide AABB Tree
+//-------------------------------------------------------------------------
+// A 4-wide dynamic bounding volume hierarchy
+// Each node stores the bounds of all its children in SoA form so that all four children can be tested at once
+// Traversal is iterative and leaves are stored separately so that boxes can be found, removed and refit in constant time
+// The tree quality (surface area heuristic) is maintained incrementally by tree rotations along the modified paths
+
+namespace EE::Math
+{
+    class ViewVolume;
+
+    //-------------------------------------------------------------------------
+
+    class EE_SYSTEM_API WideAABBTree
+    {
+    public:
+
+        constexpr static int32_t const s_branchingFactor = 4;
+
+    private:
+
+        struct alignas( 16 ) Node
+        {
+            Node();
+
+            inline bool HasFreeSlot() const { return m_numChildren < s_branchingFactor; }
+            AABB GetChildBounds( int32_t slotIdx ) const;
+            void SetChildBounds( int32_t slotIdx, Vector const& min, Vector const& max );
+            void ClearChild( int32_t slotIdx );
+
+        public:
+
+            alignas( 16 ) float     m_minX[s_branchingFactor];
+            alignas( 16 ) float     m_minY[s_branchingFactor];
+            alignas( 16 ) float     m_minZ[s_branchingFactor];
+            alignas( 16 ) float     m_maxX[s_branchingFactor];
+            alignas( 16 ) float     m_maxY[s_branchingFactor];
+            alignas( 16 ) float     m_maxZ[s_branchingFactor];
+            int32_t                 m_children[s_branchingFactor];      // Node indices for branches, encoded leaf indices for leaves
+            int32_t                 m_parentNodeIdx = InvalidIndex;
+            int8_t                  m_parentSlotIdx = InvalidIndex;
+            int8_t                  m_numChildren = 0;
+        };
+
+        struct Leaf
+        {
+            Vector                  m_min;
+            Vector                  m_max;
+            uint64_t                m_userData = 0;
+            int32_t                 m_nodeIdx = InvalidIndex;
+            int8_t                  m_slotIdx = InvalidIndex;
+        };
+
+    public:
+
+        WideAABBTree();
+
+        inline bool IsEmpty() const { return m_rootNodeIdx == InvalidIndex; }
+        inline int32_t GetNumBoxes() const { return (int32_t) m_userDataToLeafMap.size(); }
+        inline bool Contains( uint64_t userData ) const { return m_userDataToLeafMap.find( userData ) != m_userDataToLeafMap.end(); }
+
+        void InsertBox( AABB const& aabb, uint64_t userData );
+        void RemoveBox( uint64_t userData );
+
+        // Update the bounds of a box that has moved, this is much cheaper than removing and reinserting the box
+        void Refit( AABB const& aabb, uint64_t userData );
+
+        EE_FORCE_INLINE void InsertBox( AABB const& aabb, void* pUserData ) { InsertBox( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE void RemoveBox( void* pUserData ) { RemoveBox( reinterpret_cast<uint64_t>( pUserData ) ); }
+        EE_FORCE_INLINE void Refit( AABB const& aabb, void* pUserData ) { Refit( aabb, reinterpret_cast<uint64_t>( pUserData ) ); }
+
+        // Single queries
+        //-------------------------------------------------------------------------
+
+        bool FindOverlaps( AABB const& queryBox, TVector<uint64_t>& outResults ) const;
+        bool FindOverlaps( ViewVolume const& viewVolume, TVector<uint64_t>& outResults ) const;
+
+        template<typename T>
+        bool FindOverlaps( AABB const& queryBox, TVector<T*>& outResults ) const
+        {
+            return FindOverlaps( queryBox, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
+        template<typename T>
+        bool FindOverlaps( ViewVolume const& viewVolume, TVector<T*>& outResults ) const
+        {
+            return FindOverlaps( viewVolume, reinterpret_cast<TVector<uint64_t>&>( outResults ) );
+        }
+
+        // Batch queries: the tree is traversed once for a whole packet of queries, one result list per query
+        //-------------------------------------------------------------------------
+
+        void FindOverlaps( AABB const* pQueryBoxes, int32_t numQueries, TVector<TVector<uint64_t>>& outResults ) const;
+        void FindOverlaps( ViewVolume const* const* ppViewVolumes, int32_t numQueries, TVector<TVector<uint64_t>>& outResults ) const;
+
+        //-------------------------------------------------------------------------
+
+        #if EE_DEVELOPMENT_TOOLS
+        void DrawDebug( Drawing::DrawContext& drawingContext ) const;
+        #endif
+
+    private:
+
+        static EE_FORCE_INLINE bool IsLeafChild( int32_t child ) { return child < InvalidIndex; }
+        static EE_FORCE_INLINE int32_t EncodeLeafChild( int32_t leafIdx ) { return -( leafIdx + 2 ); }
+        static EE_FORCE_INLINE int32_t DecodeLeafChild( int32_t child ) { return -child - 2; }
+
+        int32_t RequestNode();
+        void ReleaseNode( int32_t nodeIdx );
+        int32_t RequestLeaf();
+        void ReleaseLeaf( int32_t leafIdx );
+
+        void SetChild( int32_t nodeIdx, int32_t slotIdx, int32_t child, Vector const& min, Vector const& max );
+        void GetNodeBounds( int32_t nodeIdx, Vector& outMin, Vector& outMax ) const;
+
+        int32_t FindBestNodeToInsertInto( Vector const& min, Vector const& max ) const;
+        void RefitAndOptimizeAncestors( int32_t nodeIdx );
+        bool TryRotate( int32_t nodeIdx );
+
+        template<typename ChildTestFunction>
+        void Traverse( ChildTestFunction const& testFunction, TVector<uint64_t>& outResults ) const;
+
+        template<typename ChildTestFunction>
+        void TraverseBatch( int32_t numQueries, ChildTestFunction const& testFunction, TVector<TVector<uint64_t>>& outResults ) const;
+
+        #if EE_DEVELOPMENT_TOOLS
+        void DrawNode( Drawing::DrawContext& drawingContext, int32_t nodeIdx ) const;
+        #endif
+
+    private:
+
+        TVector<Node>                       m_nodes;
+        TVector<Leaf>                       m_leaves;
+        TVector<int32_t>                    m_freeNodes;
+        TVector<int32_t>                    m_freeLeaves;
+        THashMap<uint64_t, int32_t>         m_userDataToLeafMap;
+        int32_t                             m_rootNodeIdx = InvalidIndex;
+    };
+}
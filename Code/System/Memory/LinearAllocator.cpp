@@ -0,0 +1,73 @@
+#include "LinearAllocator.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE
+{
+    LinearAllocator::LinearAllocator( size_t pageSize )
+        : m_pageSize( pageSize )
+    {
+        EE_ASSERT( m_pageSize > 0 );
+    }
+
+    LinearAllocator::~LinearAllocator()
+    {
+        ReleaseMemory();
+    }
+
+    void* LinearAllocator::Allocate( size_t size, size_t alignment )
+    {
+        EE_ASSERT( size > 0 && size <= m_pageSize );
+
+        // Allocate the first page lazily
+        if ( m_pages.empty() )
+        {
+            m_pages.emplace_back( (uint8_t*) EE::Alloc( m_pageSize, 16 ) );
+        }
+
+        // Try to fit the allocation in the current page, otherwise move onto the next page
+        size_t padding = Memory::CalculatePaddingForAlignment( m_pages[m_current.m_pageIdx] + m_current.m_offset, alignment );
+        if ( m_current.m_offset + padding + size > m_pageSize )
+        {
+            m_current.m_pageIdx++;
+            m_current.m_offset = 0;
+
+            if ( m_current.m_pageIdx == m_pages.size() )
+            {
+                m_pages.emplace_back( (uint8_t*) EE::Alloc( m_pageSize, 16 ) );
+            }
+
+            padding = Memory::CalculatePaddingForAlignment( m_pages[m_current.m_pageIdx], alignment );
+            EE_ASSERT( padding + size <= m_pageSize );
+        }
+
+        //-------------------------------------------------------------------------
+
+        void* pAllocation = m_pages[m_current.m_pageIdx] + m_current.m_offset + padding;
+        m_current.m_offset += uint32_t( padding + size );
+        m_highWaterMark = std::max( m_highWaterMark, GetUsedMemory() );
+        return pAllocation;
+    }
+
+    void LinearAllocator::RollbackToMarker( Marker const& marker )
+    {
+        EE_ASSERT( marker.m_pageIdx < m_current.m_pageIdx || ( marker.m_pageIdx == m_current.m_pageIdx && marker.m_offset <= m_current.m_offset ) );
+        m_current = marker;
+    }
+
+    void LinearAllocator::Reset()
+    {
+        m_current = Marker();
+    }
+
+    void LinearAllocator::ReleaseMemory()
+    {
+        for ( auto& pPage : m_pages )
+        {
+            EE::Free( (void*&) pPage );
+        }
+
+        m_pages.clear();
+        m_current = Marker();
+    }
+}
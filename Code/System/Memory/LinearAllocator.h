@@ -0,0 +1,74 @@
+#pragma once
+
+#include "Memory.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+// Linear (bump) Allocator
+//-------------------------------------------------------------------------
+// Hands out memory from a set of fixed size pages by bumping an offset
+// Individual allocations are never freed, the allocator is instead rewound to a previously recorded marker or fully reset
+// Pages are never released on reset so that the steady state has no heap traffic
+// Allocated addresses are stable for the lifetime of the allocation (pages never move)
+// Destructors are NOT called by the allocator, this is the responsibility of the user
+
+namespace EE
+{
+    class EE_SYSTEM_API LinearAllocator
+    {
+    public:
+
+        struct Marker
+        {
+            uint32_t    m_pageIdx = 0;
+            uint32_t    m_offset = 0;
+        };
+
+    public:
+
+        LinearAllocator( size_t pageSize = 8192 );
+        ~LinearAllocator();
+
+        LinearAllocator( LinearAllocator const& ) = delete;
+        LinearAllocator& operator=( LinearAllocator const& ) = delete;
+
+        // Allocate uninitialized memory
+        [[nodiscard]] void* Allocate( size_t size, size_t alignment = EE_DEFAULT_ALIGNMENT );
+
+        // Allocate and construct a new object
+        template< typename T, typename ... ConstructorParams >
+        [[nodiscard]] EE_FORCE_INLINE T* New( ConstructorParams&&... params )
+        {
+            void* pMemory = Allocate( sizeof( T ), alignof( T ) );
+            return new( pMemory ) T( std::forward<ConstructorParams>( params )... );
+        }
+
+        // Get a marker for the current allocation position
+        inline Marker GetMarker() const { return m_current; }
+
+        // Rewind the allocator to a previously recorded marker, all allocations made after the marker are invalidated
+        void RollbackToMarker( Marker const& marker );
+
+        // Rewind the allocator to the start, all allocations are invalidated
+        void Reset();
+
+        // Release all allocated pages
+        void ReleaseMemory();
+
+        // Stats
+        //-------------------------------------------------------------------------
+
+        inline size_t GetPageSize() const { return m_pageSize; }
+        inline size_t GetNumPages() const { return m_pages.size(); }
+        inline size_t GetReservedMemory() const { return m_pages.size() * m_pageSize; }
+        inline size_t GetUsedMemory() const { return ( m_current.m_pageIdx * m_pageSize ) + m_current.m_offset; }
+        inline size_t GetHighWaterMark() const { return m_highWaterMark; }
+
+    private:
+
+        TInlineVector<uint8_t*, 4>          m_pages;
+        size_t const                        m_pageSize;
+        Marker                              m_current;
+        size_t                              m_highWaterMark = 0;
+    };
+}
@@ -0,0 +1,273 @@
+#include "ResourceArchive.h"
+#include "ResourceCompression.h"
+#include "System/FileSystem/FileStreams.h"
+#include "System/FileSystem/FileSystemUtils.h"
+#include "System/Math/Math.h"
+#include "System/Log.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    bool ResourceArchive::Open( FileSystem::Path const& archivePath )
+    {
+        EE_ASSERT( !IsOpen() );
+        EE_ASSERT( archivePath.IsFilePath() );
+
+        if ( !m_file.Open( archivePath.c_str() ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to map archive: %s", archivePath.c_str() );
+            return false;
+        }
+
+        // Validate header
+        //-------------------------------------------------------------------------
+
+        auto pHeader = reinterpret_cast<ResourceArchiveHeader const*>( m_file.GetData() );
+        if ( m_file.GetSize() < sizeof( ResourceArchiveHeader ) || pHeader->m_magic != ResourceArchiveHeader::s_magic )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Invalid resource archive: %s", archivePath.c_str() );
+            m_file.Close();
+            return false;
+        }
+
+        if ( pHeader->m_version != ResourceArchiveHeader::s_version )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Resource archive version mismatch (%u, expected %u): %s", pHeader->m_version, ResourceArchiveHeader::s_version, archivePath.c_str() );
+            m_file.Close();
+            return false;
+        }
+
+        // All range checks are written as "offset <= fileSize && size <= fileSize - offset" so that corrupt values cannot overflow
+        uint64_t const fileSize = m_file.GetSize();
+        uint64_t const tableOfContentsSize = uint64_t( pHeader->m_numEntries ) * sizeof( ResourceArchiveEntry );
+        if ( pHeader->m_tableOfContentsOffset < sizeof( ResourceArchiveHeader ) || pHeader->m_tableOfContentsOffset > fileSize || tableOfContentsSize > fileSize - pHeader->m_tableOfContentsOffset )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Archive", "Corrupt resource archive table of contents: %s", archivePath.c_str() );
+            m_file.Close();
+            return false;
+        }
+
+        // Validate entries
+        //-------------------------------------------------------------------------
+
+        auto pEntries = reinterpret_cast<ResourceArchiveEntry const*>( m_file.GetData() + pHeader->m_tableOfContentsOffset );
+        for ( uint32_t i = 0; i < pHeader->m_numEntries; i++ )
+        {
+            ResourceArchiveEntry const& entry = pEntries[i];
+            if ( entry.m_offset > fileSize || entry.m_size > fileSize - entry.m_offset )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Archive", "Corrupt resource archive entry %u (data outside of the archive): %s", i, archivePath.c_str() );
+                m_file.Close();
+                return false;
+            }
+        }
+
+        //-------------------------------------------------------------------------
+
+        m_path = archivePath;
+        m_pEntries = pEntries;
+        m_numEntries = pHeader->m_numEntries;
+        return true;
+    }
+
+    void ResourceArchive::Close()
+    {
+        m_file.Close();
+        m_path.Clear();
+        m_pEntries = nullptr;
+        m_numEntries = 0;
+    }
+
+    ResourceArchiveEntry const* ResourceArchive::FindEntry( ResourceID const& resourceID ) const
+    {
+        EE_ASSERT( IsOpen() );
+        EE_ASSERT( resourceID.IsValid() );
+
+        uint32_t const pathID = resourceID.GetPathID();
+
+        int32_t low = 0;
+        int32_t high = int32_t( m_numEntries ) - 1;
+        while ( low <= high )
+        {
+            int32_t const mid = low + ( ( high - low ) >> 1 );
+            uint32_t const midPathID = m_pEntries[mid].m_resourcePathID;
+
+            if ( midPathID == pathID )
+            {
+                return &m_pEntries[mid];
+            }
+            else if ( midPathID < pathID )
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid - 1;
+            }
+        }
+
+        return nullptr;
+    }
+
+    //-------------------------------------------------------------------------
+
+    void ResourceArchiveWriter::AddResource( ResourceID const& resourceID, FileSystem::Path const& compiledResourcePath )
+    {
+        EE_ASSERT( resourceID.IsValid() && compiledResourcePath.IsFilePath() );
+        m_resources.push_back( { resourceID, compiledResourcePath } );
+    }
+
+    FileSystem::Path ResourceArchiveWriter::GetArchivePath( FileSystem::Path const& directoryPath, int32_t archiveIdx )
+    {
+        EE_ASSERT( directoryPath.IsDirectoryPath() && archiveIdx >= 0 );
+        return directoryPath + String( String::CtorSprintf(), "Resources%02d.%s", archiveIdx, ResourceArchive::s_extension );
+    }
+
+    bool ResourceArchiveWriter::Write( FileSystem::Path const& outputDirectoryPath ) const
+    {
+        EE_ASSERT( outputDirectoryPath.IsDirectoryPath() );
+
+        // Sort resources by path ID, the runtime lookup relies on this
+        //-------------------------------------------------------------------------
+
+        TVector<ResourceToWrite> sortedResources = m_resources;
+        eastl::sort( sortedResources.begin(), sortedResources.end(), [] ( ResourceToWrite const& a, ResourceToWrite const& b ) { return a.m_resourceID.GetPathID() < b.m_resourceID.GetPathID(); } );
+
+        int32_t const numResources = (int32_t) sortedResources.size();
+        for ( int32_t i = numResources - 1; i > 0; i-- )
+        {
+            if ( sortedResources[i].m_resourceID == sortedResources[i - 1].m_resourceID )
+            {
+                // Same path hash with a different path is a hash collision and can never be resolved at runtime
+                if ( sortedResources[i].m_resourceID.GetResourcePath().GetString() != sortedResources[i - 1].m_resourceID.GetResourcePath().GetString() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Archive", "Resource path ID collision between %s and %s", sortedResources[i].m_resourceID.c_str(), sortedResources[i - 1].m_resourceID.c_str() );
+                    return false;
+                }
+
+                sortedResources.erase( sortedResources.begin() + i );
+            }
+        }
+
+        // Remove any stale archives
+        //-------------------------------------------------------------------------
+
+        TVector<FileSystem::Path> existingArchives;
+        if ( FileSystem::GetDirectoryContents( outputDirectoryPath, existingArchives, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::DontExpand, { ResourceArchive::s_extension } ) )
+        {
+            for ( auto const& archivePath : existingArchives )
+            {
+                FileSystem::EraseFile( archivePath );
+            }
+        }
+
+        // Write archives
+        //-------------------------------------------------------------------------
+
+        int32_t archiveIdx = 0;
+        int32_t numResourcesWritten = 0;
+        while ( numResourcesWritten < (int32_t) sortedResources.size() )
+        {
+            FileSystem::Path const archivePath = GetArchivePath( outputDirectoryPath, archiveIdx );
+            int32_t const numWritten = WriteArchive( archivePath, sortedResources.data() + numResourcesWritten, (int32_t) sortedResources.size() - numResourcesWritten );
+            if ( numWritten <= 0 )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to write resource archive: %s", archivePath.c_str() );
+                return false;
+            }
+
+            numResourcesWritten += numWritten;
+            archiveIdx++;
+        }
+
+        EE_LOG_MESSAGE( "Resource", "Resource Archive", "Packaged %d resources into %d archive(s)", numResourcesWritten, archiveIdx );
+        return true;
+    }
+
+    int32_t ResourceArchiveWriter::WriteArchive( FileSystem::Path const& archivePath, ResourceToWrite const* pResources, int32_t numResources ) const
+    {
+        EE_ASSERT( pResources != nullptr && numResources > 0 );
+
+        FileSystem::OutputFileStream archiveFile( archivePath );
+        if ( !archiveFile.IsValid() )
+        {
+            return -1;
+        }
+
+        std::ofstream& stream = archiveFile.GetStream();
+
+        // Reserve space for the header, it is written once the table of contents location is known
+        ResourceArchiveHeader header;
+        stream.write( (char const*) &header, sizeof( ResourceArchiveHeader ) );
+
+        // Write resource data
+        //-------------------------------------------------------------------------
+
+        static uint8_t const s_paddingBytes[s_dataAlignment] = { 0 };
+
+        TVector<ResourceArchiveEntry> entries;
+        uint64_t currentOffset = sizeof( ResourceArchiveHeader );
+        Blob resourceData;
+
+        for ( int32_t i = 0; i < numResources; i++ )
+        {
+            if ( !FileSystem::LoadFile( pResources[i].m_compiledResourcePath, resourceData ) || resourceData.empty() )
+            {
+                EE_LOG_ERROR( "Resource", "Resource Archive", "Failed to read compiled resource: %s", pResources[i].m_compiledResourcePath.c_str() );
+                return -1;
+            }
+
+            uint64_t const alignedOffset = Math::RoundUpToNearestMultiple64( currentOffset, s_dataAlignment );
+            uint64_t const dataSize = resourceData.size();
+
+            // Start a new archive once this one is full, an archive always contains at least one resource
+            uint64_t const tableOfContentsSize = ( entries.size() + 1 ) * sizeof( ResourceArchiveEntry );
+            if ( !entries.empty() && ( alignedOffset + dataSize + tableOfContentsSize ) > s_maxArchiveSize )
+            {
+                break;
+            }
+
+            EE_ASSERT( dataSize <= UINT32_MAX );
+            stream.write( (char const*) s_paddingBytes, alignedOffset - currentOffset );
+            stream.write( (char const*) resourceData.data(), dataSize );
+            currentOffset = alignedOffset + dataSize;
+
+            auto& entry = entries.emplace_back();
+            entry.m_offset = alignedOffset;
+            entry.m_resourcePathID = pResources[i].m_resourceID.GetPathID();
+            entry.m_size = (uint32_t) dataSize;
+
+            if ( ResourceCompression::IsCompressed( resourceData.data(), resourceData.size() ) )
+            {
+                entry.m_uncompressedSize = (uint32_t) ResourceCompression::GetUncompressedSize( resourceData.data(), resourceData.size() );
+                entry.m_compression = ResourceArchiveCompression::LZ4Blocks;
+            }
+            else
+            {
+                entry.m_uncompressedSize = (uint32_t) dataSize;
+                entry.m_compression = ResourceArchiveCompression::None;
+            }
+        }
+
+        // Write table of contents and patch the header
+        //-------------------------------------------------------------------------
+
+        uint64_t const tableOfContentsOffset = Math::RoundUpToNearestMultiple64( currentOffset, s_dataAlignment );
+        stream.write( (char const*) s_paddingBytes, tableOfContentsOffset - currentOffset );
+        stream.write( (char const*) entries.data(), entries.size() * sizeof( ResourceArchiveEntry ) );
+
+        header.m_numEntries = (uint32_t) entries.size();
+        header.m_tableOfContentsOffset = tableOfContentsOffset;
+        stream.seekp( 0 );
+        stream.write( (char const*) &header, sizeof( ResourceArchiveHeader ) );
+
+        if ( stream.fail() )
+        {
+            return -1;
+        }
+
+        archiveFile.Close();
+        return (int32_t) entries.size();
+    }
+}
\ No newline at end of file
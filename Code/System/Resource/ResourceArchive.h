@@ -0,0 +1,126 @@
+#pragma once
+
+#include "ResourceID.h"
+#include "System/FileSystem/FileSystem.h"
+#include "System/FileSystem/FileSystemPath.h"
+
+//-------------------------------------------------------------------------
+// Resource Archive
+//-------------------------------------------------------------------------
+// Packaged builds store all compiled resources in one or more large archive files rather than as thousands of loose files
+// Each archive starts with a header, followed by the resource data and finally a table of contents sorted by resource path ID
+// Archives are memory mapped at runtime so resource data can be handed directly to the loaders without any copies
+
+namespace EE::Resource
+{
+    enum class ResourceArchiveCompression : uint8_t
+    {
+        None = 0,
+        LZ4Blocks,      // Block compressed resource (see ResourceCompression.h), decompressed by the resource request
+    };
+
+    //-------------------------------------------------------------------------
+
+    struct ResourceArchiveHeader
+    {
+        constexpr static uint32_t const s_magic = 'EARC';
+        constexpr static uint32_t const s_version = 1;
+
+    public:
+
+        uint32_t                        m_magic = s_magic;
+        uint32_t                        m_version = s_version;
+        uint32_t                        m_numEntries = 0;
+        uint32_t                        m_reserved = 0;
+        uint64_t                        m_tableOfContentsOffset = 0;
+    };
+
+    static_assert( sizeof( ResourceArchiveHeader ) == 24, "Resource archive header size is part of the file format" );
+
+    //-------------------------------------------------------------------------
+
+    struct ResourceArchiveEntry
+    {
+        uint64_t                        m_offset = 0;               // Offset from the start of the archive file
+        uint32_t                        m_resourcePathID = 0;       // The ID of the resource path, entries are sorted on this
+        uint32_t                        m_size = 0;                 // The size of the data stored in the archive
+        uint32_t                        m_uncompressedSize = 0;     // The size of the compiled resource once decompressed
+        ResourceArchiveCompression      m_compression = ResourceArchiveCompression::None;
+        uint8_t                         m_padding[3] = { 0, 0, 0 };
+    };
+
+    static_assert( sizeof( ResourceArchiveEntry ) == 24, "Resource archive entry size is part of the file format" );
+
+    //-------------------------------------------------------------------------
+
+    class EE_SYSTEM_API ResourceArchive
+    {
+    public:
+
+        constexpr static char const* const s_extension = "earc";
+
+    public:
+
+        bool Open( FileSystem::Path const& archivePath );
+        void Close();
+
+        inline bool IsOpen() const { return m_file.IsOpen(); }
+        inline FileSystem::Path const& GetPath() const { return m_path; }
+        inline uint32_t GetNumEntries() const { return m_numEntries; }
+
+        // Binary search of the table of contents, returns nullptr if this archive doesnt contain the resource
+        ResourceArchiveEntry const* FindEntry( ResourceID const& resourceID ) const;
+
+        // Get the stored data for an entry, this points directly into the mapped archive
+        inline uint8_t const* GetEntryData( ResourceArchiveEntry const* pEntry ) const
+        {
+            EE_ASSERT( pEntry >= m_pEntries && pEntry < m_pEntries + m_numEntries );
+            return m_file.GetData() + pEntry->m_offset;
+        }
+
+    private:
+
+        FileSystem::Path                m_path;
+        FileSystem::MemoryMappedFile    m_file;
+        ResourceArchiveEntry const*     m_pEntries = nullptr;
+        uint32_t                        m_numEntries = 0;
+    };
+
+    //-------------------------------------------------------------------------
+
+    class EE_SYSTEM_API ResourceArchiveWriter
+    {
+    public:
+
+        // The resources will be split across multiple archives if they exceed this size
+        constexpr static uint64_t const s_maxArchiveSize = 2ull * 1024 * 1024 * 1024;
+
+        // The alignment of each resource's data within the archive
+        constexpr static uint64_t const s_dataAlignment = 16;
+
+    public:
+
+        // Add a compiled resource file to the archive
+        void AddResource( ResourceID const& resourceID, FileSystem::Path const& compiledResourcePath );
+
+        // Write all added resources into one or more archives in the specified directory, any existing archives in the directory are removed
+        bool Write( FileSystem::Path const& outputDirectoryPath ) const;
+
+        static FileSystem::Path GetArchivePath( FileSystem::Path const& directoryPath, int32_t archiveIdx );
+
+    private:
+
+        struct ResourceToWrite
+        {
+            ResourceID                  m_resourceID;
+            FileSystem::Path            m_compiledResourcePath;
+        };
+
+        // Writes resources to the archive until either all resources are written or the archive is full, returns the number of resources written or -1 on failure
+        int32_t WriteArchive( FileSystem::Path const& archivePath, ResourceToWrite const* pResources, int32_t numResources ) const;
+
+    private:
+
+        TVector<ResourceToWrite>        m_resources;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,212 @@
+#include "ResourceCompression.h"
+#include "System/Algorithm/Compression.h"
+#include "System/Threading/TaskSystem.h"
+#include "System/Math/Math.h"
+#include "System/Profiling.h"
+#include <atomic>
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource::ResourceCompression
+{
+    static CompressedResourceHeader const* GetHeader( uint8_t const* pData, size_t dataSize )
+    {
+        if ( pData == nullptr || dataSize < sizeof( CompressedResourceHeader ) )
+        {
+            return nullptr;
+        }
+
+        auto pHeader = reinterpret_cast<CompressedResourceHeader const*>( pData );
+        if ( pHeader->m_magic != CompressedResourceHeader::s_magic || pHeader->m_version != CompressedResourceHeader::s_version )
+        {
+            return nullptr;
+        }
+
+        return pHeader;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool IsCompressed( uint8_t const* pData, size_t dataSize )
+    {
+        return GetHeader( pData, dataSize ) != nullptr;
+    }
+
+    size_t GetUncompressedSize( uint8_t const* pData, size_t dataSize )
+    {
+        auto pHeader = GetHeader( pData, dataSize );
+        EE_ASSERT( pHeader != nullptr );
+        return pHeader->m_uncompressedSize;
+    }
+
+    bool Compress( uint8_t const* pData, size_t dataSize, uint32_t blockSize, Blob& outCompressedData )
+    {
+        EE_ASSERT( pData != nullptr && dataSize > 0 && dataSize <= UINT32_MAX );
+        EE_ASSERT( blockSize >= s_minBlockSize && blockSize <= s_maxBlockSize );
+
+        CompressedResourceHeader header;
+        header.m_uncompressedSize = (uint32_t) dataSize;
+        header.m_blockSize = blockSize;
+        header.m_numBlocks = (uint32_t) ( ( dataSize + blockSize - 1 ) / blockSize );
+
+        size_t const blockTableSize = header.m_numBlocks * sizeof( uint32_t );
+        size_t const dataOffset = sizeof( CompressedResourceHeader ) + blockTableSize;
+
+        // Reserve the worst case size so that we can compress directly into the output
+        outCompressedData.resize( dataOffset + Compression::LZ4::GetMaxCompressedSize( blockSize ) * header.m_numBlocks );
+        memcpy( outCompressedData.data(), &header, sizeof( CompressedResourceHeader ) );
+
+        uint32_t* pBlockSizes = reinterpret_cast<uint32_t*>( outCompressedData.data() + sizeof( CompressedResourceHeader ) );
+        size_t currentOffset = dataOffset;
+
+        for ( uint32_t i = 0; i < header.m_numBlocks; i++ )
+        {
+            uint8_t const* pBlockData = pData + size_t( i ) * blockSize;
+            size_t const uncompressedBlockSize = Math::Min( size_t( blockSize ), dataSize - size_t( i ) * blockSize );
+
+            uint8_t* pOutput = outCompressedData.data() + currentOffset;
+            size_t const compressedBlockSize = Compression::LZ4::Compress( pBlockData, uncompressedBlockSize, pOutput, outCompressedData.size() - currentOffset );
+
+            // Store incompressible blocks as is
+            if ( compressedBlockSize == 0 || compressedBlockSize >= uncompressedBlockSize )
+            {
+                memcpy( pOutput, pBlockData, uncompressedBlockSize );
+                pBlockSizes[i] = uint32_t( uncompressedBlockSize ) | CompressedResourceHeader::s_storedUncompressedFlag;
+                currentOffset += uncompressedBlockSize;
+            }
+            else
+            {
+                pBlockSizes[i] = uint32_t( compressedBlockSize );
+                currentOffset += compressedBlockSize;
+            }
+        }
+
+        outCompressedData.resize( currentOffset );
+        return currentOffset < dataSize;
+    }
+
+    bool Decompress( uint8_t const* pCompressedData, size_t compressedDataSize, Blob& outData, TaskSystem* pTaskSystem )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+
+        auto pHeader = GetHeader( pCompressedData, compressedDataSize );
+        if ( pHeader == nullptr )
+        {
+            return false;
+        }
+
+        // The header comes from disk so validate it fully, the block layout needs to exactly cover the uncompressed data
+        size_t const blockSize = pHeader->m_blockSize;
+        size_t const uncompressedSize = pHeader->m_uncompressedSize;
+        size_t const numBlocks = pHeader->m_numBlocks;
+        if ( blockSize < s_minBlockSize || blockSize > s_maxBlockSize || numBlocks != ( uncompressedSize + blockSize - 1 ) / blockSize )
+        {
+            return false;
+        }
+
+        size_t const blockTableSize = numBlocks * sizeof( uint32_t );
+        size_t const dataOffset = sizeof( CompressedResourceHeader ) + blockTableSize;
+        if ( dataOffset > compressedDataSize )
+        {
+            return false;
+        }
+
+        // Calculate the block offsets
+        //-------------------------------------------------------------------------
+
+        struct Block
+        {
+            size_t          m_compressedOffset;
+            uint32_t        m_compressedSize;
+            bool            m_isStoredUncompressed;
+        };
+
+        uint32_t const* pBlockSizes = reinterpret_cast<uint32_t const*>( pCompressedData + sizeof( CompressedResourceHeader ) );
+
+        TVector<Block> blocks;
+        blocks.resize( numBlocks );
+
+        size_t currentOffset = dataOffset;
+        for ( size_t i = 0; i < numBlocks; i++ )
+        {
+            blocks[i].m_compressedOffset = currentOffset;
+            blocks[i].m_compressedSize = pBlockSizes[i] & ~CompressedResourceHeader::s_storedUncompressedFlag;
+            blocks[i].m_isStoredUncompressed = ( pBlockSizes[i] & CompressedResourceHeader::s_storedUncompressedFlag ) != 0;
+            currentOffset += blocks[i].m_compressedSize;
+        }
+
+        if ( currentOffset != compressedDataSize )
+        {
+            return false;
+        }
+
+        // Decompress blocks
+        //-------------------------------------------------------------------------
+
+        outData.resize( uncompressedSize );
+
+        struct DecompressionTask final : public ITaskSet
+        {
+            DecompressionTask( size_t blockSize, uint8_t const* pCompressedData, TVector<Block> const& blocks, Blob& outData )
+                : m_blockSize( blockSize )
+                , m_pCompressedData( pCompressedData )
+                , m_blocks( blocks )
+                , m_outData( outData )
+            {
+                m_SetSize = (uint32_t) blocks.size();
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                EE_PROFILE_SCOPE_RESOURCE( "Decompress Resource Blocks" );
+
+                for ( uint64_t i = range.start; i < range.end; ++i )
+                {
+                    Block const& block = m_blocks[i];
+                    uint8_t const* pBlockData = m_pCompressedData + block.m_compressedOffset;
+                    size_t const outputOffset = size_t( i ) * m_blockSize;
+                    EE_ASSERT( outputOffset < m_outData.size() );
+                    uint8_t* pOutput = m_outData.data() + outputOffset;
+                    size_t const uncompressedBlockSize = Math::Min( m_blockSize, m_outData.size() - outputOffset );
+
+                    if ( block.m_isStoredUncompressed )
+                    {
+                        if ( block.m_compressedSize != uncompressedBlockSize )
+                        {
+                            m_failed = true;
+                            continue;
+                        }
+
+                        memcpy( pOutput, pBlockData, uncompressedBlockSize );
+                    }
+                    else if ( !Compression::LZ4::Decompress( pBlockData, block.m_compressedSize, pOutput, uncompressedBlockSize ) )
+                    {
+                        m_failed = true;
+                    }
+                }
+            }
+
+        public:
+
+            size_t                                  m_blockSize;
+            uint8_t const*                          m_pCompressedData;
+            TVector<Block> const&                   m_blocks;
+            Blob&                                   m_outData;
+            std::atomic<bool>                       m_failed = false;
+        };
+
+        DecompressionTask task( blockSize, pCompressedData, blocks, outData );
+
+        if ( pTaskSystem != nullptr && blocks.size() > 1 )
+        {
+            pTaskSystem->ScheduleTask( &task );
+            pTaskSystem->WaitForTask( &task );
+        }
+        else
+        {
+            task.ExecuteRange( TaskSetPartition{ 0, task.m_SetSize }, 0 );
+        }
+
+        return !task.m_failed;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "System/_Module/API.h"
+#include "System/Types/Arrays.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+// Block Compressed Resources
+//-------------------------------------------------------------------------
+// Compiled resources can optionally be stored block compressed
+// The data is split into fixed size blocks that are compressed independently so that they can be decompressed in parallel
+//
+// Layout: header | compressed size per block | block data
+// Blocks that dont compress are stored as is and are flagged in the block size table
+
+namespace EE::Resource
+{
+    struct CompressedResourceHeader
+    {
+        // The first byte (0xC1) is never used by MessagePack so a compressed resource can never be confused with an uncompressed one
+        constexpr static uint32_t const s_magic = 0x434245C1;
+        constexpr static uint32_t const s_version = 1;
+        constexpr static uint32_t const s_storedUncompressedFlag = 0x80000000;
+
+    public:
+
+        uint32_t                m_magic = s_magic;
+        uint32_t                m_version = s_version;
+        uint32_t                m_uncompressedSize = 0;
+        uint32_t                m_blockSize = 0;
+        uint32_t                m_numBlocks = 0;
+        uint32_t                m_reserved = 0;
+    };
+
+    static_assert( sizeof( CompressedResourceHeader ) == 24, "Compressed resource header size is part of the file format" );
+
+    //-------------------------------------------------------------------------
+
+    namespace ResourceCompression
+    {
+        constexpr static uint32_t const s_minBlockSize = 64 * 1024;
+        constexpr static uint32_t const s_maxBlockSize = 256 * 1024;
+        constexpr static uint32_t const s_defaultBlockSize = 128 * 1024;
+
+        // Is this a block compressed resource
+        EE_SYSTEM_API bool IsCompressed( uint8_t const* pData, size_t dataSize );
+
+        // Get the size of the resource once decompressed, only valid for compressed resources
+        EE_SYSTEM_API size_t GetUncompressedSize( uint8_t const* pData, size_t dataSize );
+
+        // Block compress the supplied data, returns false if compressing the data doesnt save any space
+        EE_SYSTEM_API bool Compress( uint8_t const* pData, size_t dataSize, uint32_t blockSize, Blob& outCompressedData );
+
+        // Decompress a block compressed resource, if a task system is supplied the blocks are decompressed in parallel
+        EE_SYSTEM_API bool Decompress( uint8_t const* pCompressedData, size_t compressedDataSize, Blob& outData, TaskSystem* pTaskSystem = nullptr );
+    }
+}
\ No newline at end of file
@@ -7,10 +7,16 @@
 
 namespace EE::Resource
 {
-    bool ResourceLoader::Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const
+    bool ResourceLoader::Load( ResourceID const& resourceID, uint8_t const* pRawData, size_t rawDataSize, ResourceRecord* pResourceRecord ) const
     {
+        if ( pRawData == nullptr || rawDataSize == 0 )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Loader", "Compiled resource data is empty: %s", resourceID.c_str() );
+            return false;
+        }
+
         Serialization::BinaryInputArchive archive;
-        archive.ReadFromBlob( rawData );
+        archive.ReadFromData( pRawData, rawDataSize );
 
         // Read resource header
         Resource::ResourceHeader header;
@@ -34,6 +40,8 @@ namespace EE::Resource
         // This is enforced to prevent leaks from occurring when a loader allocates a resource, then tries to 
         // load it unsuccessfully and then forgets to release the allocated data.
         EE_ASSERT( pResourceRecord->GetResourceData() != nullptr );
+
+        pResourceRecord->m_memorySize = CalculateMemorySize( resourceID, pResourceRecord, rawDataSize );
         return true;
     }
 
@@ -58,6 +66,7 @@ namespace EE::Resource
         EE_ASSERT( pResourceRecord->IsUnloading() || pResourceRecord->HasLoadingFailed() );
         UnloadInternal( resourceID, pResourceRecord );
         pResourceRecord->m_installDependencyResourceIDs.clear();
+        pResourceRecord->m_memorySize = 0;
     }
 
     void ResourceLoader::UnloadInternal( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const
@@ -54,7 +54,8 @@ namespace EE
             TVector<ResourceTypeID> const& GetLoadableTypes() const { return m_loadableTypes; }
 
             // This function loads is responsible to deserialize the compiled resource data, read the resource header for install dependencies and to create the new runtime resource object
-            bool Load( ResourceID const& resourceID, Blob& rawData, ResourceRecord* pResourceRecord ) const;
+            // The raw data is only guaranteed to be valid for the duration of this call (it may point directly into a memory mapped archive)
+            bool Load( ResourceID const& resourceID, uint8_t const* pRawData, size_t rawDataSize, ResourceRecord* pResourceRecord ) const;
 
             // This function will destroy the created resource object
             void Unload( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const;
@@ -76,6 +77,10 @@ namespace EE
             // (Optional) Override this function to implement any custom object destruction logic if needed, by default this will just delete the created resource
             virtual void UnloadInternal( ResourceID const& resourceID, ResourceRecord* pResourceRecord ) const;
 
+            // (Optional) Override this function to report the memory used by a loaded resource, by default this is the size of the compiled resource data
+            // This is used for the per-type memory budgets of the resource system, so should include any memory allocated outside the resource object (e.g. GPU memory)
+            virtual size_t CalculateMemorySize( ResourceID const& resourceID, ResourceRecord const* pResourceRecord, size_t rawDataSize ) const { return rawDataSize; }
+
         protected:
 
             TVector<ResourceTypeID>          m_loadableTypes;
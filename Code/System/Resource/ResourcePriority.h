@@ -0,0 +1,37 @@
+#pragma once
+
+#include "System/Esoterica.h"
+
+//-------------------------------------------------------------------------
+
+namespace EE::Resource
+{
+    //-------------------------------------------------------------------------
+    // The priority with which a resource request is scheduled
+    //-------------------------------------------------------------------------
+    // Lower values are more urgent. Requests are read and loaded in priority order, requests of the same priority are processed in the order they were made.
+    // Install dependencies are loaded with the priority of the resource that depends on them.
+
+    enum class ResourcePriority : uint8_t
+    {
+        Critical = 0,   // Gameplay critical data (e.g. the player's animation graph), ignores the in-flight read budget
+        High,           // Visible or nearby data
+        Normal,
+        Low,            // Distant data
+        Background,     // Speculative loads, e.g. data we might need soon
+
+        NumPriorities
+    };
+
+    //-------------------------------------------------------------------------
+
+    #if EE_DEVELOPMENT_TOOLS
+    inline char const* GetPriorityName( ResourcePriority priority )
+    {
+        constexpr static char const* const s_names[] = { "Critical", "High", "Normal", "Low", "Background" };
+        static_assert( sizeof( s_names ) / sizeof( s_names[0] ) == (size_t) ResourcePriority::NumPriorities, "Priority name list is out of sync" );
+        EE_ASSERT( priority < ResourcePriority::NumPriorities );
+        return s_names[(uint8_t) priority];
+    }
+    #endif
+}
\ No newline at end of file
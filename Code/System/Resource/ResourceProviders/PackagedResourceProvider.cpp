@@ -1,12 +1,18 @@
 #include "PackagedResourceProvider.h"
 #include "System/Resource/ResourceRequest.h"
 #include "System/Resource/ResourceSettings.h"
+#include "System/FileSystem/FileSystemUtils.h"
 #include "System/Log.h"
 
 //-------------------------------------------------------------------------
 
 namespace EE::Resource
 {
+    PackagedResourceProvider::~PackagedResourceProvider()
+    {
+        EE_ASSERT( m_archives.empty() );
+    }
+
     bool PackagedResourceProvider::IsReady() const
     {
         return true;
@@ -14,12 +20,68 @@ namespace EE::Resource
 
     bool PackagedResourceProvider::Initialize()
     {
+        // Map all resource archives, its perfectly valid to have no archives and only loose files
+        //-------------------------------------------------------------------------
+
+        TVector<FileSystem::Path> archivePaths;
+        if ( FileSystem::GetDirectoryContents( m_settings.m_compiledResourcePath, archivePaths, FileSystem::DirectoryReaderOutput::OnlyFiles, FileSystem::DirectoryReaderMode::DontExpand, { ResourceArchive::s_extension } ) )
+        {
+            for ( auto const& archivePath : archivePaths )
+            {
+                auto pArchive = EE::New<ResourceArchive>();
+                if ( pArchive->Open( archivePath ) )
+                {
+                    m_archives.emplace_back( pArchive );
+                }
+                else
+                {
+                    EE::Delete( pArchive );
+                    Shutdown();
+                    return false;
+                }
+            }
+        }
+
         return true;
     }
 
+    void PackagedResourceProvider::Shutdown()
+    {
+        for ( auto& pArchive : m_archives )
+        {
+            pArchive->Close();
+            EE::Delete( pArchive );
+        }
+
+        m_archives.clear();
+    }
+
     void PackagedResourceProvider::RequestRawResource( ResourceRequest* pRequest )
     {
-        FileSystem::Path const resourceFilePath = pRequest->GetResourceID().GetResourcePath().ToFileSystemPath( m_settings.m_compiledResourcePath );
+        ResourceID const& resourceID = pRequest->GetResourceID();
+
+        for ( auto pArchive : m_archives )
+        {
+            ResourceArchiveEntry const* pEntry = pArchive->FindEntry( resourceID );
+            if ( pEntry == nullptr )
+            {
+                continue;
+            }
+
+            // Block compressed resources are self-describing and are decompressed by the request itself
+            if ( pEntry->m_compression != ResourceArchiveCompression::None && pEntry->m_compression != ResourceArchiveCompression::LZ4Blocks )
+            {
+                EE_LOG_ERROR( "Resource", "Packaged Resource Provider", "Unsupported compression for resource: %s", resourceID.c_str() );
+                pRequest->OnRawResourceRequestComplete( nullptr, 0 );
+                return;
+            }
+
+            pRequest->OnRawResourceRequestComplete( pArchive->GetEntryData( pEntry ), pEntry->m_size );
+            return;
+        }
+
+        // Fallback to loose files
+        FileSystem::Path const resourceFilePath = resourceID.GetResourcePath().ToFileSystemPath( m_settings.m_compiledResourcePath );
         pRequest->OnRawResourceRequestComplete( resourceFilePath.c_str() );
     }
 
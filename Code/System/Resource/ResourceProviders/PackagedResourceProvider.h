@@ -1,6 +1,7 @@
 #pragma once
 
 #include "System/Resource/ResourceProvider.h"
+#include "System/Resource/ResourceArchive.h"
 
 //-------------------------------------------------------------------------
 
@@ -10,18 +11,26 @@ namespace EE::Resource
 
     //-------------------------------------------------------------------------
 
+    // Provides resources from the packaged resource archives, resources not present in any archive are loaded from loose compiled files
     class EE_SYSTEM_API PackagedResourceProvider final : public ResourceProvider
     {
 
     public:
 
         PackagedResourceProvider( ResourceSettings const& settings ) : ResourceProvider( settings ) {}
+        ~PackagedResourceProvider();
+
         virtual bool IsReady() const override final;
 
     private:
 
         virtual bool Initialize() override;
+        virtual void Shutdown() override;
         virtual void RequestRawResource( ResourceRequest* pRequest ) override;
         virtual void CancelRequest( ResourceRequest* pRequest ) override;
+
+    private:
+
+        TVector<ResourceArchive*>       m_archives;
     };
 }
\ No newline at end of file
@@ -68,10 +68,14 @@ namespace EE::Resource
 
         inline TInlineVector<ResourceID, 4> const& GetInstallDependencies() const { return m_installDependencyResourceIDs; }
 
+        // The memory used by the loaded resource as reported by its loader, only valid while the resource is loaded
+        inline size_t GetMemorySize() const { return m_memorySize; }
+
         //-------------------------------------------------------------------------
 
         #if EE_DEVELOPMENT_TOOLS
         inline Milliseconds GetFileReadTime() const { return m_fileReadTime; }
+        inline Milliseconds GetDecompressionTime() const { return m_decompressionTime; }
         inline Milliseconds GetLoadTime() const { return m_loadTime; }
         inline Milliseconds GetDependenciesWaitTime() const { return m_waitForDependenciesTime; }
         inline Milliseconds GetInstallTime() const { return m_installTime; }
@@ -84,12 +88,16 @@ namespace EE::Resource
         std::atomic<LoadingStatus>              m_loadingStatus = LoadingStatus::Unloaded;      // The state of this resource (atomic since it will be modify by resource requests which run across multiple frames)
         TVector<ResourceRequesterID>            m_references;                                   // The list of references to this resources
         TInlineVector<ResourceID, 4>            m_installDependencyResourceIDs;                 // The list of resources that need to be loaded and installed before we can install this resource
+        size_t                                  m_memorySize = 0;                               // The memory used by the loaded resource, set by the loader
+        size_t                                  m_accountedMemorySize = 0;                      // The memory size currently included in the resource system's per-type memory stats (only accessed by the resource system on the main thread)
 
         #if EE_DEVELOPMENT_TOOLS
         Milliseconds                            m_fileReadTime = 0;
+        Milliseconds                            m_decompressionTime = 0;
         Milliseconds                            m_loadTime = 0;
         Milliseconds                            m_waitForDependenciesTime = 0;
         Milliseconds                            m_installTime = 0;
+        bool                                    m_isHotReloadPending = false;                   // Prevents the resource from being kept resident once released, so that it can be reloaded
         #endif
     };
 }
\ No newline at end of file
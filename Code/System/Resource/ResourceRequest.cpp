@@ -1,4 +1,5 @@
 #include "ResourceRequest.h"
+#include "ResourceCompression.h"
 #include "System/FileSystem/FileSystem.h"
 #include "System/Profiling.h"
 #include "System/Threading/Threading.h"
@@ -8,17 +9,23 @@
 
 namespace EE::Resource
 {
-    ResourceRequest::ResourceRequest( ResourceRequesterID const& requesterID, Type type, ResourceRecord* pRecord, ResourceLoader* pResourceLoader )
+    ResourceRequest::ResourceRequest( ResourceRequesterID const& requesterID, Type type, ResourceRecord* pRecord, ResourceLoader* pResourceLoader, ResourcePriority priority )
         : m_requesterID( requesterID )
         , m_pResourceRecord( pRecord )
         , m_pResourceLoader( pResourceLoader )
         , m_type( type )
+        , m_priority( priority )
     {
         EE_ASSERT( Threading::IsMainThread() );
         EE_ASSERT( m_pResourceRecord != nullptr && m_pResourceRecord->IsValid() );
         EE_ASSERT( m_pResourceLoader != nullptr );
         EE_ASSERT( m_type != Type::Invalid );
         EE_ASSERT( !m_pResourceRecord->IsLoading() && !m_pResourceRecord->IsUnloading() );
+        EE_ASSERT( m_priority < ResourcePriority::NumPriorities );
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_requestTimer.Start();
+        #endif
 
         if ( m_type == Type::Load )
         {
@@ -56,6 +63,26 @@ namespace EE::Resource
         else // Continue the load operation
         {
             m_rawResourcePath = filePath;
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
+            m_stage = ResourceRequest::Stage::ReadResourceFile;
+        }
+    }
+
+    void ResourceRequest::OnRawResourceRequestComplete( uint8_t const* pRawData, size_t rawDataSize )
+    {
+        // Raw resource failed to load
+        if ( pRawData == nullptr || rawDataSize == 0 )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Request", "Failed to find/compile resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_stage = ResourceRequest::Stage::Complete;
+            m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
+        }
+        else // Continue the load operation
+        {
+            m_rawResourcePath.Clear();
+            m_pRawResourceDataView = pRawData;
+            m_rawResourceDataViewSize = rawDataSize;
             m_stage = ResourceRequest::Stage::LoadResource;
         }
     }
@@ -68,6 +95,10 @@ namespace EE::Resource
         m_type = Type::Load;
         m_pResourceRecord->SetLoadingStatus( LoadingStatus::Loading );
 
+        #if EE_DEVELOPMENT_TOOLS
+        m_requestTimer.Start();
+        #endif
+
         //-------------------------------------------------------------------------
 
         switch ( m_stage )
@@ -115,14 +146,33 @@ namespace EE::Resource
 
         switch ( m_stage )
         {
+            // The request was still queued, so we can simply cancel it
+            case Stage::RequestRawResource:
+            {
+                m_stage = Stage::Complete;
+                m_pResourceRecord->SetLoadingStatus( LoadingStatus::Unloaded );
+            }
+            break;
+
             case Stage::WaitForRawResourceRequest:
             {
                 m_stage = Stage::CancelRawResourceRequest;
             }
             break;
 
+            case Stage::ReadResourceFile:
+            case Stage::WaitForResourceFileRead:
+            {
+                m_fileRead.Cancel();
+                m_stage = Stage::Complete;
+                m_pResourceRecord->SetLoadingStatus( LoadingStatus::Unloaded );
+            }
+            break;
+
             case Stage::LoadResource:
             {
+                m_fileRead.Cancel();
+                m_rawResourceData.clear();
                 m_stage = Stage::Complete;
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Unloaded );
             }
@@ -175,6 +225,18 @@ namespace EE::Resource
             }
             break;
 
+            case ResourceRequest::Stage::ReadResourceFile:
+            {
+                ReadResourceFile( requestContext );
+            }
+            break;
+
+            case ResourceRequest::Stage::WaitForResourceFileRead:
+            {
+                WaitForResourceFileRead( requestContext );
+            }
+            break;
+
             case ResourceRequest::Stage::LoadResource:
             {
                 LoadResource( requestContext );
@@ -265,30 +327,98 @@ namespace EE::Resource
         requestContext.m_createRawRequestRequestFunction( this );
     }
 
+    void ResourceRequest::ReadResourceFile( RequestContext& requestContext )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+        EE_ASSERT( m_stage == ResourceRequest::Stage::ReadResourceFile );
+        EE_ASSERT( m_rawResourcePath.IsValid() );
+
+        // Issue the read and return to the request system, the read completes in the background
+        if ( !m_fileRead.Begin( m_rawResourcePath.GetFullPath() ) )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_stage = ResourceRequest::Stage::Complete;
+            m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
+            return;
+        }
+
+        m_stage = ResourceRequest::Stage::WaitForResourceFileRead;
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_stageTimer.Start();
+        #endif
+
+        // Small reads are often already complete, so check immediately rather than waiting for the next update
+        WaitForResourceFileRead( requestContext );
+    }
+
+    void ResourceRequest::WaitForResourceFileRead( RequestContext& requestContext )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+        EE_ASSERT( m_stage == ResourceRequest::Stage::WaitForResourceFileRead );
+
+        auto const status = m_fileRead.Poll();
+        if ( status == FileSystem::AsyncFileRead::Status::Pending )
+        {
+            return;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        m_pResourceRecord->m_fileReadTime = m_stageTimer.GetElapsedTimeMilliseconds();
+        #endif
+
+        if ( status == FileSystem::AsyncFileRead::Status::Failed )
+        {
+            EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
+            m_fileRead.Cancel();
+            m_stage = ResourceRequest::Stage::Complete;
+            m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
+            return;
+        }
+
+        // The read buffer is kept until the resource has been loaded, so the data is loaded in place rather than copied
+        m_pRawResourceDataView = m_fileRead.GetData();
+        m_rawResourceDataViewSize = m_fileRead.GetSize();
+        m_stage = ResourceRequest::Stage::LoadResource;
+    }
+
     void ResourceRequest::LoadResource( RequestContext& requestContext )
     {
         EE_PROFILE_FUNCTION_RESOURCE();
         EE_ASSERT( m_stage == ResourceRequest::Stage::LoadResource );
-        EE_ASSERT( m_rawResourcePath.IsValid() );
 
-        // Read file
+        // The data is a view into either the completed file read's buffer or memory that the provider gave us direct access to
+        // Empty data is not rejected here, the loader will fail to load it
+        uint8_t const* pRawData = ( m_pRawResourceDataView != nullptr ) ? m_pRawResourceDataView : m_rawResourceData.data();
+        size_t rawDataSize = ( m_pRawResourceDataView != nullptr ) ? m_rawResourceDataViewSize : m_rawResourceData.size();
+
+        // Decompress - the blocks of a compressed resource are decompressed in parallel on the task system
         //-------------------------------------------------------------------------
 
+        if ( ResourceCompression::IsCompressed( pRawData, rawDataSize ) )
         {
-            EE_PROFILE_SCOPE_IO( "Read File" );
-            EE_PROFILE_TAG( "filename", m_rawResourcePath.GetFilename().c_str() );
+            EE_PROFILE_SCOPE_RESOURCE( "Decompress Resource" );
 
             #if EE_DEVELOPMENT_TOOLS
-            ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_fileReadTime );
+            ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_decompressionTime );
             #endif
 
-            if ( !FileSystem::LoadFile( m_rawResourcePath, m_rawResourceData ) )
+            Blob decompressedData;
+            if ( !ResourceCompression::Decompress( pRawData, rawDataSize, decompressedData, requestContext.m_pTaskSystem ) )
             {
-                EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load resource file (%s)", m_pResourceRecord->GetResourceID().c_str() );
+                EE_LOG_ERROR( "Resource", "Resource Request", "Failed to decompress resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
                 m_stage = ResourceRequest::Stage::Complete;
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
                 return;
             }
+
+            m_rawResourceData.swap( decompressedData );
+            m_fileRead.Cancel();
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
+
+            pRawData = m_rawResourceData.data();
+            rawDataSize = m_rawResourceData.size();
         }
 
         // Load resource
@@ -304,13 +434,11 @@ namespace EE::Resource
             #endif
 
             // Load the resource
-            EE_ASSERT( !m_rawResourceData.empty() );
-
             #if EE_DEVELOPMENT_TOOLS
             ScopedTimer<PlatformClock> timer( m_pResourceRecord->m_loadTime );
             #endif
 
-            if ( !m_pResourceLoader->Load( GetResourceID(), m_rawResourceData, m_pResourceRecord ) )
+            if ( !m_pResourceLoader->Load( GetResourceID(), pRawData, rawDataSize, m_pResourceRecord ) )
             {
                 EE_LOG_ERROR( "Resource", "Resource Request", "Failed to load compiled resource data (%s)", m_pResourceRecord->GetResourceID().c_str() );
                 m_pResourceRecord->SetLoadingStatus( LoadingStatus::Failed );
@@ -320,7 +448,10 @@ namespace EE::Resource
             }
 
             // Release raw data
+            m_fileRead.Cancel();
             m_rawResourceData.clear();
+            m_pRawResourceDataView = nullptr;
+            m_rawResourceDataViewSize = 0;
         }
 
         // Load dependencies
@@ -336,7 +467,7 @@ namespace EE::Resource
             // Do not use the requester ID for install dependencies! Since they are not explicitly loaded by a specific user!
             // Instead we create a ResourceRequesterID from the depending resource's resourceID
             m_pendingInstallDependencies[i] = ResourcePtr( m_pResourceRecord->m_installDependencyResourceIDs[i] );
-            requestContext.m_loadResourceFunction( installDependencyRequesterID, m_pendingInstallDependencies[i] );
+            requestContext.m_loadResourceFunction( installDependencyRequesterID, m_pendingInstallDependencies[i], m_priority );
         }
 
         m_stage = ResourceRequest::Stage::WaitForLoadDependencies;
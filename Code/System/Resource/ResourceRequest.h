@@ -2,11 +2,17 @@
 
 #include "ResourceRecord.h"
 #include "ResourceLoader.h"
+#include "ResourcePriority.h"
+#include "System/FileSystem/FileSystem.h"
 #include "System/Types/Function.h"
 #include "System/Time/Timers.h"
 
 //-------------------------------------------------------------------------
 
+namespace EE { class TaskSystem; }
+
+//-------------------------------------------------------------------------
+
 namespace EE::Resource
 {
     class EE_SYSTEM_API ResourceRequest
@@ -20,6 +26,8 @@ namespace EE::Resource
             // Load Stages
             RequestRawResource,
             WaitForRawResourceRequest,
+            ReadResourceFile,
+            WaitForResourceFileRead,
             LoadResource,
             WaitForLoadDependencies,
             InstallResource,
@@ -54,16 +62,17 @@ namespace EE::Resource
 
         struct RequestContext
         {
+            TaskSystem*                         m_pTaskSystem = nullptr;
             TFunction<void( ResourceRequest* )> m_createRawRequestRequestFunction;
             TFunction<void( ResourceRequest* )> m_cancelRawRequestRequestFunction;
-            TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_loadResourceFunction;
+            TFunction<void( ResourceRequesterID const&, ResourcePtr&, ResourcePriority )> m_loadResourceFunction;
             TFunction<void( ResourceRequesterID const&, ResourcePtr& )> m_unloadResourceFunction;
         };
 
     public:
 
         ResourceRequest() = default;
-        ResourceRequest( ResourceRequesterID const& requesterID, Type type, ResourceRecord* pRecord, ResourceLoader* pResourceLoader );
+        ResourceRequest( ResourceRequesterID const& requesterID, Type type, ResourceRecord* pRecord, ResourceLoader* pResourceLoader, ResourcePriority priority = ResourcePriority::Normal );
 
         inline bool IsValid() const { return m_pResourceRecord != nullptr; }
         inline bool IsActive() const { return m_stage != Stage::Complete; }
@@ -73,7 +82,19 @@ namespace EE::Resource
 
         inline Stage GetStage() const { return m_stage; }
 
+        inline ResourcePriority GetPriority() const { return m_priority; }
+        inline void SetPriority( ResourcePriority priority ) { EE_ASSERT( priority < ResourcePriority::NumPriorities ); m_priority = priority; }
+
+        // The size of the raw resource data this request is currently holding in memory (either being read or waiting to be loaded)
+        inline size_t GetInFlightDataSize() const { return m_fileRead.GetBufferSize() + m_rawResourceData.size(); }
+
+        #if EE_DEVELOPMENT_TOOLS
+        // The time since the request was made (or switched back to a load)
+        inline Milliseconds GetRequestTime() const { return m_requestTimer.GetElapsedTimeMilliseconds(); }
+        #endif
+
         inline ResourceRecord const* GetResourceRecord() const { return m_pResourceRecord; }
+        inline ResourceRecord* GetResourceRecord() { return m_pResourceRecord; }
         inline ResourceID const& GetResourceID() const { return m_pResourceRecord->GetResourceID(); }
         inline ResourceTypeID GetResourceTypeID() const { return m_pResourceRecord->GetResourceTypeID(); }
         inline LoadingStatus GetLoadingStatus() const { return m_pResourceRecord->GetLoadingStatus(); }
@@ -89,6 +110,10 @@ namespace EE::Resource
         // Called by the resource provider once the request operation completes and provides the raw resource data
         void OnRawResourceRequestComplete( String const& filePath );
 
+        // Called by the resource provider once the request operation completes and provides the raw resource data directly
+        // The data is not copied and needs to remain valid until the request has loaded the resource (e.g. a memory mapped archive)
+        void OnRawResourceRequestComplete( uint8_t const* pRawData, size_t rawDataSize );
+
         // This will interrupt a load task and convert it into an unload task
         void SwitchToLoadTask();
 
@@ -98,6 +123,8 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         void RequestRawResource( RequestContext& requestContext );
+        void ReadResourceFile( RequestContext& requestContext );
+        void WaitForResourceFileRead( RequestContext& requestContext );
         void LoadResource( RequestContext& requestContext );
         void WaitForLoadDependencies( RequestContext& requestContext );
         void InstallResource( RequestContext& requestContext );
@@ -114,14 +141,19 @@ namespace EE::Resource
         ResourceLoader*                         m_pResourceLoader = nullptr;
         FileSystem::Path                        m_rawResourcePath;
         Blob                                    m_rawResourceData;
+        FileSystem::AsyncFileRead               m_fileRead;
+        uint8_t const*                          m_pRawResourceDataView = nullptr;
+        size_t                                  m_rawResourceDataViewSize = 0;
         InstallDependencyList                   m_pendingInstallDependencies;
         InstallDependencyList                   m_installDependencies;
         Type                                    m_type = Type::Invalid;
         Stage                                   m_stage = Stage::None;
+        ResourcePriority                        m_priority = ResourcePriority::Normal;
         bool                                    m_isReloadRequest = false;
 
         #if EE_DEVELOPMENT_TOOLS
         Timer<PlatformClock>                    m_stageTimer;
+        Timer<PlatformClock>                    m_requestTimer;
         #endif
     };
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "ResourceSettings.h"
+#include "ResourceCompression.h"
 #include "System/IniFile.h"
 #include "System/Log.h"
 #include "System/FileSystem/FileSystemUtils.h"
@@ -34,6 +35,44 @@ namespace EE::Resource
             return false;
         }
 
+        // Resource cache budgets - optional, defaults to no caching
+        //-------------------------------------------------------------------------
+
+        m_resourceCacheBudgets.clear();
+        if ( ini.TryGetString( "Resource:ResourceCacheBudgetsMB", tmp ) )
+        {
+            TVector<String> budgetStrings;
+            StringUtils::Split( tmp, budgetStrings, ", " );
+            for ( auto const& budgetString : budgetStrings )
+            {
+                TVector<String> budgetParts;
+                StringUtils::Split( budgetString, budgetParts, ":" );
+
+                // The budget needs to be a plain decimal number since strtoul silently returns 0 for garbage and accepts negative values
+                // We also limit the number of digits so that the budget can never overflow
+                bool isValidBudget = budgetParts.size() == 2 && ResourceTypeID::IsValidResourceFourCC( budgetParts[0] ) && !budgetParts[1].empty() && budgetParts[1].length() <= 9;
+                if ( isValidBudget )
+                {
+                    for ( char const c : budgetParts[1] )
+                    {
+                        if ( c < '0' || c > '9' )
+                        {
+                            isValidBudget = false;
+                            break;
+                        }
+                    }
+                }
+
+                if ( !isValidBudget )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid resource cache budget: %s, expected 'type:megabytes'", budgetString.c_str() );
+                    return false;
+                }
+
+                m_resourceCacheBudgets[ResourceTypeID( budgetParts[0] )] = size_t( std::strtoul( budgetParts[1].c_str(), nullptr, 10 ) ) * 1024 * 1024;
+            }
+        }
+
         // Development only settings
         //-------------------------------------------------------------------------
 
@@ -97,6 +136,22 @@ namespace EE::Resource
                 return false;
             }
 
+            // Compiled Resource Cache - optional
+            //-------------------------------------------------------------------------
+
+            m_compiledResourceCachePath.Clear();
+            if ( ini.TryGetString( "Paths:CompiledResourceCacheDirectoryName", tmp ) && !tmp.empty() )
+            {
+                m_compiledResourceCachePath = m_workingDirectoryPath + tmp;
+                if ( !m_compiledResourceCachePath.IsValid() )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compiled resource cache path: %s", m_compiledResourceCachePath.c_str() );
+                    return false;
+                }
+
+                m_compiledResourceCachePath.MakeIntoDirectoryPath();
+            }
+
             // Resource Compiler
             //-------------------------------------------------------------------------
 
@@ -149,6 +204,58 @@ namespace EE::Resource
                 EE_LOG_ERROR( "Resource", "Resource Settings", "Failed to read ResourceServerPort from ini file" );
                 return false;
             }
+
+            // Compression - optional, defaults to no compression
+            //-------------------------------------------------------------------------
+
+            m_compressedResourceTypes.clear();
+            if ( ini.TryGetString( "Resource:CompressedResourceTypes", tmp ) )
+            {
+                TVector<String> typeStrings;
+                StringUtils::Split( tmp, typeStrings, ", " );
+                for ( auto const& typeString : typeStrings )
+                {
+                    if ( !ResourceTypeID::IsValidResourceFourCC( typeString ) )
+                    {
+                        EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compressed resource type: %s", typeString.c_str() );
+                        return false;
+                    }
+
+                    m_compressedResourceTypes.emplace_back( ResourceTypeID( typeString ) );
+                }
+            }
+
+            if ( ini.TryGetUInt( "Resource:CompressionBlockSize", tempValue ) )
+            {
+                if ( tempValue < ResourceCompression::s_minBlockSize || tempValue > ResourceCompression::s_maxBlockSize )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compression block size: %u, needs to be between %u and %u", tempValue, ResourceCompression::s_minBlockSize, ResourceCompression::s_maxBlockSize );
+                    return false;
+                }
+
+                m_compressionBlockSize = tempValue;
+            }
+
+            // Compiler workers - optional, defaults to a compiler process per compile
+            //-------------------------------------------------------------------------
+
+            m_numCompilerWorkers = 0;
+            if ( ini.TryGetUInt( "Resource:NumCompilerWorkers", tempValue ) )
+            {
+                m_numCompilerWorkers = (int32_t) Math::Min( tempValue, 64u );
+            }
+
+            m_compilerWorkerPort = m_resourceServerPort + 1;
+            if ( ini.TryGetUInt( "Resource:CompilerWorkerPort", tempValue ) )
+            {
+                if ( tempValue == m_resourceServerPort || tempValue > 0xFFFF )
+                {
+                    EE_LOG_ERROR( "Resource", "Resource Settings", "Invalid compiler worker port: %u", tempValue );
+                    return false;
+                }
+
+                m_compilerWorkerPort = (uint16_t) tempValue;
+            }
         }
         #endif
 
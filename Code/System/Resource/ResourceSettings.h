@@ -3,6 +3,9 @@
 #include "System/_Module/API.h"
 #include "System/Math/Math.h"
 #include "System/FileSystem/FileSystemPath.h"
+#include "System/Resource/ResourceTypeID.h"
+#include "System/Types/Arrays.h"
+#include "System/Types/HashMap.h"
 
 //-------------------------------------------------------------------------
 
@@ -18,10 +21,22 @@ namespace EE::Resource
 
         bool ReadSettings( IniFile const& ini );
 
+        // Get the memory budget for a resource type, unreferenced resources of a type are only kept resident while the type is within its budget
+        inline size_t GetResourceCacheBudget( ResourceTypeID typeID ) const
+        {
+            auto const iter = m_resourceCacheBudgets.find( typeID );
+            return ( iter != m_resourceCacheBudgets.end() ) ? iter->second : 0;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        inline bool ShouldCompressResourceType( ResourceTypeID typeID ) const { return VectorContains( m_compressedResourceTypes, typeID ); }
+        #endif
+
     public:
 
         FileSystem::Path        m_workingDirectoryPath;
         FileSystem::Path        m_compiledResourcePath;
+        THashMap<ResourceTypeID, size_t> m_resourceCacheBudgets;            // Per-type memory budgets in bytes, types without a budget are unloaded as soon as they are no longer referenced
 
         #if EE_DEVELOPMENT_TOOLS
         FileSystem::Path        m_packagedBuildCompiledResourcePath;
@@ -29,8 +44,13 @@ namespace EE::Resource
         uint16_t                m_resourceServerPort;
         FileSystem::Path        m_rawResourcePath;
         FileSystem::Path        m_compiledResourceDatabasePath;
+        FileSystem::Path        m_compiledResourceCachePath;                // Optional content addressed cache of compiled resources, empty if disabled
         FileSystem::Path        m_resourceServerExecutablePath;
         FileSystem::Path        m_resourceCompilerExecutablePath;
+        TVector<ResourceTypeID> m_compressedResourceTypes;                  // The compiled resources of these types are block compressed
+        uint32_t                m_compressionBlockSize = 128 * 1024;
+        int32_t                 m_numCompilerWorkers = 0;                   // The number of persistent compiler processes used by the resource server, 0 starts a new compiler process per compile
+        uint16_t                m_compilerWorkerPort = 0;
         #endif
     };
 }
\ No newline at end of file
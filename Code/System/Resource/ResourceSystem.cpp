@@ -2,6 +2,7 @@
 #include "ResourceProvider.h"
 #include "ResourceRequest.h"
 #include "System/Profiling.h"
+#include "EASTL/sort.h"
 
 //-------------------------------------------------------------------------
 
@@ -10,7 +11,13 @@ namespace EE::Resource
     ResourceSystem::ResourceSystem( TaskSystem& taskSystem )
         : m_taskSystem( taskSystem )
         , m_asyncProcessingTask( [this] ( TaskSetPartition range, uint32_t threadnum ) { ProcessResourceRequests(); } )
-    {}
+    {
+        m_requestContext.m_pTaskSystem = &m_taskSystem;
+        m_requestContext.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
+        m_requestContext.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
+        m_requestContext.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr, ResourcePriority priority ) { LoadResource( resourcePtr, requesterID, priority ); };
+        m_requestContext.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
+    }
 
     ResourceSystem::~ResourceSystem()
     {
@@ -30,6 +37,8 @@ namespace EE::Resource
 
     void ResourceSystem::Shutdown()
     {
+        // Disabling the cache ensures all cached resources are unloaded
+        m_isResourceCacheEnabled = false;
         WaitForAllRequestsToComplete();
         m_pResourceProvider = nullptr;
     }
@@ -51,6 +60,12 @@ namespace EE::Resource
             return true;
         }
 
+        // Cached resources still need to be evicted
+        if ( !m_isResourceCacheEnabled && !m_cachedResources.empty() )
+        {
+            return true;
+        }
+
         return false;
     }
 
@@ -146,8 +161,9 @@ namespace EE::Resource
         return recordIter->second;
     }
 
-    void ResourceSystem::LoadResource( ResourcePtr& resourcePtr, ResourceRequesterID const& requesterID )
+    void ResourceSystem::LoadResource( ResourcePtr& resourcePtr, ResourceRequesterID const& requesterID, ResourcePriority priority )
     {
+        EE_ASSERT( priority < ResourcePriority::NumPriorities );
         Threading::RecursiveScopeLock lock( m_accessLock );
 
         // Immediately update the resource ptr
@@ -158,7 +174,11 @@ namespace EE::Resource
 
         if ( !pRecord->HasReferences() )
         {
-            AddPendingRequest( PendingRequest( PendingRequest::Type::Load, pRecord, requesterID ) );
+            AddPendingRequest( PendingRequest( PendingRequest::Type::Load, pRecord, requesterID, priority ) );
+        }
+        else if ( !pRecord->IsLoaded() ) // Someone else is already loading this resource, make sure it isnt loaded at a lower priority than we need
+        {
+            m_pendingPriorityChanges.emplace_back( PendingPriorityChange( pRecord->GetResourceID(), priority, true ) );
         }
 
         pRecord->AddReference( requesterID );
@@ -201,6 +221,150 @@ namespace EE::Resource
         }
     }
 
+    void ResourceSystem::SetResourcePriority( ResourceID const& resourceID, ResourcePriority priority )
+    {
+        EE_ASSERT( resourceID.IsValid() && priority < ResourcePriority::NumPriorities );
+        Threading::RecursiveScopeLock lock( m_accessLock );
+        m_pendingPriorityChanges.emplace_back( PendingPriorityChange( resourceID, priority, false ) );
+    }
+
+    void ResourceSystem::ApplyPendingPriorityChanges()
+    {
+        EE_ASSERT( !m_isAsyncTaskRunning );
+        Threading::RecursiveScopeLock lock( m_accessLock );
+
+        for ( auto const& priorityChange : m_pendingPriorityChanges )
+        {
+            // The resource may have been unloaded in the meantime
+            auto const recordIter = m_resourceRecords.find( priorityChange.m_resourceID );
+            if ( recordIter == m_resourceRecords.end() )
+            {
+                continue;
+            }
+
+            auto ShouldChangePriority = [&priorityChange] ( ResourcePriority currentPriority )
+            {
+                return !priorityChange.m_onlyRaisePriority || priorityChange.m_priority < currentPriority;
+            };
+
+            // Update any queued request
+            auto predicate = [] ( PendingRequest const& request, ResourceRecord const* pRecord ) { return request.m_pRecord == pRecord; };
+            int32_t const foundIdx = VectorFindIndex( m_pendingRequests, recordIter->second, predicate );
+            if ( foundIdx != InvalidIndex && ShouldChangePriority( m_pendingRequests[foundIdx].m_priority ) )
+            {
+                m_pendingRequests[foundIdx].m_priority = priorityChange.m_priority;
+            }
+
+            // Update the active request
+            ResourceRequest* pActiveRequest = TryFindActiveRequest( recordIter->second );
+            if ( pActiveRequest != nullptr && ShouldChangePriority( pActiveRequest->GetPriority() ) )
+            {
+                pActiveRequest->SetPriority( priorityChange.m_priority );
+            }
+        }
+
+        m_pendingPriorityChanges.clear();
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool ResourceSystem::TryAddToResourceCache( ResourceRecord* pRecord )
+    {
+        EE_ASSERT( pRecord != nullptr && !VectorContains( m_cachedResources, pRecord ) );
+
+        if ( !m_isResourceCacheEnabled || !pRecord->IsLoaded() || pRecord->HasReferences() )
+        {
+            return false;
+        }
+
+        if ( GetSettings().GetResourceCacheBudget( pRecord->GetResourceTypeID() ) == 0 )
+        {
+            return false;
+        }
+
+        #if EE_DEVELOPMENT_TOOLS
+        if ( pRecord->m_isHotReloadPending )
+        {
+            return false;
+        }
+        #endif
+
+        //-------------------------------------------------------------------------
+
+        m_cachedResources.emplace_back( pRecord );
+        m_typeMemoryStats[pRecord->GetResourceTypeID()].m_cachedBytes += pRecord->m_accountedMemorySize;
+        return true;
+    }
+
+    bool ResourceSystem::TryRemoveFromResourceCache( ResourceRecord* pRecord )
+    {
+        EE_ASSERT( pRecord != nullptr );
+
+        int32_t const foundIdx = VectorFindIndex( m_cachedResources, pRecord );
+        if ( foundIdx == InvalidIndex )
+        {
+            return false;
+        }
+
+        // Keep the LRU order
+        m_cachedResources.erase( m_cachedResources.begin() + foundIdx );
+        m_typeMemoryStats[pRecord->GetResourceTypeID()].m_cachedBytes -= pRecord->m_accountedMemorySize;
+        return true;
+    }
+
+    void ResourceSystem::EvictCachedResources()
+    {
+        EE_ASSERT( !m_isAsyncTaskRunning );
+
+        // The cache is in LRU order, so we evict the least recently released resources first
+        for ( int32_t i = 0; i < (int32_t) m_cachedResources.size(); )
+        {
+            ResourceRecord* pRecord = m_cachedResources[i];
+            EE_ASSERT( pRecord->IsLoaded() && !pRecord->HasReferences() );
+
+            ResourceTypeID const typeID = pRecord->GetResourceTypeID();
+            TypeMemoryStats& stats = m_typeMemoryStats[typeID];
+
+            bool shouldEvict = !m_isResourceCacheEnabled || stats.m_residentBytes > GetSettings().GetResourceCacheBudget( typeID );
+
+            #if EE_DEVELOPMENT_TOOLS
+            shouldEvict |= pRecord->m_isHotReloadPending;
+            #endif
+
+            if ( !shouldEvict )
+            {
+                i++;
+                continue;
+            }
+
+            //-------------------------------------------------------------------------
+
+            m_cachedResources.erase( m_cachedResources.begin() + i );
+            stats.m_cachedBytes -= pRecord->m_accountedMemorySize;
+            stats.m_numEvictions++;
+
+            // Stop counting the memory immediately, otherwise we would keep evicting resources until the unload completes
+            stats.m_residentBytes -= pRecord->m_accountedMemorySize;
+            pRecord->m_accountedMemorySize = 0;
+
+            auto loaderIter = m_resourceLoaders.find( typeID );
+            EE_ASSERT( loaderIter != m_resourceLoaders.end() );
+            m_activeRequests.emplace_back( EE::New<ResourceRequest>( ResourceRequesterID(), ResourceRequest::Type::Unload, pRecord, loaderIter->second ) );
+        }
+    }
+
+    void ResourceSystem::UpdateMemoryStats( ResourceRecord* pRecord )
+    {
+        EE_ASSERT( pRecord != nullptr );
+
+        size_t const memorySize = pRecord->IsLoaded() ? pRecord->m_memorySize : 0;
+        TypeMemoryStats& stats = m_typeMemoryStats[pRecord->GetResourceTypeID()];
+        stats.m_residentBytes = stats.m_residentBytes - pRecord->m_accountedMemorySize + memorySize;
+        pRecord->m_accountedMemorySize = memorySize;
+    }
+
+    //-------------------------------------------------------------------------
+
     ResourceRequest* ResourceSystem::TryFindActiveRequest( ResourceRecord const* pResourceRecord ) const
     {
         EE_ASSERT( pResourceRecord != nullptr );
@@ -269,6 +433,9 @@ namespace EE::Resource
         {
             Threading::RecursiveScopeLock lock( m_accessLock );
 
+            // Priority changes need to be applied before any records can be destroyed below
+            ApplyPendingPriorityChanges();
+
             for ( auto& pendingRequest : m_pendingRequests )
             {
                 // Get existing active request
@@ -284,15 +451,23 @@ namespace EE::Resource
                             pActiveRequest->SwitchToLoadTask();
                         }
                     }
-                    else if ( pendingRequest.m_pRecord->IsLoaded() ) // Can occur due to multiple requests for the same resource in the same frame
+                    else if ( pendingRequest.m_pRecord->IsLoaded() ) // Can occur due to multiple requests for the same resource in the same frame or if the resource was cached
                     {
-                        // Do Nothing
+                        if ( TryRemoveFromResourceCache( pendingRequest.m_pRecord ) )
+                        {
+                            m_typeMemoryStats[pendingRequest.m_pRecord->GetResourceTypeID()].m_numCacheHits++;
+                        }
                     }
                     else // Create new request
                     {
+                        if ( GetSettings().GetResourceCacheBudget( pendingRequest.m_pRecord->GetResourceTypeID() ) > 0 )
+                        {
+                            m_typeMemoryStats[pendingRequest.m_pRecord->GetResourceTypeID()].m_numCacheMisses++;
+                        }
+
                         auto loaderIter = m_resourceLoaders.find( pendingRequest.m_pRecord->GetResourceTypeID() );
                         EE_ASSERT( loaderIter != m_resourceLoaders.end() );
-                        m_activeRequests.emplace_back( EE::New<ResourceRequest>( pendingRequest.m_requesterID, ResourceRequest::Type::Load, pendingRequest.m_pRecord, loaderIter->second ) );
+                        m_activeRequests.emplace_back( EE::New<ResourceRequest>( pendingRequest.m_requesterID, ResourceRequest::Type::Load, pendingRequest.m_pRecord, loaderIter->second, pendingRequest.m_priority ) );
                     }
                 }
                 else // Unload request
@@ -316,6 +491,10 @@ namespace EE::Resource
                             m_resourceRecords.erase( recordIter );
                         }
                     }
+                    else if ( TryAddToResourceCache( pendingRequest.m_pRecord ) )
+                    {
+                        // Do Nothing - the resource stays resident until its type exceeds its memory budget
+                    }
                     else // Create new request
                     {
                         auto loaderIter = m_resourceLoaders.find( pendingRequest.m_pRecord->GetResourceTypeID() );
@@ -327,6 +506,11 @@ namespace EE::Resource
 
             m_pendingRequests.clear();
 
+            // Unload cached resources that no longer fit in the memory budgets
+            //-------------------------------------------------------------------------
+
+            EvictCachedResources();
+
             // Process completed requests
             //-------------------------------------------------------------------------
 
@@ -335,8 +519,21 @@ namespace EE::Resource
                 ResourceID const resourceID = pCompletedRequest->GetResourceID();
                 EE_ASSERT( pCompletedRequest->IsComplete() );
 
+                UpdateMemoryStats( pCompletedRequest->GetResourceRecord() );
+
                 #if EE_DEVELOPMENT_TOOLS
                 m_history.emplace_back( CompletedRequestLog( pCompletedRequest->IsLoadRequest() ? PendingRequest::Type::Load : PendingRequest::Type::Unload, resourceID ) );
+
+                if ( pCompletedRequest->IsLoadRequest() && pCompletedRequest->GetResourceRecord()->IsLoaded() )
+                {
+                    m_loadLatencies[(size_t) pCompletedRequest->GetPriority()].AddSample( pCompletedRequest->GetRequestTime() );
+                }
+
+                // Once the resource has been loaded again, the hot-reload is complete and the resource can be cached as normal
+                if ( pCompletedRequest->IsLoadRequest() )
+                {
+                    pCompletedRequest->GetResourceRecord()->m_isHotReloadPending = false;
+                }
                 #endif
 
                 if ( pCompletedRequest->IsUnloadRequest() )
@@ -382,25 +579,96 @@ namespace EE::Resource
     {
         EE_PROFILE_FUNCTION_RESOURCE();
 
+        // Process the requests in priority order, the sort is stable so requests with the same priority keep the order in which they were made
+        auto comparator = [] ( ResourceRequest const* pRequestA, ResourceRequest const* pRequestB ) { return pRequestA->GetPriority() < pRequestB->GetPriority(); };
+        eastl::stable_sort( m_activeRequests.begin(), m_activeRequests.end(), comparator );
+
+        // Load requests
         //-------------------------------------------------------------------------
+        // File reads are issued asynchronously by the requests, so the deserialization of independent requests is the bulk of the loading cost, run it in parallel
+        // These requests then continue through the rest of the state machine below in the same pass
 
-        // We dont have to worry about this loop even if the m_activeRequests array is modified from another thread since we only access the array in 2 places and both use locks
-        for ( int32_t i = (int32_t) m_activeRequests.size() - 1; i >= 0; i-- )
+        m_requestsToLoad.clear();
+        for ( ResourceRequest* pRequest : m_activeRequests )
         {
-            ResourceRequest::RequestContext context;
-            context.m_createRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->RequestRawResource( pRequest ); };
-            context.m_cancelRawRequestRequestFunction = [this] ( ResourceRequest* pRequest ) { m_pResourceProvider->CancelRequest( pRequest ); };
-            context.m_loadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { LoadResource( resourcePtr, requesterID ); };
-            context.m_unloadResourceFunction = [this] ( ResourceRequesterID const& requesterID, ResourcePtr& resourcePtr ) { UnloadResource( resourcePtr, requesterID ); };
+            if ( pRequest->GetStage() == ResourceRequest::Stage::LoadResource )
+            {
+                m_requestsToLoad.emplace_back( pRequest );
+                if ( (int32_t) m_requestsToLoad.size() == m_maxConcurrentLoads )
+                {
+                    break;
+                }
+            }
+        }
 
-            //-------------------------------------------------------------------------
+        if ( !m_requestsToLoad.empty() )
+        {
+            UpdateRequestsConcurrently( m_requestsToLoad );
+        }
 
+        // Issue file reads
+        //-------------------------------------------------------------------------
+        // Opening the files blocks, so the reads are issued in parallel rather than one after another on this task
+
+        size_t inFlightReadBytes = 0;
+        for ( ResourceRequest const* pRequest : m_activeRequests )
+        {
+            inFlightReadBytes += pRequest->GetInFlightDataSize();
+        }
+
+        m_requestsToRead.clear();
+        for ( ResourceRequest* pRequest : m_activeRequests )
+        {
+            if ( pRequest->IsActive() && pRequest->GetStage() == ResourceRequest::Stage::ReadResourceFile )
+            {
+                if ( pRequest->GetPriority() == ResourcePriority::Critical || inFlightReadBytes < m_maxInFlightReadBytes )
+                {
+                    m_requestsToRead.emplace_back( pRequest );
+                    if ( (int32_t) m_requestsToRead.size() == s_maxFileReadsIssuedPerUpdate )
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        if ( !m_requestsToRead.empty() )
+        {
+            UpdateRequestsConcurrently( m_requestsToRead );
+        }
+
+        // Update requests
+        //-------------------------------------------------------------------------
+
+        // We dont have to worry about this loop even if the m_activeRequests array is modified from another thread since we only access the array in 2 places and both use locks
+        // Incomplete requests are compacted in place so that the array remains in request order
+        int32_t numIncompleteRequests = 0;
+        int32_t const numActiveRequests = (int32_t) m_activeRequests.size();
+        for ( int32_t i = 0; i < numActiveRequests; i++ )
+        {
             bool isRequestComplete = false;
 
             ResourceRequest* pRequest = m_activeRequests[i];
             if ( pRequest->IsActive() )
             {
-                isRequestComplete = pRequest->Update( context );
+                bool shouldUpdate = true;
+
+                // Any requests still waiting to load are over the concurrent load limit, they will be loaded in a subsequent pass
+                if ( pRequest->GetStage() == ResourceRequest::Stage::LoadResource )
+                {
+                    shouldUpdate = false;
+                }
+
+                // Any requests still waiting to read are over the read budget, their reads will be issued in a subsequent pass
+                else if ( pRequest->GetStage() == ResourceRequest::Stage::ReadResourceFile )
+                {
+                    shouldUpdate = false;
+                }
+
+                if ( shouldUpdate )
+                {
+                    isRequestComplete = pRequest->Update( m_requestContext );
+                }
             }
             else
             {
@@ -413,9 +681,60 @@ namespace EE::Resource
             {
                 // We need to process and remove completed requests at the next update stage since unload task may have queued unload requests which refer to the request's allocated memory
                 m_completedRequests.emplace_back( pRequest );
-                m_activeRequests.erase_unsorted( m_activeRequests.begin() + i );
+            }
+            else
+            {
+                m_activeRequests[numIncompleteRequests] = pRequest;
+                numIncompleteRequests++;
             }
         }
+
+        m_activeRequests.resize( numIncompleteRequests );
+    }
+
+    void ResourceSystem::UpdateRequestsConcurrently( TVector<ResourceRequest*> const& requests )
+    {
+        EE_PROFILE_FUNCTION_RESOURCE();
+
+        // No need to go wide for a single request
+        if ( requests.size() == 1 )
+        {
+            requests[0]->Update( m_requestContext );
+            return;
+        }
+
+        //-------------------------------------------------------------------------
+
+        struct UpdateRequestsTask final : public ITaskSet
+        {
+            UpdateRequestsTask( TVector<ResourceRequest*> const& requests, ResourceRequest::RequestContext& context )
+                : m_requests( requests )
+                , m_context( context )
+            {
+                m_SetSize = (uint32_t) requests.size();
+                m_MinRange = 1;
+            }
+
+            virtual void ExecuteRange( TaskSetPartition range, uint32_t threadnum ) override final
+            {
+                for ( uint32_t i = range.start; i < range.end; i++ )
+                {
+                    EE_PROFILE_SCOPE_RESOURCE( "Update Request" );
+                    EE_ASSERT( m_requests[i]->GetStage() == ResourceRequest::Stage::ReadResourceFile || m_requests[i]->GetStage() == ResourceRequest::Stage::LoadResource );
+                    m_requests[i]->Update( m_context );
+                }
+            }
+
+        private:
+
+            TVector<ResourceRequest*> const&                    m_requests;
+            ResourceRequest::RequestContext&                    m_context;
+        };
+
+        // Use the smallest possible partitions so idle workers can steal individual requests, since load costs vary wildly between resources
+        UpdateRequestsTask updateTask( requests, m_requestContext );
+        m_taskSystem.ScheduleTask( &updateTask );
+        m_taskSystem.WaitForTask( &updateTask );
     }
 
     //-------------------------------------------------------------------------
@@ -436,6 +755,9 @@ namespace EE::Resource
         ResourceRecord* pRecord = recordIter->second;
         GetUsersForResource( pRecord, m_usersThatRequireReload );
 
+        // Ensure that the resource is actually unloaded once released (or evicted if it is currently cached) so that it can be reloaded
+        pRecord->m_isHotReloadPending = true;
+
         // Add to list of resources to be reloaded
         m_externallyUpdatedResources.emplace_back( resourceID );
     }
@@ -446,5 +768,19 @@ namespace EE::Resource
         m_usersThatRequireReload.clear(); 
         m_externallyUpdatedResources.clear();
     }
+
+    void ResourceSystem::LatencySamples::AddSample( Milliseconds latency )
+    {
+        if ( m_samples.size() < s_maxSamples )
+        {
+            m_samples.emplace_back( latency.ToFloat() );
+        }
+        else
+        {
+            m_samples[m_nextSampleIdx] = latency.ToFloat();
+        }
+
+        m_nextSampleIdx = ( m_nextSampleIdx + 1 ) % s_maxSamples;
+    }
     #endif
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "System/_Module/API.h"
 #include "ResourcePtr.h"
+#include "ResourceRequest.h"
 #include "System/Threading/Threading.h"
 #include "System/Threading/TaskSystem.h"
 #include "System/Systems.h"
@@ -36,10 +37,11 @@ namespace EE::Resource
 
             PendingRequest() = default;
 
-            PendingRequest( Type type, ResourceRecord* pRecord, ResourceRequesterID const& requesterID )
+            PendingRequest( Type type, ResourceRecord* pRecord, ResourceRequesterID const& requesterID, ResourcePriority priority = ResourcePriority::Normal )
                 : m_pRecord( pRecord )
                 , m_requesterID( requesterID )
                 , m_type( type )
+                , m_priority( priority )
             {
                 EE_ASSERT( m_pRecord != nullptr );
             }
@@ -47,6 +49,30 @@ namespace EE::Resource
             ResourceRecord*         m_pRecord = nullptr;
             ResourceRequesterID     m_requesterID;
             Type                    m_type = Type::Load;
+            ResourcePriority        m_priority = ResourcePriority::Normal;
+        };
+
+        struct PendingPriorityChange
+        {
+            PendingPriorityChange( ResourceID const& resourceID, ResourcePriority priority, bool onlyRaisePriority )
+                : m_resourceID( resourceID )
+                , m_priority( priority )
+                , m_onlyRaisePriority( onlyRaisePriority )
+            {}
+
+            ResourceID              m_resourceID;
+            ResourcePriority        m_priority;
+            bool                    m_onlyRaisePriority;
+        };
+
+        // Memory and resource cache statistics for a single resource type
+        struct TypeMemoryStats
+        {
+            size_t                  m_residentBytes = 0;        // All loaded resources of this type, including cached resources
+            size_t                  m_cachedBytes = 0;          // Loaded resources of this type that are no longer referenced
+            uint32_t                m_numCacheHits = 0;
+            uint32_t                m_numCacheMisses = 0;
+            uint32_t                m_numEvictions = 0;
         };
 
         #if EE_DEVELOPMENT_TOOLS
@@ -58,12 +84,32 @@ namespace EE::Resource
             ResourceID              m_ID;
             TimeStamp               m_time;
         };
+
+        // A fixed size history of load request latencies, used to report latency percentiles per priority
+        struct LatencySamples
+        {
+            constexpr static int32_t const s_maxSamples = 256;
+
+            void AddSample( Milliseconds latency );
+
+            TVector<float>          m_samples;
+            int32_t                 m_nextSampleIdx = 0;
+        };
         #endif
 
     public:
 
         EE_SYSTEM_ID( ResourceSystem );
 
+        // The default max number of requests that can be reading/loading their data at the same time
+        constexpr static int32_t const s_defaultMaxConcurrentLoads = 32;
+
+        // The default max amount of raw resource data that can be read into memory at the same time
+        constexpr static size_t const s_defaultMaxInFlightReadBytes = 64 * 1024 * 1024;
+
+        // The max number of file reads issued in a single update, this bounds how far a single update can exceed the in-flight read budget
+        constexpr static int32_t const s_maxFileReadsIssuedPerUpdate = 64;
+
     public:
 
         ResourceSystem( TaskSystem& taskSystem );
@@ -83,6 +129,38 @@ namespace EE::Resource
         // Blocking wait for all requests to be completed
         void WaitForAllRequestsToComplete();
 
+        // Concurrent Loading
+        //-------------------------------------------------------------------------
+        // Requests that are ready to read and load their data are processed in parallel on the task system
+        // The limit bounds the number of requests decompressing and deserializing their data at once, setting it to 1 will load all requests sequentially
+        // It does not bound the raw file buffers in memory, those are bounded by the in-flight read budget below
+
+        inline int32_t GetMaxConcurrentLoads() const { return m_maxConcurrentLoads; }
+        inline void SetMaxConcurrentLoads( int32_t maxConcurrentLoads ) { EE_ASSERT( maxConcurrentLoads > 0 ); m_maxConcurrentLoads = maxConcurrentLoads; }
+
+        // Scheduling
+        //-------------------------------------------------------------------------
+        // Active requests are read and loaded in priority order. New file reads are only issued while the amount of raw data in memory is under the budget.
+        // We always allow at least one read in flight so that a resource larger than the budget can still load, and critical requests ignore the budget entirely.
+        // Opening a file blocks, so each update issues its reads in parallel on the task system. File sizes are only known once the reads are issued,
+        // so a single update can exceed the budget by up to 's_maxFileReadsIssuedPerUpdate' reads.
+
+        inline size_t GetMaxInFlightReadBytes() const { return m_maxInFlightReadBytes; }
+        inline void SetMaxInFlightReadBytes( size_t maxInFlightReadBytes ) { EE_ASSERT( maxInFlightReadBytes > 0 ); m_maxInFlightReadBytes = maxInFlightReadBytes; }
+
+        // Change the priority of a queued or in-flight load request for the specified resource, this does nothing if the resource is already loaded
+        void SetResourcePriority( ResourceID const& resourceID, ResourcePriority priority );
+
+        // Resource Cache
+        //-------------------------------------------------------------------------
+        // Released resources of types with a memory budget (see ResourceSettings) are kept resident, so we dont need to reload them if they are requested again
+        // Cached resources are only unloaded once their type exceeds its budget, least recently released first
+
+        inline bool IsResourceCacheEnabled() const { return m_isResourceCacheEnabled; }
+
+        // Disabling the cache will unload all currently cached resources
+        inline void SetResourceCacheEnabled( bool isEnabled ) { m_isResourceCacheEnabled = isEnabled; }
+
         // Resource Loaders
         //-------------------------------------------------------------------------
 
@@ -93,13 +171,14 @@ namespace EE::Resource
         //-------------------------------------------------------------------------
 
         // Request a load of a resource, can optionally provide a ResourceRequesterID for identification of the request source
-        void LoadResource( ResourcePtr& resourcePtr, ResourceRequesterID const& requesterID = ResourceRequesterID() );
+        // If the resource is already being loaded, the load will be raised to the specified priority if needed
+        void LoadResource( ResourcePtr& resourcePtr, ResourceRequesterID const& requesterID = ResourceRequesterID(), ResourcePriority priority = ResourcePriority::Normal );
 
         // Request an unload of a resource, can optionally provide a ResourceRequesterID for identification of the request source
         void UnloadResource( ResourcePtr& resourcePtr, ResourceRequesterID const& requesterID = ResourceRequesterID() );
 
         template<typename T>
-        inline void LoadResource( TResourcePtr<T>& resourcePtr, ResourceRequesterID const& requesterID = ResourceRequesterID() ) { LoadResource( (ResourcePtr&) resourcePtr, requesterID ); }
+        inline void LoadResource( TResourcePtr<T>& resourcePtr, ResourceRequesterID const& requesterID = ResourceRequesterID(), ResourcePriority priority = ResourcePriority::Normal ) { LoadResource( (ResourcePtr&) resourcePtr, requesterID, priority ); }
 
         template<typename T>
         inline void UnloadResource( TResourcePtr<T>& resourcePtr, ResourceRequesterID const& requesterID = ResourceRequesterID() ) { UnloadResource( (ResourcePtr&) resourcePtr, requesterID ); }
@@ -129,6 +208,19 @@ namespace EE::Resource
         ResourceRecord* FindExistingResourceRecord( ResourceID const& resourceID );
 
         void AddPendingRequest( PendingRequest&& request );
+        void ApplyPendingPriorityChanges();
+
+        // Returns true if the resource was added to the cache, only loaded resources of types with a budget are cached
+        bool TryAddToResourceCache( ResourceRecord* pRecord );
+
+        // Returns true if the resource was in the cache
+        bool TryRemoveFromResourceCache( ResourceRecord* pRecord );
+
+        // Unload cached resources for any types that are over budget
+        void EvictCachedResources();
+
+        // Update the per-type memory stats for a record whose request has completed
+        void UpdateMemoryStats( ResourceRecord* pRecord );
         ResourceRequest* TryFindActiveRequest( ResourceRecord const* pResourceRecord ) const;
 
         // Returns a list of all unique external references for the given resource
@@ -137,6 +229,9 @@ namespace EE::Resource
         // Process all queued resource requests
         void ProcessResourceRequests();
 
+        // Update all the specified requests in parallel (i.e. issue their file reads or load their data), this will block until all updates are complete
+        void UpdateRequestsConcurrently( TVector<ResourceRequest*> const& requests );
+
     private:
 
         TaskSystem&                                             m_taskSystem;
@@ -147,8 +242,19 @@ namespace EE::Resource
 
         // Requests
         TVector<PendingRequest>                                 m_pendingRequests;
+        TVector<PendingPriorityChange>                          m_pendingPriorityChanges;
         TVector<ResourceRequest*>                               m_activeRequests;
         TVector<ResourceRequest*>                               m_completedRequests;
+        TVector<ResourceRequest*>                               m_requestsToLoad;
+        TVector<ResourceRequest*>                               m_requestsToRead;
+        ResourceRequest::RequestContext                         m_requestContext;
+        int32_t                                                 m_maxConcurrentLoads = s_defaultMaxConcurrentLoads;
+        size_t                                                  m_maxInFlightReadBytes = s_defaultMaxInFlightReadBytes;
+
+        // Memory
+        THashMap<ResourceTypeID, TypeMemoryStats>               m_typeMemoryStats;
+        TVector<ResourceRecord*>                                m_cachedResources;              // Unreferenced resources that are kept resident, least recently released first
+        bool                                                    m_isResourceCacheEnabled = true;
 
         // ASync
         AsyncTask                                               m_asyncProcessingTask;
@@ -158,6 +264,7 @@ namespace EE::Resource
         TVector<ResourceRequesterID>                            m_usersThatRequireReload;
         TVector<ResourceID>                                     m_externallyUpdatedResources;
         TVector<CompletedRequestLog>                            m_history;
+        TArray<LatencySamples, (size_t) ResourcePriority::NumPriorities> m_loadLatencies;
         #endif
     };
 }
\ No newline at end of file
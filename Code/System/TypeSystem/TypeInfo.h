@@ -4,6 +4,7 @@
 #include "System/Types/Arrays.h"
 #include "System/Types/HashMap.h"
 #include "System/Types/LoadingStatus.h"
+#include "System/Resource/ResourcePriority.h"
 
 //-------------------------------------------------------------------------
 
@@ -86,7 +87,7 @@ namespace EE::TypeSystem
         // Resource Helpers
         //-------------------------------------------------------------------------
 
-        virtual void LoadResources( Resource::ResourceSystem* pResourceSystem, Resource::ResourceRequesterID const& requesterID, IRegisteredType* pType ) const = 0;
+        virtual void LoadResources( Resource::ResourceSystem* pResourceSystem, Resource::ResourceRequesterID const& requesterID, IRegisteredType* pType, Resource::ResourcePriority priority ) const = 0;
         virtual void UnloadResources( Resource::ResourceSystem* pResourceSystem, Resource::ResourceRequesterID const& requesterID, IRegisteredType* pType ) const = 0;
         virtual LoadingStatus GetResourceLoadingStatus( IRegisteredType* pType ) const = 0;
         virtual LoadingStatus GetResourceUnloadingStatus( IRegisteredType* pType ) const = 0;